@@ -0,0 +1,126 @@
+#include <furi.h>
+
+#include "../test.h" // IWYU pragma: keep
+
+#include <loader/firmware_api/firmware_api.h>
+#include <flipper_application/api_hashtable/api_hashtable.h>
+
+#define TAG "ApiHashtableTest"
+
+#define API_HASHTABLE_TEST_ROUNDS (100u)
+
+static void api_hashtable_test_sort(struct sym_entry* table, size_t count) {
+    for(size_t gap = count / 2; gap > 0; gap /= 2) {
+        for(size_t i = gap; i < count; i++) {
+            const struct sym_entry entry = table[i];
+            size_t j = i;
+            for(; j >= gap && table[j - gap].hash > entry.hash; j -= gap) {
+                table[j] = table[j - gap];
+            }
+            table[j] = entry;
+        }
+    }
+}
+
+// Same search as elf_resolve_from_hashtable does with std::lower_bound
+static bool api_hashtable_test_bsearch(
+    const struct sym_entry* table,
+    size_t count,
+    uint32_t hash,
+    Elf32_Addr* address) {
+    size_t first = 0;
+    while(count > 0) {
+        const size_t step = count / 2;
+        if(table[first + step].hash < hash) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+
+    if(table[first].hash != hash) return false;
+    *address = table[first].address;
+    return true;
+}
+
+MU_TEST(api_hashtable_perfect_hash_test) {
+    const PerfectHashApiInterface* api = (const PerfectHashApiInterface*)firmware_api_interface;
+    mu_assert(
+        firmware_api_interface->resolver_callback == elf_resolve_from_perfect_hash,
+        "firmware API is not a perfect hash");
+
+    const size_t count = api->table_size;
+    size_t resolved = 0;
+
+    // Every symbol bundled FAPs can import resolves to its own entry
+    for(size_t i = 0; i < count; i++) {
+        Elf32_Addr address = 0;
+        if(elf_resolve_from_perfect_hash(firmware_api_interface, api->table[i].hash, &address) &&
+           address == api->table[i].address) {
+            resolved++;
+        }
+    }
+    mu_assert_int_eq(count, resolved);
+
+    // Sorted copy for the binary search baseline and for generating missing hashes
+    struct sym_entry* sorted = malloc(sizeof(struct sym_entry) * count);
+    memcpy(sorted, api->table, sizeof(struct sym_entry) * count);
+    api_hashtable_test_sort(sorted, count);
+
+    size_t false_positives = 0;
+    for(size_t i = 0; i + 1 < count; i++) {
+        const uint32_t missing = sorted[i].hash + 1;
+        Elf32_Addr address;
+        if(missing != sorted[i + 1].hash &&
+           elf_resolve_from_perfect_hash(firmware_api_interface, missing, &address)) {
+            false_positives++;
+        }
+    }
+    mu_assert_int_eq(0, false_positives);
+
+    Elf32_Addr checksum_bsearch = 0, checksum_perfect = 0;
+
+    uint32_t start = furi_get_tick();
+    for(size_t round = 0; round < API_HASHTABLE_TEST_ROUNDS; round++) {
+        for(size_t i = 0; i < count; i++) {
+            Elf32_Addr address = 0;
+            api_hashtable_test_bsearch(sorted, count, api->table[i].hash, &address);
+            checksum_bsearch += address;
+        }
+    }
+    const uint32_t bsearch_elapsed = furi_get_tick() - start;
+
+    start = furi_get_tick();
+    for(size_t round = 0; round < API_HASHTABLE_TEST_ROUNDS; round++) {
+        for(size_t i = 0; i < count; i++) {
+            Elf32_Addr address = 0;
+            elf_resolve_from_perfect_hash(firmware_api_interface, api->table[i].hash, &address);
+            checksum_perfect += address;
+        }
+    }
+    const uint32_t perfect_elapsed = furi_get_tick() - start;
+
+    free(sorted);
+
+    FURI_LOG_I(
+        TAG,
+        "%u x %zu lookups: %lums binary search, %lums perfect hash",
+        API_HASHTABLE_TEST_ROUNDS,
+        count,
+        bsearch_elapsed,
+        perfect_elapsed);
+
+    mu_assert_int_eq(checksum_bsearch, checksum_perfect);
+}
+
+MU_TEST_SUITE(test_api_hashtable_suite) {
+    MU_RUN_TEST(api_hashtable_perfect_hash_test);
+}
+
+int run_minunit_test_api_hashtable(void) {
+    MU_RUN_SUITE(test_api_hashtable_suite);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_api_hashtable)
@@ -149,6 +149,29 @@ static void compress_test_random_comp_decomp() {
     compress_free(comp);
 }
 
+static void compress_test_empty_comp_decomp() {
+    Compress* comp = compress_alloc(CompressTypeHeatshrink, &compress_config_heatshrink_default);
+    uint8_t src_buff[1] = {0};
+    uint8_t encoded_buff[8];
+    uint8_t decoded_buff[8];
+
+    // Empty input still gets a header, so it can be told apart from a missing chunk
+    size_t encoded_size = 0;
+    mu_assert(
+        compress_encode(comp, src_buff, 0, encoded_buff, sizeof(encoded_buff), &encoded_size),
+        "Compress failed");
+    mu_assert(encoded_size == 1, "Encoded size is not a bare header");
+
+    size_t decoded_size = 1;
+    mu_assert(
+        compress_decode(
+            comp, encoded_buff, encoded_size, decoded_buff, sizeof(decoded_buff), &decoded_size),
+        "Decompress failed");
+    mu_assert(decoded_size == 0, "Decoded size is not zero");
+
+    compress_free(comp);
+}
+
 static int32_t hs_unpacker_file_read(void* context, uint8_t* buffer, size_t size) {
     File* file = (File*)context;
     return storage_file_read(file, buffer, size);
@@ -341,6 +364,7 @@ static void compress_test_heatshrink_tar() {
 MU_TEST_SUITE(test_compress) {
     MU_RUN_TEST(compress_test_random_comp_decomp);
     MU_RUN_TEST(compress_test_reference_comp_decomp);
+    MU_RUN_TEST(compress_test_empty_comp_decomp);
     MU_RUN_TEST(compress_test_heatshrink_stream);
     MU_RUN_TEST(compress_test_heatshrink_tar);
 }
@@ -0,0 +1,189 @@
+#include <furi.h>
+#include <storage/storage.h>
+#include <flipper_application/elf/elf_file.h>
+#include <flipper_application/elf/elf_file_i.h>
+
+#include "../test.h" // IWYU pragma: keep
+
+#define TAG "ElfImageCacheTest"
+
+// Any FAP with fast relocations will do, this plugin is always there
+#define ELF_IMAGE_CACHE_TEST_SOURCE \
+    EXT_PATH("apps_data/unit_tests/plugins/test_elf_image_cache.fal")
+#define ELF_IMAGE_CACHE_TEST_DIR   EXT_PATH(".tmp/unit_tests/elf_image_cache")
+#define ELF_IMAGE_CACHE_TEST_FILE  ELF_IMAGE_CACHE_TEST_DIR "/test.fal"
+#define ELF_IMAGE_CACHE_TEST_IMAGE ELF_IMAGE_CACHE_TEST_DIR "/test.img"
+
+#define ELF_IMAGE_CACHE_TEST_API_KEY       (0x13DA0001)
+#define ELF_IMAGE_CACHE_TEST_OTHER_API_KEY (0x13DA0002)
+
+typedef enum {
+    ElfImageCacheTestLoadFailed,
+    ElfImageCacheTestLoadFresh,
+    ElfImageCacheTestLoadCached,
+} ElfImageCacheTestLoad;
+
+static void elf_image_cache_test_import(void) {
+}
+
+// Loaded code is never run, so every import resolves to the same function
+static bool elf_image_cache_test_resolver(
+    const ElfApiInterface* interface,
+    uint32_t hash,
+    Elf32_Addr* address) {
+    UNUSED(interface);
+    UNUSED(hash);
+    *address = (Elf32_Addr)elf_image_cache_test_import;
+    return true;
+}
+
+static const ElfApiInterface elf_image_cache_test_api = {
+    .api_version_major = 1,
+    .api_version_minor = 0,
+    .resolver_callback = elf_image_cache_test_resolver,
+};
+
+static ElfImageCacheTestLoad elf_image_cache_test_load(Storage* storage, uint32_t api_key) {
+    ElfImageCacheTestLoad result = ElfImageCacheTestLoadFailed;
+    ELFFile* elf = elf_file_alloc(storage, &elf_image_cache_test_api);
+
+    if(elf_file_open(elf, ELF_IMAGE_CACHE_TEST_FILE)) {
+        elf_file_set_image_cache(elf, ELF_IMAGE_CACHE_TEST_IMAGE, api_key);
+
+        if(elf_file_load_section_table(elf) == ElfLoadSectionTableResultSuccess) {
+            bool cached = elf->image_cache_loaded;
+            if(elf_file_load_sections(elf) == ELFFileLoadStatusSuccess) {
+                result = cached ? ElfImageCacheTestLoadCached : ElfImageCacheTestLoadFresh;
+            }
+        }
+    }
+
+    elf_file_free(elf);
+    return result;
+}
+
+static bool elf_image_cache_test_copy(Storage* storage) {
+    storage_simply_remove(storage, ELF_IMAGE_CACHE_TEST_FILE);
+    return storage_common_copy(storage, ELF_IMAGE_CACHE_TEST_SOURCE, ELF_IMAGE_CACHE_TEST_FILE) ==
+           FSE_OK;
+}
+
+MU_TEST(elf_image_cache_hit_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    mu_check(elf_image_cache_test_copy(storage));
+
+    mu_assert_int_eq(
+        ElfImageCacheTestLoadFresh,
+        elf_image_cache_test_load(storage, ELF_IMAGE_CACHE_TEST_API_KEY));
+    mu_check(storage_file_exists(storage, ELF_IMAGE_CACHE_TEST_IMAGE));
+    mu_assert_int_eq(
+        ElfImageCacheTestLoadCached,
+        elf_image_cache_test_load(storage, ELF_IMAGE_CACHE_TEST_API_KEY));
+    mu_assert_int_eq(
+        ElfImageCacheTestLoadCached,
+        elf_image_cache_test_load(storage, ELF_IMAGE_CACHE_TEST_API_KEY));
+
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(elf_image_cache_stale_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    mu_check(elf_image_cache_test_copy(storage));
+    mu_assert_int_eq(
+        ElfImageCacheTestLoadFresh,
+        elf_image_cache_test_load(storage, ELF_IMAGE_CACHE_TEST_API_KEY));
+
+    // Same contents and size written again, only the modification time differs.
+    // FAT keeps it with a two second resolution.
+    furi_delay_ms(2500);
+    mu_check(elf_image_cache_test_copy(storage));
+    mu_assert_int_eq(
+        ElfImageCacheTestLoadFresh,
+        elf_image_cache_test_load(storage, ELF_IMAGE_CACHE_TEST_API_KEY));
+    mu_assert_int_eq(
+        ElfImageCacheTestLoadCached,
+        elf_image_cache_test_load(storage, ELF_IMAGE_CACHE_TEST_API_KEY));
+
+    // Size changes, trailing data doesn't affect loading
+    File* file = storage_file_alloc(storage);
+    mu_check(storage_file_open(file, ELF_IMAGE_CACHE_TEST_FILE, FSAM_WRITE, FSOM_OPEN_APPEND));
+    mu_assert_int_eq(1, storage_file_write(file, "\0", 1));
+    storage_file_close(file);
+    storage_file_free(file);
+
+    mu_assert_int_eq(
+        ElfImageCacheTestLoadFresh,
+        elf_image_cache_test_load(storage, ELF_IMAGE_CACHE_TEST_API_KEY));
+    mu_assert_int_eq(
+        ElfImageCacheTestLoadCached,
+        elf_image_cache_test_load(storage, ELF_IMAGE_CACHE_TEST_API_KEY));
+
+    // Broken image is dropped and written again
+    file = storage_file_alloc(storage);
+    mu_check(
+        storage_file_open(file, ELF_IMAGE_CACHE_TEST_IMAGE, FSAM_WRITE, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(4, storage_file_write(file, "13DA", 4));
+    storage_file_close(file);
+    storage_file_free(file);
+
+    mu_assert_int_eq(
+        ElfImageCacheTestLoadFresh,
+        elf_image_cache_test_load(storage, ELF_IMAGE_CACHE_TEST_API_KEY));
+    mu_assert_int_eq(
+        ElfImageCacheTestLoadCached,
+        elf_image_cache_test_load(storage, ELF_IMAGE_CACHE_TEST_API_KEY));
+
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(elf_image_cache_api_key_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    mu_check(elf_image_cache_test_copy(storage));
+    mu_assert_int_eq(
+        ElfImageCacheTestLoadFresh,
+        elf_image_cache_test_load(storage, ELF_IMAGE_CACHE_TEST_API_KEY));
+
+    // Addresses resolved against another API table can't be reused
+    mu_assert_int_eq(
+        ElfImageCacheTestLoadFresh,
+        elf_image_cache_test_load(storage, ELF_IMAGE_CACHE_TEST_OTHER_API_KEY));
+    mu_assert_int_eq(
+        ElfImageCacheTestLoadCached,
+        elf_image_cache_test_load(storage, ELF_IMAGE_CACHE_TEST_OTHER_API_KEY));
+    mu_assert_int_eq(
+        ElfImageCacheTestLoadFresh,
+        elf_image_cache_test_load(storage, ELF_IMAGE_CACHE_TEST_API_KEY));
+
+    furi_record_close(RECORD_STORAGE);
+}
+
+static void elf_image_cache_test_setup(void) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove_recursive(storage, ELF_IMAGE_CACHE_TEST_DIR);
+    storage_simply_mkdir(storage, ELF_IMAGE_CACHE_TEST_DIR);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static void elf_image_cache_test_teardown(void) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove_recursive(storage, ELF_IMAGE_CACHE_TEST_DIR);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST_SUITE(test_elf_image_cache_suite) {
+    MU_SUITE_CONFIGURE(&elf_image_cache_test_setup, &elf_image_cache_test_teardown);
+
+    MU_RUN_TEST(elf_image_cache_hit_test);
+    MU_RUN_TEST(elf_image_cache_stale_test);
+    MU_RUN_TEST(elf_image_cache_api_key_test);
+}
+
+int run_minunit_test_elf_image_cache(void) {
+    MU_RUN_SUITE(test_elf_image_cache_suite);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_elf_image_cache)
@@ -9,6 +9,10 @@
 
 #define EVENT_LOOP_EVENT_COUNT (256u)
 
+#define EVENT_LOOP_TIMER_COUNT        (1024u)
+#define EVENT_LOOP_TIMER_ROUNDS       (4u)
+#define EVENT_LOOP_TIMER_INTERVAL_MAX (256u)
+
 typedef struct {
     FuriMessageQueue* mq;
 
@@ -19,6 +23,24 @@ typedef struct {
     uint32_t consumer_counter;
 } TestFuriData;
 
+typedef struct TestFuriTimerData TestFuriTimerData;
+
+typedef struct {
+    TestFuriTimerData* data;
+    FuriEventLoopTimer* timer;
+    uint32_t deadline;
+    uint32_t fired;
+} TestFuriTimer;
+
+struct TestFuriTimerData {
+    FuriEventLoop* event_loop;
+    TestFuriTimer* timers;
+    uint32_t round;
+    uint32_t pending;
+    uint32_t early;
+    uint32_t latency_max;
+};
+
 bool test_furi_event_loop_producer_mq_callback(FuriEventLoopObject* object, void* context) {
     furi_check(context);
 
@@ -203,3 +225,87 @@ void test_furi_event_loop(void) {
     furi_thread_free(producer_thread);
     furi_message_queue_free(data.mq);
 }
+
+static void test_furi_event_loop_timer_round_start(TestFuriTimerData* data) {
+    data->pending = 0;
+
+    for(size_t i = 0; i < EVENT_LOOP_TIMER_COUNT; i++) {
+        TestFuriTimer* timer = &data->timers[i];
+        const uint32_t interval = 1 + furi_hal_random_get() % EVENT_LOOP_TIMER_INTERVAL_MAX;
+
+        timer->deadline = furi_get_tick() + interval;
+        furi_event_loop_timer_start(timer->timer, interval);
+
+        // Cancel every 4th timer right away, it must never fire
+        if(i % 4 == 0) {
+            furi_event_loop_timer_stop(timer->timer);
+        } else {
+            data->pending++;
+        }
+    }
+}
+
+static void test_furi_event_loop_timer_callback(void* context) {
+    TestFuriTimer* timer = context;
+    TestFuriTimerData* data = timer->data;
+
+    const int32_t latency = (int32_t)(furi_get_tick() - timer->deadline);
+    if(latency < 0) {
+        data->early++;
+    } else if((uint32_t)latency > data->latency_max) {
+        data->latency_max = latency;
+    }
+
+    timer->fired++;
+
+    if(--data->pending == 0) {
+        if(++data->round == EVENT_LOOP_TIMER_ROUNDS) {
+            furi_event_loop_stop(data->event_loop);
+        } else {
+            test_furi_event_loop_timer_round_start(data);
+        }
+    }
+}
+
+void test_furi_event_loop_timer_stress(void) {
+    TestFuriTimerData data = {};
+
+    data.event_loop = furi_event_loop_alloc();
+    data.timers = malloc(sizeof(TestFuriTimer) * EVENT_LOOP_TIMER_COUNT);
+
+    for(size_t i = 0; i < EVENT_LOOP_TIMER_COUNT; i++) {
+        data.timers[i].data = &data;
+        data.timers[i].timer = furi_event_loop_timer_alloc(
+            data.event_loop,
+            test_furi_event_loop_timer_callback,
+            FuriEventLoopTimerTypeOnce,
+            &data.timers[i]);
+    }
+
+    const uint32_t start = furi_get_tick();
+    test_furi_event_loop_timer_round_start(&data);
+    furi_event_loop_run(data.event_loop);
+    const uint32_t elapsed = furi_get_tick() - start;
+
+    FURI_LOG_I(
+        TAG,
+        "%u timers x %u rounds: %lums, max latency %lu ticks",
+        EVENT_LOOP_TIMER_COUNT,
+        EVENT_LOOP_TIMER_ROUNDS,
+        elapsed,
+        data.latency_max);
+
+    uint32_t wrong_count = 0;
+    for(size_t i = 0; i < EVENT_LOOP_TIMER_COUNT; i++) {
+        const uint32_t expected = (i % 4 == 0) ? 0 : EVENT_LOOP_TIMER_ROUNDS;
+        if(data.timers[i].fired != expected) wrong_count++;
+        furi_event_loop_timer_free(data.timers[i].timer);
+    }
+
+    furi_event_loop_free(data.event_loop);
+    free(data.timers);
+
+    mu_assert_int_eq(0, data.early);
+    mu_assert_int_eq(0, wrong_count);
+    mu_assert_int_eq(EVENT_LOOP_TIMER_ROUNDS, data.round);
+}
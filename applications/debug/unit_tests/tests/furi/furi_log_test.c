@@ -0,0 +1,104 @@
+#include <stdio.h>
+#include <string.h>
+#include <furi.h>
+#include "../test.h" // IWYU pragma: keep
+
+#define TAG "LogTest"
+
+#define LOG_TEST_BUFFER_SIZE 2048
+#define LOG_TEST_TIMEOUT_MS  1000
+
+static void test_furi_log_tx_callback(const uint8_t* data, size_t size, void* context) {
+    furi_stream_buffer_send(context, data, size, 0);
+}
+
+// Other threads keep logging during the test, look for the expected bytes in the stream
+static bool test_furi_log_receive(
+    FuriStreamBuffer* stream,
+    uint8_t* buffer,
+    const void* expected,
+    size_t expected_size) {
+    size_t size = 0;
+    uint32_t start = furi_get_tick();
+
+    while(furi_get_tick() - start < furi_ms_to_ticks(LOG_TEST_TIMEOUT_MS)) {
+        if(size == LOG_TEST_BUFFER_SIZE) {
+            // Keep the tail in case the match spans the boundary
+            memmove(buffer, &buffer[size - expected_size], expected_size);
+            size = expected_size;
+        }
+        size += furi_stream_buffer_receive(stream, &buffer[size], LOG_TEST_BUFFER_SIZE - size, 10);
+
+        for(size_t i = 0; i + expected_size <= size; i++) {
+            if(memcmp(&buffer[i], expected, expected_size) == 0) return true;
+        }
+    }
+
+    return false;
+}
+
+void test_furi_log_deferred(void) {
+    FuriStreamBuffer* stream = furi_stream_buffer_alloc(LOG_TEST_BUFFER_SIZE, 1);
+    uint8_t* buffer = malloc(LOG_TEST_BUFFER_SIZE);
+    FuriLogHandler handler = {
+        .callback = test_furi_log_tx_callback,
+        .context = stream,
+    };
+
+    FuriLogLevel previous_level = furi_log_get_level();
+    FuriLogMode previous_mode = furi_log_get_mode();
+    furi_log_set_level(FuriLogLevelInfo);
+    mu_assert(furi_log_add_handler(handler), "failed to add log handler");
+
+    // Text is formatted by the log thread, stack strings are copied at the call site,
+    // strings with precision only up to it, so they don't have to be terminated
+    furi_log_set_mode(FuriLogModeDeferred);
+    bool mode_set = furi_log_get_mode() == FuriLogModeDeferred;
+    char stack_string[] = "stack";
+    const char unterminated[] = {'a', 'b', 'c', 'd'};
+    FURI_LOG_I(
+        TAG,
+        "%d %s %lld %*d %.*s %.2s|",
+        -42,
+        stack_string,
+        123456789012LL,
+        4,
+        7,
+        3,
+        unterminated,
+        stack_string);
+    memset(stack_string, 0, sizeof(stack_string));
+
+    const char expected_text[] =
+        "[I][" TAG "] " _FURI_LOG_CLR_RESET "-42 stack 123456789012    7 abc st|";
+    bool text_received =
+        test_furi_log_receive(stream, buffer, expected_text, strlen(expected_text));
+
+    // Plugin strings are outside of the firmware image and are stored inline
+    furi_log_set_mode(FuriLogModeBinary);
+    FURI_LOG_W(TAG, "%lu|", 0xDEADBEEFUL);
+
+    const uint8_t expected_frame[] = {
+        // Tag
+        7, 0, 'L', 'o', 'g', 'T', 'e', 's', 't',
+        // Format
+        4, 0, '%', 'l', 'u', '|',
+        // Argument
+        0xEF, 0xBE, 0xAD, 0xDE,
+    };
+    bool frame_received =
+        test_furi_log_receive(stream, buffer, expected_frame, sizeof(expected_frame));
+
+    // Restore logging before asserting, the handler must not outlive the stream
+    furi_log_set_mode(previous_mode);
+    furi_log_set_level(previous_level);
+    bool handler_removed = furi_log_remove_handler(handler);
+
+    free(buffer);
+    furi_stream_buffer_free(stream);
+
+    mu_assert(mode_set, "log mode not set");
+    mu_assert(text_received, "deferred record not received");
+    mu_assert(frame_received, "binary record not received");
+    mu_assert(handler_removed, "failed to remove log handler");
+}
@@ -1,4 +1,5 @@
 #include "../test.h" // IWYU pragma: keep
+#include <furi.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
@@ -37,3 +38,104 @@ void test_furi_memmgr(void) {
     }
     free(ptr);
 }
+
+#define TEST_MEMMGR_POOL_BLOCKS 64
+
+void test_furi_memmgr_pools(void) {
+    const size_t pool_count = memmgr_heap_get_pool_count();
+    if(!pool_count) {
+        // Firmware is built without pools
+        return;
+    }
+
+    for(size_t i = 0; i < pool_count; i++) {
+        MemmgrHeapPoolStats stats_before, stats_after;
+        memmgr_heap_get_pool_stats(i, &stats_before);
+        const size_t size = stats_before.block_size;
+
+        // Enough blocks to fill more than one slab
+        uint8_t* blocks[TEST_MEMMGR_POOL_BLOCKS];
+        for(size_t j = 0; j < TEST_MEMMGR_POOL_BLOCKS; j++) {
+            blocks[j] = malloc(size);
+            for(size_t k = 0; k < size; k++) {
+                mu_assert_int_eq(0, blocks[j][k]);
+            }
+            memset(blocks[j], j, size);
+        }
+
+        memmgr_heap_get_pool_stats(i, &stats_after);
+        mu_check(stats_after.allocations - stats_before.allocations >= TEST_MEMMGR_POOL_BLOCKS);
+        mu_check(stats_after.slabs >= 1);
+        mu_check(stats_after.blocks_peak >= TEST_MEMMGR_POOL_BLOCKS);
+
+        // Neighbour blocks are not overwritten
+        for(size_t j = 0; j < TEST_MEMMGR_POOL_BLOCKS; j++) {
+            for(size_t k = 0; k < size; k++) {
+                mu_assert_int_eq(j, blocks[j][k]);
+            }
+            free(blocks[j]);
+        }
+    }
+}
+
+#define TEST_MEMMGR_PROFILE_BLOCKS 16
+
+static MemmgrHeapProfileSite* test_furi_memmgr_profile_find(
+    MemmgrHeapProfileSite* sites,
+    size_t count,
+    void* caller) {
+    for(size_t i = 0; i < count; i++) {
+        if(sites[i].caller == caller) {
+            return &sites[i];
+        }
+    }
+    return NULL;
+}
+
+void test_furi_memmgr_profile(void) {
+    MemmgrHeapLayout layout;
+    memmgr_heap_get_layout(&layout);
+    mu_check(layout.free_blocks > 0);
+    mu_check(layout.max_free_block <= layout.free_bytes);
+    mu_check(layout.free_bytes + layout.used_bytes <= memmgr_get_total_heap());
+
+    mu_check(memmgr_heap_profile_start(1));
+
+    // All blocks come from the same call site
+    void* blocks[TEST_MEMMGR_PROFILE_BLOCKS];
+    for(size_t i = 0; i < TEST_MEMMGR_PROFILE_BLOCKS; i++) {
+        blocks[i] = malloc(200);
+    }
+
+    MemmgrHeapProfileSite* sites =
+        malloc(sizeof(MemmgrHeapProfileSite) * MEMMGR_HEAP_PROFILE_SITES);
+    size_t count = memmgr_heap_profile_get_sites(sites, MEMMGR_HEAP_PROFILE_SITES);
+    mu_check(count > 0);
+
+    MemmgrHeapProfileSite* site = NULL;
+    for(size_t i = 0; i < count && !site; i++) {
+        if(sites[i].allocations == TEST_MEMMGR_PROFILE_BLOCKS &&
+           sites[i].live_count == TEST_MEMMGR_PROFILE_BLOCKS &&
+           sites[i].live_bytes >= TEST_MEMMGR_PROFILE_BLOCKS * 200) {
+            site = &sites[i];
+        }
+    }
+    mu_assert(site, "allocation site not found");
+    void* caller = site->caller;
+
+    for(size_t i = 0; i < TEST_MEMMGR_PROFILE_BLOCKS; i++) {
+        free(blocks[i]);
+    }
+
+    count = memmgr_heap_profile_get_sites(sites, MEMMGR_HEAP_PROFILE_SITES);
+    site = test_furi_memmgr_profile_find(sites, count, caller);
+    mu_check(site);
+    mu_assert_int_eq(0, site->live_count);
+    mu_assert_int_eq(0, site->live_bytes);
+
+    free(sites);
+    memmgr_heap_profile_stop();
+
+    MemmgrHeapProfileInfo info;
+    mu_check(!memmgr_heap_profile_get_info(&info));
+}
@@ -0,0 +1,165 @@
+#include <string.h>
+#include <furi.h>
+#include "../test.h" // IWYU pragma: keep
+
+#define TAG "MessageQueueTest"
+
+#define MESSAGE_QUEUE_TEST_COUNT    (16384u)
+#define MESSAGE_QUEUE_TEST_CAPACITY (64u)
+#define MESSAGE_QUEUE_TEST_BATCH    (16u)
+
+#define STREAM_BUFFER_TEST_SIZE   (61u)
+#define STREAM_BUFFER_TEST_ROUNDS (1000u)
+
+typedef struct {
+    FuriMessageQueue* queue;
+    bool batch;
+} MessageQueueTestContext;
+
+static int32_t test_furi_message_queue_producer(void* context) {
+    MessageQueueTestContext* test = context;
+    uint32_t batch[MESSAGE_QUEUE_TEST_BATCH];
+
+    for(uint32_t value = 0; value < MESSAGE_QUEUE_TEST_COUNT;) {
+        if(test->batch) {
+            const uint32_t count = MIN(MESSAGE_QUEUE_TEST_BATCH, MESSAGE_QUEUE_TEST_COUNT - value);
+            for(uint32_t i = 0; i < count; i++) {
+                batch[i] = value + i;
+            }
+            value += furi_message_queue_put_batch(test->queue, batch, count, FuriWaitForever);
+        } else {
+            furi_check(
+                furi_message_queue_put(test->queue, &value, FuriWaitForever) == FuriStatusOk);
+            value++;
+        }
+    }
+
+    return 0;
+}
+
+// Pass messages to a consumer with a higher priority, which preempts the producer on every put
+static uint32_t test_furi_message_queue_run(bool batch, bool* in_order) {
+    MessageQueueTestContext test = {
+        .queue = furi_message_queue_alloc(MESSAGE_QUEUE_TEST_CAPACITY, sizeof(uint32_t)),
+        .batch = batch,
+    };
+
+    FuriThread* producer =
+        furi_thread_alloc_ex("MqProducer", 1024, test_furi_message_queue_producer, &test);
+    furi_thread_set_priority(producer, FuriThreadPriorityLow);
+
+    uint32_t received[MESSAGE_QUEUE_TEST_BATCH];
+    uint32_t expected = 0;
+    *in_order = true;
+
+    const uint32_t start = furi_get_tick();
+    furi_thread_start(producer);
+
+    while(expected < MESSAGE_QUEUE_TEST_COUNT) {
+        uint32_t count = 1;
+        if(batch) {
+            count = furi_message_queue_get_batch(
+                test.queue, received, MESSAGE_QUEUE_TEST_BATCH, FuriWaitForever);
+        } else {
+            furi_check(
+                furi_message_queue_get(test.queue, received, FuriWaitForever) == FuriStatusOk);
+        }
+
+        for(uint32_t i = 0; i < count; i++) {
+            if(received[i] != expected++) *in_order = false;
+        }
+    }
+
+    const uint32_t elapsed = furi_get_tick() - start;
+
+    furi_thread_join(producer);
+    furi_thread_free(producer);
+    furi_message_queue_free(test.queue);
+
+    return elapsed;
+}
+
+void test_furi_message_queue_batch(void) {
+    bool single_in_order, batch_in_order;
+
+    FuriThreadPriority priority = furi_thread_get_current_priority();
+    furi_thread_set_current_priority(FuriThreadPriorityHigh);
+
+    const uint32_t single_elapsed = test_furi_message_queue_run(false, &single_in_order);
+    const uint32_t batch_elapsed = test_furi_message_queue_run(true, &batch_in_order);
+
+    furi_thread_set_current_priority(priority);
+
+    FURI_LOG_I(
+        TAG,
+        "%u messages: %lums one by one, %lums in batches of %u",
+        MESSAGE_QUEUE_TEST_COUNT,
+        single_elapsed,
+        batch_elapsed,
+        MESSAGE_QUEUE_TEST_BATCH);
+
+    mu_assert(single_in_order, "messages put one by one are out of order");
+    mu_assert(batch_in_order, "messages put in batches are out of order");
+
+    // Batches are limited by the queue space and the received message count
+    FuriMessageQueue* queue = furi_message_queue_alloc(4, sizeof(uint32_t));
+    const uint32_t values[] = {1, 2, 3, 4, 5, 6};
+    uint32_t received[6] = {};
+
+    mu_assert_int_eq(4, furi_message_queue_put_batch(queue, values, COUNT_OF(values), 0));
+    mu_assert_int_eq(0, furi_message_queue_put_batch(queue, &values[4], 2, 1));
+    mu_assert_int_eq(3, furi_message_queue_get_batch(queue, received, 3, 0));
+    mu_assert_int_eq(1, furi_message_queue_get_batch(queue, &received[3], 3, 0));
+    mu_assert_int_eq(0, furi_message_queue_get_batch(queue, received, 3, 1));
+    mu_assert_mem_eq(values, received, sizeof(uint32_t) * 4);
+
+    furi_message_queue_free(queue);
+}
+
+void test_furi_stream_buffer_reserve(void) {
+    FuriStreamBuffer* stream = furi_stream_buffer_alloc(STREAM_BUFFER_TEST_SIZE, 1);
+    uint8_t sent = 0;
+    uint8_t expected = 0;
+    bool in_order = true;
+
+    // Sizes that do not divide the buffer size make regions wrap at every position
+    for(size_t round = 0; round < STREAM_BUFFER_TEST_ROUNDS; round++) {
+        size_t length = round % 17 + 1;
+        uint8_t* region = furi_stream_buffer_send_reserve(stream, &length);
+        for(size_t i = 0; i < length; i++) {
+            region[i] = sent++;
+        }
+        furi_stream_buffer_send_commit(stream, length);
+
+        length = round % 13 + 1;
+        const uint8_t* data = furi_stream_buffer_receive_acquire(stream, &length);
+        for(size_t i = 0; i < length; i++) {
+            if(data[i] != expected++) in_order = false;
+        }
+        furi_stream_buffer_receive_release(stream, length);
+    }
+
+    // Whatever is left must be readable with the regular API
+    uint8_t rest[STREAM_BUFFER_TEST_SIZE];
+    const size_t rest_size = furi_stream_buffer_receive(stream, rest, sizeof(rest), 0);
+    for(size_t i = 0; i < rest_size; i++) {
+        if(rest[i] != expected++) in_order = false;
+    }
+
+    // Regular sends and the reserved space add up to the buffer size
+    mu_assert_int_eq(10, furi_stream_buffer_send(stream, rest, 10, 0));
+    size_t space = 0;
+    size_t length;
+    do {
+        length = STREAM_BUFFER_TEST_SIZE;
+        furi_stream_buffer_send_reserve(stream, &length);
+        furi_stream_buffer_send_commit(stream, length);
+        space += length;
+    } while(length);
+
+    furi_stream_buffer_free(stream);
+
+    mu_assert(in_order, "stream data is out of order");
+    mu_assert_int_eq(sent, expected);
+    mu_assert_int_eq(STREAM_BUFFER_TEST_SIZE - 10, space);
+}
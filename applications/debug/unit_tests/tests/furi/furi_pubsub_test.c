@@ -40,6 +40,111 @@ void test_furi_pubsub(void) {
     furi_pubsub_publish(test_pubsub, (void*)&notify_value_1);
     mu_assert_int_not_eq(pubsub_value, notify_value_1);
 
+    // subscribe to a single event case
+    test_pubsub_subscription = furi_pubsub_subscribe_mask(
+        test_pubsub, 1UL << 1, test_pubsub_handler, (void*)&context_value);
+    mu_assert_pointers_not_eq(test_pubsub_subscription, NULL);
+
+    /// notify other event case
+    furi_pubsub_publish_event(test_pubsub, (void*)&notify_value_1, 1UL << 0);
+    mu_assert_int_not_eq(pubsub_value, notify_value_1);
+
+    /// notify matching event case
+    furi_pubsub_publish_event(test_pubsub, (void*)&notify_value_1, (1UL << 0) | (1UL << 1));
+    mu_assert_int_eq(pubsub_value, notify_value_1);
+
+    /// notify all events case
+    furi_pubsub_publish(test_pubsub, (void*)&notify_value_0);
+    mu_assert_int_eq(pubsub_value, notify_value_0);
+
+    furi_pubsub_unsubscribe(test_pubsub, test_pubsub_subscription);
+
     // delete pubsub case
     furi_pubsub_free(test_pubsub);
 }
+
+#define PUBSUB_DEFERRED_COUNT      3
+#define PUBSUB_DEFERRED_TIMEOUT_MS 1000
+
+typedef struct {
+    FuriPubSub* pubsub;
+    FuriEventLoop* event_loop;
+    uint32_t values[PUBSUB_DEFERRED_COUNT];
+    size_t count;
+    FuriThreadId thread_id;
+    bool other_thread;
+} TestPubSubDeferred;
+
+static void test_pubsub_deferred_handler(const void* arg, void* ctx) {
+    TestPubSubDeferred* data = ctx;
+
+    data->other_thread |= furi_thread_get_current_id() != data->thread_id;
+    if(data->count < PUBSUB_DEFERRED_COUNT) {
+        data->values[data->count] = *(const uint32_t*)arg;
+    }
+
+    if(++data->count == PUBSUB_DEFERRED_COUNT) {
+        furi_event_loop_stop(data->event_loop);
+    }
+}
+
+static void test_pubsub_deferred_timeout(void* ctx) {
+    TestPubSubDeferred* data = ctx;
+    furi_event_loop_stop(data->event_loop);
+}
+
+static int32_t test_pubsub_deferred_publisher(void* ctx) {
+    TestPubSubDeferred* data = ctx;
+
+    for(uint32_t i = 0; i < PUBSUB_DEFERRED_COUNT; i++) {
+        uint32_t value = notify_value_0 + i;
+        furi_pubsub_publish_event(data->pubsub, &value, 1UL << 0);
+        // Not subscribed, must not take a place in the queue
+        furi_pubsub_publish_event(data->pubsub, &value, 1UL << 1);
+    }
+
+    return 0;
+}
+
+void test_furi_pubsub_event_loop(void) {
+    TestPubSubDeferred data = {
+        .pubsub = furi_pubsub_alloc(),
+        .event_loop = furi_event_loop_alloc(),
+        .thread_id = furi_thread_get_current_id(),
+    };
+
+    FuriPubSubSubscription* subscription = furi_pubsub_subscribe_event_loop(
+        data.pubsub,
+        data.event_loop,
+        1UL << 0,
+        sizeof(uint32_t),
+        PUBSUB_DEFERRED_COUNT,
+        test_pubsub_deferred_handler,
+        &data);
+    mu_assert_pointers_not_eq(subscription, NULL);
+
+    // Messages are queued while the owner thread is busy
+    FuriThread* publisher =
+        furi_thread_alloc_ex("PubSubPublisher", 1024, test_pubsub_deferred_publisher, &data);
+    furi_thread_start(publisher);
+    furi_thread_join(publisher);
+    furi_thread_free(publisher);
+    mu_assert_int_eq(0, data.count);
+
+    // And delivered in order once it runs its event loop
+    FuriEventLoopTimer* timer = furi_event_loop_timer_alloc(
+        data.event_loop, test_pubsub_deferred_timeout, FuriEventLoopTimerTypeOnce, &data);
+    furi_event_loop_timer_start(timer, furi_ms_to_ticks(PUBSUB_DEFERRED_TIMEOUT_MS));
+    furi_event_loop_run(data.event_loop);
+    furi_event_loop_timer_free(timer);
+
+    furi_pubsub_unsubscribe(data.pubsub, subscription);
+    furi_event_loop_free(data.event_loop);
+    furi_pubsub_free(data.pubsub);
+
+    mu_assert_int_eq(PUBSUB_DEFERRED_COUNT, data.count);
+    mu_check(!data.other_thread);
+    for(uint32_t i = 0; i < PUBSUB_DEFERRED_COUNT; i++) {
+        mu_assert_int_eq(notify_value_0 + i, data.values[i]);
+    }
+}
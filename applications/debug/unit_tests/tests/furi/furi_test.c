@@ -6,8 +6,16 @@
 void test_furi_create_open(void);
 void test_furi_concurrent_access(void);
 void test_furi_pubsub(void);
+void test_furi_pubsub_event_loop(void);
 void test_furi_memmgr(void);
+void test_furi_memmgr_pools(void);
+void test_furi_memmgr_profile(void);
 void test_furi_event_loop(void);
+void test_furi_event_loop_timer_stress(void);
+void test_furi_log_deferred(void);
+void test_furi_message_queue_batch(void);
+void test_furi_stream_buffer_reserve(void);
+void test_furi_thread_telemetry(void);
 void test_errno_saving(void);
 
 static int foo = 0;
@@ -33,16 +41,48 @@ MU_TEST(mu_test_furi_pubsub) {
     test_furi_pubsub();
 }
 
+MU_TEST(mu_test_furi_pubsub_event_loop) {
+    test_furi_pubsub_event_loop();
+}
+
 MU_TEST(mu_test_furi_memmgr) {
     // this test is not accurate, but gives a basic understanding
     // that memory management is working fine
     test_furi_memmgr();
 }
 
+MU_TEST(mu_test_furi_memmgr_pools) {
+    test_furi_memmgr_pools();
+}
+
+MU_TEST(mu_test_furi_memmgr_profile) {
+    test_furi_memmgr_profile();
+}
+
 MU_TEST(mu_test_furi_event_loop) {
     test_furi_event_loop();
 }
 
+MU_TEST(mu_test_furi_event_loop_timer_stress) {
+    test_furi_event_loop_timer_stress();
+}
+
+MU_TEST(mu_test_furi_log_deferred) {
+    test_furi_log_deferred();
+}
+
+MU_TEST(mu_test_furi_message_queue_batch) {
+    test_furi_message_queue_batch();
+}
+
+MU_TEST(mu_test_furi_stream_buffer_reserve) {
+    test_furi_stream_buffer_reserve();
+}
+
+MU_TEST(mu_test_furi_thread_telemetry) {
+    test_furi_thread_telemetry();
+}
+
 MU_TEST(mu_test_errno_saving) {
     test_errno_saving();
 }
@@ -54,8 +94,16 @@ MU_TEST_SUITE(test_suite) {
     // v2 tests
     MU_RUN_TEST(mu_test_furi_create_open);
     MU_RUN_TEST(mu_test_furi_pubsub);
+    MU_RUN_TEST(mu_test_furi_pubsub_event_loop);
     MU_RUN_TEST(mu_test_furi_memmgr);
+    MU_RUN_TEST(mu_test_furi_memmgr_pools);
+    MU_RUN_TEST(mu_test_furi_memmgr_profile);
     MU_RUN_TEST(mu_test_furi_event_loop);
+    MU_RUN_TEST(mu_test_furi_event_loop_timer_stress);
+    MU_RUN_TEST(mu_test_furi_log_deferred);
+    MU_RUN_TEST(mu_test_furi_message_queue_batch);
+    MU_RUN_TEST(mu_test_furi_stream_buffer_reserve);
+    MU_RUN_TEST(mu_test_furi_thread_telemetry);
     MU_RUN_TEST(mu_test_errno_saving);
 }
 
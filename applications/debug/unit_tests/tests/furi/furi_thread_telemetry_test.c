@@ -0,0 +1,100 @@
+#include <furi.h>
+#include "../test.h" // IWYU pragma: keep
+
+#define TEST_TELEMETRY_PERIOD (20U)
+#define TEST_TELEMETRY_WAKES  (10U)
+
+#define TEST_TELEMETRY_FLAG_WAKE (1U << 0)
+#define TEST_TELEMETRY_FLAG_EXIT (1U << 1)
+
+static int32_t test_furi_thread_telemetry_busy(void* context) {
+    volatile bool* exit = context;
+    while(!*exit) {
+        // Spin to keep the CPU busy
+    }
+    return 0;
+}
+
+static int32_t test_furi_thread_telemetry_sleeper(void* context) {
+    UNUSED(context);
+    while(!(furi_thread_flags_wait(
+                TEST_TELEMETRY_FLAG_WAKE | TEST_TELEMETRY_FLAG_EXIT,
+                FuriFlagWaitAny,
+                FuriWaitForever) &
+            TEST_TELEMETRY_FLAG_EXIT)) {
+        // Wake up and go back to sleep
+    }
+    return 0;
+}
+
+static bool
+    test_furi_thread_telemetry_find(FuriThread* thread, FuriThreadTelemetryThread* result) {
+    for(size_t i = 0; i < FURI_THREAD_TELEMETRY_THREADS; i++) {
+        if(furi_thread_telemetry_get_thread(i, result) &&
+           result->thread_id == furi_thread_get_id(thread)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void test_furi_thread_telemetry(void) {
+    mu_check(furi_thread_telemetry_start(TEST_TELEMETRY_PERIOD));
+
+    volatile bool exit = false;
+    FuriThread* busy =
+        furi_thread_alloc_ex("TelemetryBusy", 512, test_furi_thread_telemetry_busy, (void*)&exit);
+    furi_thread_set_priority(busy, FuriThreadPriorityLow);
+    FuriThread* sleeper =
+        furi_thread_alloc_ex("TelemetrySleeper", 512, test_furi_thread_telemetry_sleeper, NULL);
+    furi_thread_start(busy);
+    furi_thread_start(sleeper);
+
+    for(size_t i = 0; i < TEST_TELEMETRY_WAKES; i++) {
+        furi_thread_flags_set(furi_thread_get_id(sleeper), TEST_TELEMETRY_FLAG_WAKE);
+        furi_delay_ms(TEST_TELEMETRY_PERIOD);
+    }
+
+    FuriThreadTelemetryInfo info = {0};
+    mu_check(furi_thread_telemetry_get_info(&info));
+    mu_assert_int_eq(TEST_TELEMETRY_PERIOD, info.period);
+    mu_check(info.samples > 2);
+
+    FuriThreadTelemetryThread* thread = malloc(sizeof(FuriThreadTelemetryThread));
+
+    // Busy thread takes most of the CPU time, other threads are mostly idle
+    mu_assert(test_furi_thread_telemetry_find(busy, thread), "busy thread not tracked");
+    mu_assert_string_eq("TelemetryBusy", thread->name);
+    mu_check(thread->count > 0);
+    mu_check(thread->first + thread->count == info.samples);
+    uint16_t cpu_peak = 0;
+    for(size_t i = 0; i < thread->count; i++) {
+        cpu_peak = MAX(cpu_peak, thread->history[i].cpu);
+        mu_check(thread->history[i].stack_min_free > 0);
+        mu_check(thread->history[i].stack_min_free < 512);
+    }
+    mu_assert(cpu_peak > 5000, "busy thread CPU time is too low");
+
+    // Every wake up is a context switch
+    mu_assert(test_furi_thread_telemetry_find(sleeper, thread), "sleeper thread not tracked");
+    uint32_t switches = 0;
+    for(size_t i = 0; i < thread->count; i++) {
+        switches += thread->history[i].switches;
+    }
+    mu_check(switches > 0);
+
+    exit = true;
+    furi_thread_flags_set(furi_thread_get_id(sleeper), TEST_TELEMETRY_FLAG_EXIT);
+    furi_thread_join(busy);
+    furi_thread_join(sleeper);
+
+    // Exited threads release their slots
+    mu_check(!test_furi_thread_telemetry_find(busy, thread));
+
+    furi_thread_free(busy);
+    furi_thread_free(sleeper);
+    free(thread);
+
+    furi_thread_telemetry_stop();
+    mu_check(!furi_thread_telemetry_get_info(&info));
+}
@@ -0,0 +1,132 @@
+#include <furi.h>
+#include <mjs_core_public.h>
+#include <mjs_exec_public.h>
+#include <mjs_object_public.h>
+#include <mjs_primitive_public.h>
+
+#include "../test.h" // IWYU pragma: keep
+
+#define TAG "JsTest"
+
+#define JS_TEST_PROPERTY_COUNT  (24u)
+#define JS_TEST_BENCHMARK_LOOPS "2000"
+
+static void js_test_method(struct mjs* mjs) {
+    mjs_return(mjs, mjs_mk_number(mjs, 1));
+}
+
+// Module-like object: methods are set from C before the script runs
+static const char* const js_test_module_methods[] = {
+    "setup",    "write",         "read",         "readln",   "readBytes",
+    "readAny",  "expect",        "end",          "isConnected", "getButton",
+    "addLine",  "setText",       "setFocus",     "drawString", "drawFrame",
+    "setColor", "commitChanges", "waitForInput", "clearScreen", "layoutVertical",
+};
+
+static struct mjs* js_test_create(void) {
+    struct mjs* mjs = mjs_create(NULL);
+    mjs_val_t module = mjs_mk_object(mjs);
+    for(size_t i = 0; i < COUNT_OF(js_test_module_methods); i++) {
+        mjs_set(mjs, module, js_test_module_methods[i], ~0, MJS_MK_FN(js_test_method));
+    }
+    mjs_set(mjs, mjs_get_global(mjs), "serial", ~0, module);
+    return mjs;
+}
+
+static mjs_err_t
+    js_test_exec(struct mjs* mjs, const char* script, double* result, uint32_t* elapsed) {
+    mjs_val_t value = MJS_UNDEFINED;
+    const uint32_t start = furi_get_tick();
+    const mjs_err_t err = mjs_exec(mjs, script, &value);
+    if(elapsed) *elapsed = furi_get_tick() - start;
+
+    *result = mjs_get_double(mjs, value);
+    return err;
+}
+
+MU_TEST(js_test_property_lookup) {
+    struct mjs* mjs = js_test_create();
+
+    // Objects past the hash threshold, arrays and iteration
+    const char* script = "let cfg = {baudrate: 9600, parity: 0, stopBits: 1, dataBits: 8,"
+                         " timeout: 100, flowControl: 0, rxBuffer: 256, txBuffer: 128,"
+                         " lineEnding: 10, retries: 3};"
+                         "cfg.retries = cfg.retries + 1;"
+                         "cfg.extraField = 5;"
+                         "let arr = [];"
+                         "for (let i = 0; i < 50; i++) { arr.push(i); }"
+                         "let total = 0;"
+                         "for (let key in cfg) { total = total + cfg[key]; }"
+                         "total + arr[49] + arr.length + serial.readBytes() + serial.setup()"
+                         " + (cfg.missingField === undefined ? 1 : 0);";
+    double result;
+    mu_assert_int_eq(MJS_OK, js_test_exec(mjs, script, &result, NULL));
+    mu_assert_double_eq(10112 + 49 + 50 + 1 + 1 + 1, result);
+
+    mjs_destroy(mjs);
+}
+
+MU_TEST(js_test_property_delete) {
+    struct mjs* mjs = js_test_create();
+    mjs_val_t object = mjs_mk_object(mjs);
+    char name[16];
+
+    for(size_t i = 0; i < JS_TEST_PROPERTY_COUNT; i++) {
+        snprintf(name, sizeof(name), "property_%zu", i);
+        mjs_set(mjs, object, name, ~0, mjs_mk_number(mjs, i));
+    }
+
+    // Deleting drops properties from the hash index too
+    for(size_t i = 0; i < JS_TEST_PROPERTY_COUNT; i += 2) {
+        snprintf(name, sizeof(name), "property_%zu", i);
+        mu_assert_int_eq(0, mjs_del(mjs, object, name, ~0));
+    }
+
+    for(size_t i = 0; i < JS_TEST_PROPERTY_COUNT; i++) {
+        snprintf(name, sizeof(name), "property_%zu", i);
+        mjs_val_t value = mjs_get(mjs, object, name, ~0);
+        if(i % 2) {
+            mu_assert_double_eq(i, mjs_get_double(mjs, value));
+        } else {
+            mu_assert(mjs_is_undefined(value), "deleted property is still there");
+        }
+    }
+
+    mjs_destroy(mjs);
+}
+
+MU_TEST(js_test_property_benchmark) {
+    struct mjs* mjs = js_test_create();
+    uint32_t elapsed = 0;
+
+    const char* script = "let cfg = {baudrate: 9600, parity: 0, stopBits: 1, dataBits: 8,"
+                         " timeout: 100, flowControl: 0, rxBuffer: 256, txBuffer: 128,"
+                         " lineEnding: 10, retries: 3};"
+                         "let sum = 0;"
+                         "for (let i = 0; i < " JS_TEST_BENCHMARK_LOOPS "; i++) {"
+                         " serial.setup(cfg.baudrate); serial.write(cfg.dataBits);"
+                         " serial.readBytes(cfg.rxBuffer); serial.layoutVertical(cfg.lineEnding);"
+                         " sum = sum + cfg.timeout + cfg.stopBits;"
+                         "}"
+                         "sum;";
+    double result;
+    mu_assert_int_eq(MJS_OK, js_test_exec(mjs, script, &result, &elapsed));
+    mu_assert_double_eq(101 * 2000, result);
+
+    FURI_LOG_I(TAG, "%s loops with property lookups: %lums", JS_TEST_BENCHMARK_LOOPS, elapsed);
+
+    mjs_destroy(mjs);
+}
+
+MU_TEST_SUITE(test_js_suite) {
+    MU_RUN_TEST(js_test_property_lookup);
+    MU_RUN_TEST(js_test_property_delete);
+    MU_RUN_TEST(js_test_property_benchmark);
+}
+
+int run_minunit_test_js(void) {
+    MU_RUN_SUITE(test_js_suite);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_js)
@@ -9,6 +9,8 @@
 #include <storage/filesystem_api_defines.h>
 
 #include <lib/toolbox/api_lock.h>
+#include <lib/toolbox/compress.h>
+#include <lib/toolbox/dir_walk.h>
 #include <lib/toolbox/md5_calc.h>
 #include <lib/toolbox/path.h>
 
@@ -896,6 +898,109 @@ static void test_create_file(const char* path, size_t size) {
     furi_check(test_is_exists(path));
 }
 
+static void test_rpc_storage_manifest_create_expected_list(
+    MsgList_t msg_list,
+    const char* root,
+    uint32_t command_id,
+    bool append_md5) {
+    Storage* fs_api = furi_record_open(RECORD_STORAGE);
+    DirWalk* dir_walk = dir_walk_alloc(fs_api);
+    File* file = storage_file_alloc(fs_api);
+    FuriString* path = furi_string_alloc();
+    FuriString* md5 = furi_string_alloc();
+
+    PB_Main response = {
+        .command_id = command_id,
+        .command_status = PB_CommandStatus_OK,
+        .has_next = false,
+        .which_content = PB_Main_storage_list_response_tag,
+    };
+    PB_Storage_ListResponse* list = &response.content.storage_list_response;
+    size_t i = 0;
+
+    furi_check(dir_walk_open(dir_walk, root));
+
+    FileInfo fileinfo;
+    while(dir_walk_read(dir_walk, path, &fileinfo) == DirWalkOK) {
+        if(i == COUNT_OF(list->file)) {
+            list->file_count = i;
+            response.has_next = true;
+            MsgList_push_back(msg_list, response);
+            memset(list, 0, sizeof(PB_Storage_ListResponse));
+            i = 0;
+        }
+
+        PB_Storage_File* entry = &list->file[i++];
+        bool is_dir = file_info_is_dir(&fileinfo);
+        entry->type = is_dir ? PB_Storage_File_FileType_DIR : PB_Storage_File_FileType_FILE;
+        entry->size = fileinfo.size;
+        /* memory free inside rpc_encode_and_send() -> pb_release() */
+        entry->name = strdup(furi_string_get_cstr(path) + strlen(root) + 1);
+        entry->data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(sizeof(uint32_t)));
+        entry->data->size = sizeof(uint32_t);
+        memcpy(entry->data->bytes, &fileinfo.mtime, sizeof(uint32_t));
+
+        if(append_md5 && !is_dir &&
+           md5_string_calc_file(file, furi_string_get_cstr(path), md5, NULL)) {
+            snprintf(entry->md5sum, sizeof(entry->md5sum), "%s", furi_string_get_cstr(md5));
+        }
+    }
+
+    list->file_count = i;
+    response.has_next = false;
+    MsgList_push_back(msg_list, response);
+
+    furi_string_free(md5);
+    furi_string_free(path);
+    storage_file_free(file);
+    dir_walk_close(dir_walk);
+    dir_walk_free(dir_walk);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static void test_rpc_storage_manifest_run(const char* root, uint32_t command_id, bool md5) {
+    PB_Main request;
+    MsgList_t expected_msg_list;
+    MsgList_init(expected_msg_list);
+
+    FuriString* path = furi_string_alloc_printf("%s|manifest", root);
+    test_rpc_create_storage_list_request(
+        &request, furi_string_get_cstr(path), md5, command_id, 0);
+    if(test_is_exists(root)) {
+        test_rpc_storage_manifest_create_expected_list(expected_msg_list, root, command_id, md5);
+    } else {
+        test_rpc_add_empty_to_list(
+            expected_msg_list, PB_CommandStatus_ERROR_STORAGE_NOT_EXIST, command_id);
+    }
+    test_rpc_encode_and_feed_one(&request, 0);
+    test_rpc_decode_and_compare(expected_msg_list, 0);
+
+    furi_string_free(path);
+    pb_release(&PB_Main_msg, &request);
+    test_rpc_free_msg_list(expected_msg_list);
+}
+
+MU_TEST(test_storage_manifest) {
+    // Enough entries to span several responses
+    test_create_dir(TEST_DIR "manifest");
+    test_create_dir(TEST_DIR "manifest/sub");
+    test_create_dir(TEST_DIR "manifest/sub/deeper");
+    test_create_file(TEST_DIR "manifest/sub/deeper/empty.txt", 0);
+    FuriString* path = furi_string_alloc();
+    for(size_t i = 0; i < 12; ++i) {
+        furi_string_printf(path, TEST_DIR "manifest/file%zu.txt", i);
+        test_create_file(furi_string_get_cstr(path), i * 100);
+        furi_string_printf(path, TEST_DIR "manifest/sub/file%zu.txt", i);
+        test_create_file(furi_string_get_cstr(path), i);
+    }
+    furi_string_free(path);
+
+    test_rpc_storage_manifest_run(TEST_DIR "manifest", ++command_id, false);
+    test_rpc_storage_manifest_run(TEST_DIR "manifest", ++command_id, true);
+    test_rpc_storage_manifest_run(TEST_DIR "manifest/sub/deeper", ++command_id, true);
+    test_rpc_storage_manifest_run(TEST_DIR "manifest/none", ++command_id, false);
+}
+
 static void test_rpc_storage_info_run(const char* path, uint32_t command_id) {
     PB_Main request;
     MsgList_t expected_msg_list;
@@ -1093,6 +1198,157 @@ MU_TEST(test_storage_write) {
     test_storage_write_run(TEST_DIR "test2.txt", 512, 3, ++command_id, PB_CommandStatus_OK);
 }
 
+#define THROUGHPUT_FILE_SIZE (64 * 1024)
+
+static void test_storage_throughput_log(const char* operation, uint32_t ticks) {
+    uint32_t ms = MAX(ticks * 1000 / furi_kernel_get_tick_frequency(), 1UL);
+    FURI_LOG_I(
+        TAG,
+        "%s %d bytes: %lu ms, %lu bytes/s",
+        operation,
+        THROUGHPUT_FILE_SIZE,
+        ms,
+        THROUGHPUT_FILE_SIZE * 1000UL / ms);
+}
+
+MU_TEST(test_storage_throughput) {
+    MsgList_t input_msg_list;
+    MsgList_init(input_msg_list);
+    MsgList_t expected_msg_list;
+    MsgList_init(expected_msg_list);
+
+    uint8_t* pattern = malloc(MAX_DATA_SIZE);
+    for(size_t i = 0; i < MAX_DATA_SIZE; ++i) {
+        pattern[i] = i;
+    }
+
+    // Client uploads the file in a chain of write requests
+    test_rpc_add_read_or_write_to_list(
+        input_msg_list,
+        WRITE_REQUEST,
+        TEST_DIR "throughput.bin",
+        pattern,
+        MAX_DATA_SIZE,
+        THROUGHPUT_FILE_SIZE / MAX_DATA_SIZE,
+        ++command_id);
+    test_rpc_add_empty_to_list(expected_msg_list, PB_CommandStatus_OK, command_id);
+
+    uint32_t start = furi_get_tick();
+    test_rpc_encode_and_feed(input_msg_list, 0);
+    test_rpc_decode_and_compare(expected_msg_list, 0);
+    test_storage_throughput_log("Write", furi_get_tick() - start);
+
+    test_rpc_free_msg_list(input_msg_list);
+    test_rpc_free_msg_list(expected_msg_list);
+    MsgList_init(expected_msg_list);
+
+    // And downloads it back as a chain of read responses
+    test_rpc_add_read_or_write_to_list(
+        expected_msg_list,
+        READ_RESPONSE,
+        TEST_DIR "throughput.bin",
+        pattern,
+        MAX_DATA_SIZE,
+        THROUGHPUT_FILE_SIZE / MAX_DATA_SIZE,
+        ++command_id);
+
+    PB_Main request;
+    test_rpc_create_simple_message(
+        &request, PB_Main_storage_read_request_tag, TEST_DIR "throughput.bin", command_id);
+
+    start = furi_get_tick();
+    test_rpc_encode_and_feed_one(&request, 0);
+    test_rpc_decode_and_compare(expected_msg_list, 0);
+    test_storage_throughput_log("Read", furi_get_tick() - start);
+
+    pb_release(&PB_Main_msg, &request);
+    test_rpc_free_msg_list(expected_msg_list);
+    free(pattern);
+}
+
+MU_TEST(test_storage_compressed) {
+    MsgList_t input_msg_list;
+    MsgList_init(input_msg_list);
+    MsgList_t expected_msg_list;
+    MsgList_init(expected_msg_list);
+
+    uint8_t* pattern = malloc(MAX_DATA_SIZE);
+    for(size_t i = 0; i < MAX_DATA_SIZE; ++i) {
+        pattern[i] = '0' + (i % 10);
+    }
+
+    // Every chunk is compressed separately, so equal chunks have equal encoding
+    Compress* compress =
+        compress_alloc(CompressTypeHeatshrink, &compress_config_heatshrink_default);
+    uint8_t* encoded = malloc(MAX_DATA_SIZE + 1);
+    size_t encoded_size = 0;
+    mu_check(compress_encode(
+        compress, pattern, MAX_DATA_SIZE, encoded, MAX_DATA_SIZE + 1, &encoded_size));
+    mu_check(encoded_size < MAX_DATA_SIZE);
+
+    test_rpc_add_read_or_write_to_list(
+        input_msg_list,
+        WRITE_REQUEST,
+        TEST_DIR "compressed.txt|heatshrink",
+        encoded,
+        encoded_size,
+        4,
+        ++command_id);
+    test_rpc_add_empty_to_list(expected_msg_list, PB_CommandStatus_OK, command_id);
+
+    // File is stored decompressed
+    test_rpc_create_simple_message(
+        MsgList_push_raw(input_msg_list),
+        PB_Main_storage_read_request_tag,
+        TEST_DIR "compressed.txt",
+        ++command_id);
+    test_rpc_add_read_or_write_to_list(
+        expected_msg_list, READ_RESPONSE, NULL, pattern, MAX_DATA_SIZE, 4, command_id);
+
+    test_rpc_create_simple_message(
+        MsgList_push_raw(input_msg_list),
+        PB_Main_storage_read_request_tag,
+        TEST_DIR "compressed.txt|heatshrink",
+        ++command_id);
+    test_rpc_add_read_or_write_to_list(
+        expected_msg_list, READ_RESPONSE, NULL, encoded, encoded_size, 4, command_id);
+
+    // Empty file is a single chunk with a bare header
+    test_create_file(TEST_DIR "compressed_empty.txt", 0);
+    mu_check(compress_encode(compress, pattern, 0, encoded, MAX_DATA_SIZE + 1, &encoded_size));
+    mu_assert_int_eq(1, encoded_size);
+
+    test_rpc_create_simple_message(
+        MsgList_push_raw(input_msg_list),
+        PB_Main_storage_read_request_tag,
+        TEST_DIR "compressed_empty.txt|heatshrink",
+        ++command_id);
+    test_rpc_add_read_or_write_to_list(
+        expected_msg_list, READ_RESPONSE, NULL, encoded, encoded_size, 1, command_id);
+
+    // Malformed chunk
+    uint8_t malformed[] = {1, 0, 0xFF, 0x00};
+    test_rpc_add_read_or_write_to_list(
+        input_msg_list,
+        WRITE_REQUEST,
+        TEST_DIR "compressed.txt|heatshrink",
+        malformed,
+        sizeof(malformed),
+        1,
+        ++command_id);
+    test_rpc_add_empty_to_list(
+        expected_msg_list, PB_CommandStatus_ERROR_STORAGE_INVALID_PARAMETER, command_id);
+
+    test_rpc_encode_and_feed(input_msg_list, 0);
+    test_rpc_decode_and_compare(expected_msg_list, 0);
+
+    test_rpc_free_msg_list(input_msg_list);
+    test_rpc_free_msg_list(expected_msg_list);
+    compress_free(compress);
+    free(encoded);
+    free(pattern);
+}
+
 MU_TEST(test_storage_interrupt_continuous_same_system) {
     MsgList_t input_msg_list;
     MsgList_init(input_msg_list);
@@ -1377,6 +1633,34 @@ MU_TEST(test_storage_md5sum) {
     test_storage_md5sum_run(TEST_DIR "file2.txt", ++command_id, md5sum2, PB_CommandStatus_OK);
 }
 
+MU_TEST(test_storage_md5sum_cache) {
+    char md5sum1[MD5SUM_SIZE * 2 + 1] = {0};
+    char md5sum2[MD5SUM_SIZE * 2 + 1] = {0};
+
+    // Checksums are remembered by path, size and modification time. Recently modified files
+    // are not cached, so let the new files age past the timestamp resolution first.
+    test_create_file(TEST_DIR "file1.txt", 512);
+    test_create_file(TEST_DIR "file2.txt", 512);
+    furi_delay_ms(2500);
+    test_storage_calculate_md5sum(TEST_DIR "file1.txt", md5sum1, MD5SUM_SIZE * 2 + 1);
+    test_storage_md5sum_run(TEST_DIR "file1.txt", ++command_id, md5sum1, PB_CommandStatus_OK);
+    test_create_file(TEST_DIR "file2.txt", 256);
+    test_storage_md5sum_run(TEST_DIR "file1.txt", ++command_id, md5sum1, PB_CommandStatus_OK);
+
+    // Same size, different content, newer timestamp
+    Storage* fs_api = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(fs_api);
+    mu_check(storage_file_open(file, TEST_DIR "file1.txt", FSAM_WRITE, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(4, storage_file_write(file, "abcd", 4));
+    storage_file_close(file);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    test_storage_calculate_md5sum(TEST_DIR "file1.txt", md5sum2, MD5SUM_SIZE * 2 + 1);
+    mu_check(strcmp(md5sum1, md5sum2) != 0);
+    test_storage_md5sum_run(TEST_DIR "file1.txt", ++command_id, md5sum2, PB_CommandStatus_OK);
+}
+
 static void test_rpc_storage_rename_run(
     const char* old_path,
     const char* new_path,
@@ -1453,6 +1737,34 @@ MU_TEST(test_ping) {
     test_rpc_free_msg_list(expected_msg_list);
 }
 
+MU_TEST(test_rpc_session_stats) {
+    MsgList_t input_msg_list;
+    MsgList_init(input_msg_list);
+    MsgList_t expected_msg_list;
+    MsgList_init(expected_msg_list);
+
+    RpcSessionStats stats_before;
+    rpc_session_get_stats(rpc_session[0].session, &stats_before);
+
+    for(uint32_t i = 0; i < 10; ++i) {
+        test_rpc_add_ping_to_list(input_msg_list, PING_REQUEST, i);
+        test_rpc_add_ping_to_list(expected_msg_list, PING_RESPONSE, i);
+    }
+
+    test_rpc_encode_and_feed(input_msg_list, 0);
+    test_rpc_decode_and_compare(expected_msg_list, 0);
+
+    RpcSessionStats stats_after;
+    rpc_session_get_stats(rpc_session[0].session, &stats_after);
+
+    mu_assert_int_eq(10, stats_after.tx_messages - stats_before.tx_messages);
+    mu_check(stats_after.tx_bytes - stats_before.tx_bytes >= 10 * 2);
+    mu_assert_int_eq(stats_before.tx_oversized, stats_after.tx_oversized);
+
+    test_rpc_free_msg_list(input_msg_list);
+    test_rpc_free_msg_list(expected_msg_list);
+}
+
 MU_TEST(test_system_protobuf_version) {
     MsgList_t expected_msg_list;
     MsgList_init(expected_msg_list);
@@ -1479,10 +1791,292 @@ MU_TEST(test_system_protobuf_version) {
     test_rpc_free_msg_list(expected_msg_list);
 }
 
+// Have to be exact as in rpc_gui.c
+#define GUI_FRAME_WIDTH          128u
+#define GUI_FRAME_HEIGHT         64u
+#define GUI_FRAME_SIZE           (GUI_FRAME_WIDTH * GUI_FRAME_HEIGHT / 8)
+#define GUI_STREAM_PAGE_SIZE     128u
+#define GUI_STREAM_MODE_FULL     0
+#define GUI_STREAM_MODE_DELTA    1
+#define GUI_STREAM_FRAME_KEY     0
+#define GUI_STREAM_FRAME_PAGES   1
+#define GUI_STREAM_FRAME_XOR_RLE 2
+
+typedef struct {
+    uint8_t framebuffer[GUI_FRAME_SIZE];
+    bool delta;
+    uint32_t frame_types;
+    bool xor_rle_split;
+} TestRpcGuiStream;
+
+// XBM rows to display framebuffer layout: 8 row pages, a byte per column
+static void test_rpc_gui_xbm_to_framebuffer(const uint8_t* xbm, uint8_t* framebuffer) {
+    memset(framebuffer, 0, GUI_FRAME_SIZE);
+    for(size_t y = 0; y < GUI_FRAME_HEIGHT; y++) {
+        for(size_t x = 0; x < GUI_FRAME_WIDTH; x++) {
+            if(xbm[y * GUI_FRAME_WIDTH / 8 + x / 8] & (1 << (x % 8))) {
+                framebuffer[(y / 8) * GUI_FRAME_WIDTH + x] |= 1 << (y % 8);
+            }
+        }
+    }
+}
+
+static void test_rpc_gui_stream_apply(TestRpcGuiStream* stream, const pb_bytes_array_t* data) {
+    mu_check(data);
+
+    if(!stream->delta) {
+        mu_assert_int_eq(GUI_FRAME_SIZE, data->size);
+        memcpy(stream->framebuffer, data->bytes, GUI_FRAME_SIZE);
+        return;
+    }
+
+    mu_check(data->size > 1);
+    const uint8_t type = data->bytes[0];
+    const uint8_t* payload = &data->bytes[1];
+    const size_t payload_size = data->size - 1;
+    stream->frame_types |= 1UL << type;
+
+    if(type == GUI_STREAM_FRAME_KEY) {
+        mu_assert_int_eq(GUI_FRAME_SIZE, payload_size);
+        memcpy(stream->framebuffer, payload, GUI_FRAME_SIZE);
+    } else if(type == GUI_STREAM_FRAME_PAGES) {
+        // 8 pages fit into a single mask byte
+        const uint8_t mask = payload[0];
+        size_t offset = 1;
+        for(size_t page = 0; page < GUI_FRAME_SIZE / GUI_STREAM_PAGE_SIZE; page++) {
+            if(mask & (1 << page)) {
+                mu_check(offset + GUI_STREAM_PAGE_SIZE <= payload_size);
+                memcpy(
+                    &stream->framebuffer[page * GUI_STREAM_PAGE_SIZE],
+                    &payload[offset],
+                    GUI_STREAM_PAGE_SIZE);
+                offset += GUI_STREAM_PAGE_SIZE;
+            }
+        }
+        mu_assert_int_eq(payload_size, offset);
+    } else if(type == GUI_STREAM_FRAME_XOR_RLE) {
+        size_t position = 0;
+        size_t changed_previous = 0;
+        for(size_t i = 0; i < payload_size;) {
+            mu_check(i + 2 <= payload_size);
+            const size_t unchanged = payload[i++];
+            const size_t changed = payload[i++];
+            // Longer runs continue in a triplet without unchanged bytes
+            if(changed_previous == UINT8_MAX && unchanged == 0) {
+                stream->xor_rle_split = true;
+            }
+            position += unchanged;
+            mu_check(position + changed <= GUI_FRAME_SIZE);
+            mu_check(i + changed <= payload_size);
+            for(size_t j = 0; j < changed; j++) {
+                stream->framebuffer[position++] ^= payload[i++];
+            }
+            changed_previous = changed;
+        }
+    } else {
+        mu_fail("unknown screen stream frame type");
+    }
+}
+
+static bool test_rpc_gui_stream_decode(PB_Main* result) {
+    pb_istream_t istream = {
+        .callback = test_rpc_pb_stream_read,
+        .state = &rpc_session[0],
+        .errmsg = NULL,
+        .bytes_left = 0x7FFFFFFF,
+    };
+
+    return pb_decode_ex(&istream, &PB_Main_msg, result, PB_DECODE_DELIMITED);
+}
+
+// Applies screen frames until the response to command_id
+static void test_rpc_gui_stream_wait_response(
+    TestRpcGuiStream* stream,
+    uint32_t command_id,
+    PB_CommandStatus status) {
+    rpc_session[0].timeout = furi_get_tick() + MAX_RECEIVE_OUTPUT_TIMEOUT;
+    PB_Main result = {.cb_content.funcs.decode = NULL};
+
+    while(true) {
+        if(!test_rpc_gui_stream_decode(&result)) {
+            mu_fail("no response received");
+            return;
+        }
+
+        if(result.which_content == PB_Main_gui_screen_frame_tag) {
+            test_rpc_gui_stream_apply(stream, result.content.gui_screen_frame.data);
+            pb_release(&PB_Main_msg, &result);
+        } else {
+            const uint32_t result_command_id = result.command_id;
+            const PB_CommandStatus result_status = result.command_status;
+            const pb_size_t result_content = result.which_content;
+            pb_release(&PB_Main_msg, &result);
+
+            mu_assert_int_eq(command_id, result_command_id);
+            mu_assert_int_eq(status, result_status);
+            mu_assert_int_eq(PB_Main_empty_tag, result_content);
+            return;
+        }
+    }
+}
+
+// Applies screen frames until the decoded screen matches the XBM image
+static void test_rpc_gui_stream_wait_screen(TestRpcGuiStream* stream, const uint8_t* xbm) {
+    uint8_t* expected = malloc(GUI_FRAME_SIZE);
+    test_rpc_gui_xbm_to_framebuffer(xbm, expected);
+
+    rpc_session[0].timeout = furi_get_tick() + MAX_RECEIVE_OUTPUT_TIMEOUT;
+    PB_Main result = {.cb_content.funcs.decode = NULL};
+
+    bool matches = false;
+    while(!matches && test_rpc_gui_stream_decode(&result)) {
+        if(result.which_content == PB_Main_gui_screen_frame_tag) {
+            test_rpc_gui_stream_apply(stream, result.content.gui_screen_frame.data);
+            matches = !memcmp(stream->framebuffer, expected, GUI_FRAME_SIZE);
+        }
+        pb_release(&PB_Main_msg, &result);
+    }
+
+    free(expected);
+    mu_assert(matches, "screen stream doesn't match virtual display");
+}
+
+static void
+    test_rpc_gui_send_screen_frame(const uint8_t* bytes, size_t size, uint32_t command_id) {
+    PB_Main request;
+    test_rpc_fill_basic_message(&request, PB_Main_gui_screen_frame_tag, command_id);
+    request.content.gui_screen_frame.orientation = PB_Gui_ScreenOrientation_HORIZONTAL;
+    request.content.gui_screen_frame.data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(size));
+    request.content.gui_screen_frame.data->size = size;
+    memcpy(request.content.gui_screen_frame.data->bytes, bytes, size);
+
+    test_rpc_encode_and_feed_one(&request, 0);
+}
+
+MU_TEST(test_gui_screen_stream_delta) {
+    TestRpcGuiStream* stream = malloc(sizeof(TestRpcGuiStream));
+    memset(stream, 0, sizeof(TestRpcGuiStream));
+    uint8_t* xbm = malloc(GUI_FRAME_SIZE);
+    memset(xbm, 0, GUI_FRAME_SIZE);
+    PB_Main request;
+
+    // Mode byte is accepted before streaming, anything else is not
+    const uint8_t mode_delta = GUI_STREAM_MODE_DELTA;
+    const uint8_t mode_full = GUI_STREAM_MODE_FULL;
+    const uint8_t mode_invalid[] = {GUI_STREAM_MODE_DELTA + 1, GUI_STREAM_MODE_DELTA};
+    test_rpc_gui_send_screen_frame(&mode_invalid[0], 1, ++command_id);
+    test_rpc_gui_stream_wait_response(
+        stream, command_id, PB_CommandStatus_ERROR_INVALID_PARAMETERS);
+    test_rpc_gui_send_screen_frame(&mode_invalid[1], 2, ++command_id);
+    test_rpc_gui_stream_wait_response(
+        stream, command_id, PB_CommandStatus_ERROR_INVALID_PARAMETERS);
+    test_rpc_gui_send_screen_frame(&mode_delta, 1, ++command_id);
+    test_rpc_gui_stream_wait_response(stream, command_id, PB_CommandStatus_OK);
+    stream->delta = true;
+
+    // Virtual display gives full control over the streamed screen
+    test_rpc_fill_basic_message(
+        &request, PB_Main_gui_start_virtual_display_request_tag, ++command_id);
+    request.content.gui_start_virtual_display_request.send_input = false;
+    request.content.gui_start_virtual_display_request.has_first_frame = true;
+    request.content.gui_start_virtual_display_request.first_frame.orientation =
+        PB_Gui_ScreenOrientation_HORIZONTAL;
+    request.content.gui_start_virtual_display_request.first_frame.data =
+        malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(GUI_FRAME_SIZE));
+    request.content.gui_start_virtual_display_request.first_frame.data->size = GUI_FRAME_SIZE;
+    memcpy(
+        request.content.gui_start_virtual_display_request.first_frame.data->bytes,
+        xbm,
+        GUI_FRAME_SIZE);
+    test_rpc_encode_and_feed_one(&request, 0);
+    test_rpc_gui_stream_wait_response(stream, command_id, PB_CommandStatus_OK);
+
+    test_rpc_fill_basic_message(
+        &request, PB_Main_gui_start_screen_stream_request_tag, ++command_id);
+    test_rpc_encode_and_feed_one(&request, 0);
+    test_rpc_gui_stream_wait_response(stream, command_id, PB_CommandStatus_OK);
+
+    // Stream starts with a key frame
+    test_rpc_gui_stream_wait_screen(stream, xbm);
+    mu_assert_int_eq(1UL << GUI_STREAM_FRAME_KEY, stream->frame_types);
+
+    // A few changed bytes
+    stream->frame_types = 0;
+    xbm[60 * GUI_FRAME_WIDTH / 8 + 3] = 0x0F;
+    test_rpc_gui_send_screen_frame(xbm, GUI_FRAME_SIZE, ++command_id);
+    test_rpc_gui_stream_wait_screen(stream, xbm);
+    mu_assert_int_eq(1UL << GUI_STREAM_FRAME_XOR_RLE, stream->frame_types);
+
+    // 296 changed bytes in a row: pages 0 and 1, first 40 columns of page 2
+    stream->frame_types = 0;
+    memset(xbm, 0xFF, 16 * GUI_FRAME_WIDTH / 8);
+    for(size_t y = 16; y < 20; y++) {
+        memset(&xbm[y * GUI_FRAME_WIDTH / 8], 0xFF, 40 / 8);
+    }
+    test_rpc_gui_send_screen_frame(xbm, GUI_FRAME_SIZE, ++command_id);
+    test_rpc_gui_stream_wait_screen(stream, xbm);
+    mu_assert_int_eq(1UL << GUI_STREAM_FRAME_XOR_RLE, stream->frame_types);
+    mu_check(stream->xor_rle_split);
+
+    // Every other column of pages 3 and 4, cheaper as whole pages
+    stream->frame_types = 0;
+    for(size_t y = 24; y < 40; y++) {
+        for(size_t x = 0; x < GUI_FRAME_WIDTH / 8; x++) {
+            xbm[y * GUI_FRAME_WIDTH / 8 + x] ^= 0x55;
+        }
+    }
+    test_rpc_gui_send_screen_frame(xbm, GUI_FRAME_SIZE, ++command_id);
+    test_rpc_gui_stream_wait_screen(stream, xbm);
+    mu_assert_int_eq(1UL << GUI_STREAM_FRAME_PAGES, stream->frame_types);
+
+    // Every byte changed
+    stream->frame_types = 0;
+    for(size_t i = 0; i < GUI_FRAME_SIZE; i++) {
+        xbm[i] ^= 0xFF;
+    }
+    test_rpc_gui_send_screen_frame(xbm, GUI_FRAME_SIZE, ++command_id);
+    test_rpc_gui_stream_wait_screen(stream, xbm);
+    mu_assert_int_eq(1UL << GUI_STREAM_FRAME_KEY, stream->frame_types);
+
+    // Mode byte doesn't reach the virtual display, current screen is sent again in full
+    test_rpc_gui_send_screen_frame(&mode_full, 1, ++command_id);
+    test_rpc_gui_stream_wait_response(stream, command_id, PB_CommandStatus_OK);
+    stream->delta = false;
+    memset(stream->framebuffer, 0, GUI_FRAME_SIZE);
+    test_rpc_gui_stream_wait_screen(stream, xbm);
+
+    xbm[0] ^= 0x01;
+    test_rpc_gui_send_screen_frame(xbm, GUI_FRAME_SIZE, ++command_id);
+    test_rpc_gui_stream_wait_screen(stream, xbm);
+
+    // Back to delta, starting with a key frame
+    test_rpc_gui_send_screen_frame(&mode_delta, 1, ++command_id);
+    test_rpc_gui_stream_wait_response(stream, command_id, PB_CommandStatus_OK);
+    stream->delta = true;
+    stream->frame_types = 0;
+    memset(stream->framebuffer, 0, GUI_FRAME_SIZE);
+    test_rpc_gui_stream_wait_screen(stream, xbm);
+    mu_assert_int_eq(1UL << GUI_STREAM_FRAME_KEY, stream->frame_types);
+
+    test_rpc_fill_basic_message(
+        &request, PB_Main_gui_stop_screen_stream_request_tag, ++command_id);
+    test_rpc_encode_and_feed_one(&request, 0);
+    test_rpc_gui_stream_wait_response(stream, command_id, PB_CommandStatus_OK);
+
+    test_rpc_fill_basic_message(
+        &request, PB_Main_gui_stop_virtual_display_request_tag, ++command_id);
+    test_rpc_encode_and_feed_one(&request, 0);
+    test_rpc_gui_stream_wait_response(stream, command_id, PB_CommandStatus_OK);
+
+    free(xbm);
+    free(stream);
+}
+
 MU_TEST_SUITE(test_rpc_system) {
     MU_SUITE_CONFIGURE(&test_rpc_setup, &test_rpc_teardown);
 
     MU_RUN_TEST(test_ping);
+    MU_RUN_TEST(test_rpc_session_stats);
     MU_RUN_TEST(test_system_protobuf_version);
 }
 
@@ -1494,19 +2088,29 @@ MU_TEST_SUITE(test_rpc_storage) {
     MU_RUN_TEST(test_storage_list);
     MU_RUN_TEST(test_storage_list_md5);
     MU_RUN_TEST(test_storage_list_size);
+    MU_RUN_TEST(test_storage_manifest);
     MU_RUN_TEST(test_storage_read);
     MU_RUN_TEST(test_storage_write_read);
     MU_RUN_TEST(test_storage_write);
+    MU_RUN_TEST(test_storage_throughput);
+    MU_RUN_TEST(test_storage_compressed);
     MU_RUN_TEST(test_storage_delete);
     MU_RUN_TEST(test_storage_delete_recursive);
     MU_RUN_TEST(test_storage_mkdir);
     MU_RUN_TEST(test_storage_md5sum);
+    MU_RUN_TEST(test_storage_md5sum_cache);
     MU_RUN_TEST(test_storage_rename);
 
     DISABLE_TEST(MU_RUN_TEST(test_storage_interrupt_continuous_same_system););
     MU_RUN_TEST(test_storage_interrupt_continuous_another_system);
 }
 
+MU_TEST_SUITE(test_rpc_gui) {
+    MU_SUITE_CONFIGURE(&test_rpc_setup, &test_rpc_teardown);
+
+    MU_RUN_TEST(test_gui_screen_stream_delta);
+}
+
 static void test_app_create_request(
     PB_Main* request,
     const char* app_name,
@@ -1846,6 +2450,7 @@ int run_minunit_test_rpc(void) {
     }
     furi_record_close(RECORD_STORAGE);
     MU_RUN_SUITE(test_rpc_system);
+    MU_RUN_SUITE(test_rpc_gui);
     MU_RUN_SUITE(test_rpc_app);
     MU_RUN_SUITE(test_rpc_session);
 
@@ -176,6 +176,121 @@ MU_TEST(storage_file_read_write_64k) {
     furi_record_close(RECORD_STORAGE);
 }
 
+MU_TEST(storage_file_small_chunks) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    const char* filename = UNIT_TESTS_PATH("storage_small_chunks.test");
+    const size_t test_size = 5000;
+    const size_t chunk_size = 7;
+    uint8_t chunk[7];
+
+    // Small writes go through the write-behind buffer, position and size must stay consistent
+    mu_check(storage_file_open(file, filename, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    for(size_t offset = 0; offset < test_size; offset += chunk_size) {
+        for(size_t i = 0; i < chunk_size; i++) {
+            chunk[i] = (offset + i) % 113;
+        }
+        mu_assert_int_eq(chunk_size, storage_file_write(file, chunk, chunk_size));
+        mu_assert_int_eq(offset + chunk_size, storage_file_tell(file));
+        mu_assert_int_eq(offset + chunk_size, storage_file_size(file));
+        mu_check(storage_file_eof(file));
+    }
+    mu_check(storage_file_close(file));
+
+    // Small reads go through the read-ahead buffer, including short seeks back
+    mu_check(storage_file_open(file, filename, FSAM_READ, FSOM_OPEN_EXISTING));
+    size_t file_size = storage_file_size(file);
+    size_t offset = 0;
+    while(offset < file_size) {
+        size_t expected = MIN(chunk_size, file_size - offset);
+        mu_assert_int_eq(expected, storage_file_read(file, chunk, chunk_size));
+        for(size_t i = 0; i < expected; i++) {
+            mu_assert_int_eq((offset + i) % 113, chunk[i]);
+        }
+        offset += expected;
+        mu_assert_int_eq(offset, storage_file_tell(file));
+
+        if(offset % 3 == 0) {
+            mu_check(storage_file_seek(file, offset - 3, true));
+            mu_assert_int_eq(3, storage_file_read(file, chunk, 3));
+            mu_assert_int_eq((offset - 1) % 113, chunk[2]);
+        }
+    }
+    mu_check(storage_file_eof(file));
+    mu_assert_int_eq(0, storage_file_read(file, chunk, chunk_size));
+    mu_check(storage_file_close(file));
+
+    storage_simply_remove(storage, filename);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static void storage_file_mixed_reads_check(File* file, uint8_t* data, size_t offset, size_t size) {
+    mu_assert_int_eq(size, storage_file_read(file, data, size));
+    for(size_t i = 0; i < size; i++) {
+        mu_assert_int_eq((offset + i) % 113, data[i]);
+    }
+    mu_assert_int_eq(offset + size, storage_file_tell(file));
+}
+
+MU_TEST(storage_file_mixed_reads) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    const char* filename = UNIT_TESTS_PATH("storage_mixed_reads.test");
+    const size_t test_size = 5000;
+    const size_t large_size = 1500;
+    uint8_t* data = malloc(test_size);
+
+    for(size_t i = 0; i < test_size; i++) {
+        data[i] = i % 113;
+    }
+    mu_check(storage_file_open(file, filename, FSAM_WRITE, FSOM_CREATE_ALWAYS));
+    mu_assert_int_eq(test_size, storage_file_write(file, data, test_size));
+    mu_check(storage_file_close(file));
+
+    // Large reads bypass the read-ahead buffer, position must not come from its leftovers
+    mu_check(storage_file_open(file, filename, FSAM_READ, FSOM_OPEN_EXISTING));
+    size_t offset = 0;
+    for(size_t i = 0; i < 3; i++) {
+        storage_file_mixed_reads_check(file, data, offset, 7);
+        offset += 7;
+    }
+    storage_file_mixed_reads_check(file, data, offset, large_size);
+    offset += large_size;
+    storage_file_mixed_reads_check(file, data, offset, 7);
+    offset += 7;
+
+    mu_check(storage_file_seek(file, offset - 100, true));
+    storage_file_mixed_reads_check(file, data, offset - 100, 7);
+    offset = offset - 100 + 7;
+
+    mu_check(storage_file_seek(file, 200, false));
+    offset += 200;
+    mu_assert_int_eq(offset, storage_file_tell(file));
+    storage_file_mixed_reads_check(file, data, offset, large_size);
+    offset += large_size;
+
+    mu_check(storage_file_seek(file, 10, true));
+    storage_file_mixed_reads_check(file, data, 10, 7);
+    storage_file_mixed_reads_check(file, data, 17, 1024);
+    mu_assert_int_eq(test_size, storage_file_size(file));
+    mu_check(!storage_file_eof(file));
+
+    mu_check(storage_file_seek(file, test_size - 1000, true));
+    mu_assert_int_eq(1000, storage_file_read(file, data, large_size));
+    for(size_t i = 0; i < 1000; i++) {
+        mu_assert_int_eq((test_size - 1000 + i) % 113, data[i]);
+    }
+    mu_assert_int_eq(test_size, storage_file_tell(file));
+    mu_check(storage_file_eof(file));
+    mu_check(storage_file_close(file));
+
+    free(data);
+    storage_simply_remove(storage, filename);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(storage_file) {
     storage_file_open_lock_setup();
     MU_RUN_TEST(storage_file_open_close);
@@ -185,6 +300,125 @@ MU_TEST_SUITE(storage_file) {
 
 MU_TEST_SUITE(storage_file_64k) {
     MU_RUN_TEST(storage_file_read_write_64k);
+    MU_RUN_TEST(storage_file_small_chunks);
+    MU_RUN_TEST(storage_file_mixed_reads);
+}
+
+#define STORAGE_BATCH_FILE UNIT_TESTS_PATH("storage_batch.test")
+#define STORAGE_BATCH_DATA "batched storage operations"
+
+static void storage_batch_ops_fill(StorageBatchOp* ops, File* file, char* buffer, FileInfo* info) {
+    ops[0] = (StorageBatchOp){
+        .type = StorageBatchOpTypeCommonStat,
+        .path = STORAGE_BATCH_FILE,
+        .fileinfo = info,
+    };
+    ops[1] = (StorageBatchOp){
+        .type = StorageBatchOpTypeFileOpen,
+        .file = file,
+        .path = STORAGE_BATCH_FILE,
+        .access_mode = FSAM_READ,
+        .open_mode = FSOM_OPEN_EXISTING,
+    };
+    ops[2] = (StorageBatchOp){
+        .type = StorageBatchOpTypeFileRead,
+        .file = file,
+        .buffer = buffer,
+        .size = strlen(STORAGE_BATCH_DATA),
+    };
+    ops[3] = (StorageBatchOp){
+        .type = StorageBatchOpTypeFileClose,
+        .file = file,
+    };
+}
+
+static void
+    storage_batch_ops_check(StorageBatchOp* ops, File* file, char* buffer, FileInfo* info) {
+    for(size_t i = 0; i < 4; i++) {
+        mu_assert_int_eq(FSE_OK, ops[i].error);
+    }
+    mu_assert_int_eq(strlen(STORAGE_BATCH_DATA), info->size);
+    mu_assert_int_eq(strlen(STORAGE_BATCH_DATA), ops[2].processed);
+    mu_assert_mem_eq(STORAGE_BATCH_DATA, buffer, strlen(STORAGE_BATCH_DATA));
+    mu_check(!storage_file_is_open(file));
+}
+
+MU_TEST(storage_batch_execute_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    char buffer[sizeof(STORAGE_BATCH_DATA)] = {0};
+    FileInfo info;
+    StorageBatchOp ops[4];
+
+    storage_simply_remove(storage, STORAGE_BATCH_FILE);
+    mu_check(storage_file_create(storage, STORAGE_BATCH_FILE, STORAGE_BATCH_DATA));
+
+    storage_batch_ops_fill(ops, file, buffer, &info);
+    mu_assert_int_eq(COUNT_OF(ops), storage_batch_execute(storage, ops, COUNT_OF(ops), true));
+    storage_batch_ops_check(ops, file, buffer, &info);
+
+    // Processing stops at the first failed operation
+    mu_check(storage_simply_remove(storage, STORAGE_BATCH_FILE));
+    storage_batch_ops_fill(ops, file, buffer, &info);
+    mu_assert_int_eq(1, storage_batch_execute(storage, ops, COUNT_OF(ops), true));
+    mu_assert_int_eq(FSE_NOT_EXIST, ops[0].error);
+
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+typedef struct {
+    FuriEventLoop* event_loop;
+    size_t executed;
+} StorageAsyncTestContext;
+
+static void storage_async_test_callback(
+    StorageBatchOp* ops,
+    size_t ops_count,
+    size_t executed,
+    void* context) {
+    UNUSED(ops);
+    UNUSED(ops_count);
+    StorageAsyncTestContext* test_context = context;
+    test_context->executed = executed;
+    furi_event_loop_stop(test_context->event_loop);
+}
+
+MU_TEST(storage_async_submit_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    char buffer[sizeof(STORAGE_BATCH_DATA)] = {0};
+    FileInfo info;
+    StorageBatchOp ops[4];
+
+    storage_simply_remove(storage, STORAGE_BATCH_FILE);
+    mu_check(storage_file_create(storage, STORAGE_BATCH_FILE, STORAGE_BATCH_DATA));
+
+    StorageAsyncTestContext context = {
+        .event_loop = furi_event_loop_alloc(),
+        .executed = 0,
+    };
+    StorageAsync* async = storage_async_alloc(storage, context.event_loop);
+
+    storage_batch_ops_fill(ops, file, buffer, &info);
+    mu_check(storage_async_submit(
+        async, ops, COUNT_OF(ops), true, storage_async_test_callback, &context));
+    furi_event_loop_run(context.event_loop);
+
+    mu_assert_int_eq(COUNT_OF(ops), context.executed);
+    storage_batch_ops_check(ops, file, buffer, &info);
+
+    storage_async_free(async);
+    furi_event_loop_free(context.event_loop);
+
+    storage_simply_remove(storage, STORAGE_BATCH_FILE);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST_SUITE(storage_batch) {
+    MU_RUN_TEST(storage_batch_execute_test);
+    MU_RUN_TEST(storage_async_submit_test);
 }
 
 MU_TEST(storage_dir_open_close) {
@@ -259,10 +493,71 @@ MU_TEST(storage_dir_exists_test) {
     furi_record_close(RECORD_STORAGE);
 }
 
+static size_t storage_dir_count_entries(Storage* storage, const char* path) {
+    File* dir = storage_file_alloc(storage);
+    size_t count = 0;
+
+    if(storage_dir_open(dir, path)) {
+        while(storage_dir_read(dir, NULL, NULL, 0)) {
+            count++;
+        }
+    }
+
+    storage_dir_close(dir);
+    storage_file_free(dir);
+    return count;
+}
+
+MU_TEST(storage_dir_cache_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FileInfo fileinfo;
+
+    mu_assert_int_eq(FSE_OK, storage_common_mkdir(storage, STORAGE_TEST_DIR));
+
+    // Second listing is served from the cache
+    mu_assert_int_eq(0, storage_dir_count_entries(storage, STORAGE_TEST_DIR));
+    mu_assert_int_eq(0, storage_dir_count_entries(storage, STORAGE_TEST_DIR));
+
+    // Created file shows up in the listing, its size is updated on close
+    File* file = storage_file_alloc(storage);
+    mu_check(storage_file_open(file, STORAGE_TEST_DIR "/file", FSAM_WRITE, FSOM_CREATE_NEW));
+    mu_assert_int_eq(1, storage_dir_count_entries(storage, STORAGE_TEST_DIR));
+    mu_assert_int_eq(4, storage_file_write(file, "data", 4));
+    storage_file_close(file);
+    storage_file_free(file);
+
+    mu_assert_int_eq(1, storage_dir_count_entries(storage, STORAGE_TEST_DIR));
+    mu_assert_int_eq(FSE_OK, storage_common_stat(storage, STORAGE_TEST_DIR "/file", &fileinfo));
+    mu_assert_int_eq(4, fileinfo.size);
+    mu_check(!file_info_is_dir(&fileinfo));
+
+    // Removed file is gone from the listing
+    mu_assert_int_eq(FSE_OK, storage_common_remove(storage, STORAGE_TEST_DIR "/file"));
+    mu_check(!storage_file_exists(storage, STORAGE_TEST_DIR "/file"));
+    mu_assert_int_eq(0, storage_dir_count_entries(storage, STORAGE_TEST_DIR));
+
+    // Directory that failed to open reads nothing and is not recorded
+    File* dir = storage_file_alloc(storage);
+    mu_check(!storage_dir_open(dir, STORAGE_TEST_DIR "/missing"));
+    mu_check(!storage_dir_read(dir, NULL, NULL, 0));
+    storage_dir_close(dir);
+    storage_file_free(dir);
+
+    mu_assert_int_eq(FSE_OK, storage_common_mkdir(storage, STORAGE_TEST_DIR "/missing"));
+    mu_assert_int_eq(1, storage_dir_count_entries(storage, STORAGE_TEST_DIR));
+    mu_assert_int_eq(FSE_OK, storage_common_remove(storage, STORAGE_TEST_DIR "/missing"));
+
+    mu_assert_int_eq(FSE_OK, storage_common_remove(storage, STORAGE_TEST_DIR));
+    mu_check(!storage_dir_exists(storage, STORAGE_TEST_DIR));
+
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(storage_dir) {
     MU_RUN_TEST(storage_dir_open_close);
     MU_RUN_TEST(storage_dir_open_lock);
     MU_RUN_TEST(storage_dir_exists_test);
+    MU_RUN_TEST(storage_dir_cache_test);
 }
 
 static const char* const storage_copy_test_paths[] = {
@@ -754,6 +1049,7 @@ MU_TEST_SUITE(test_md5_calc_suite) {
 int run_minunit_test_storage(void) {
     MU_RUN_SUITE(storage_file);
     MU_RUN_SUITE(storage_file_64k);
+    MU_RUN_SUITE(storage_batch);
     MU_RUN_SUITE(storage_dir);
     MU_RUN_SUITE(storage_rename);
     MU_RUN_SUITE(test_data_path);
@@ -12,6 +12,15 @@
 #include <core/check.h>
 #include <stdint.h>
 
+#define INFRARED_PROGRESS_VIEW_X      (0)
+#define INFRARED_PROGRESS_VIEW_Y      (36)
+#define INFRARED_PROGRESS_VIEW_WIDTH  (63)
+#define INFRARED_PROGRESS_VIEW_HEIGHT (59)
+
+// Progress bar and percentage, the only part that changes while sending
+#define INFRARED_PROGRESS_VIEW_BAR_Y      (INFRARED_PROGRESS_VIEW_Y + 19)
+#define INFRARED_PROGRESS_VIEW_BAR_HEIGHT (24)
+
 struct InfraredProgressView {
     View* view;
     InfraredProgressViewBackCallback back_callback;
@@ -32,7 +41,14 @@ bool infrared_progress_view_increase_progress(InfraredProgressView* progress) {
         ++model->progress;
         result = model->progress < model->progress_total;
     }
-    view_commit_model(progress->view, true);
+    view_commit_model(progress->view, false);
+
+    view_update_area(
+        progress->view,
+        INFRARED_PROGRESS_VIEW_X,
+        INFRARED_PROGRESS_VIEW_BAR_Y,
+        INFRARED_PROGRESS_VIEW_WIDTH,
+        INFRARED_PROGRESS_VIEW_BAR_HEIGHT);
 
     return result;
 }
@@ -40,10 +56,10 @@ bool infrared_progress_view_increase_progress(InfraredProgressView* progress) {
 static void infrared_progress_view_draw_callback(Canvas* canvas, void* _model) {
     InfraredProgressViewModel* model = (InfraredProgressViewModel*)_model;
 
-    uint8_t x = 0;
-    uint8_t y = 36;
-    uint8_t width = 63;
-    uint8_t height = 59;
+    uint8_t x = INFRARED_PROGRESS_VIEW_X;
+    uint8_t y = INFRARED_PROGRESS_VIEW_Y;
+    uint8_t width = INFRARED_PROGRESS_VIEW_WIDTH;
+    uint8_t height = INFRARED_PROGRESS_VIEW_HEIGHT;
 
     elements_bold_rounded_frame(canvas, x, y, width, height);
 
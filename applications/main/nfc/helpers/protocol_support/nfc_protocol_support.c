@@ -634,8 +634,9 @@ static bool
                     nfc_protocol_support_common_widget_callback,
                     instance);
             }
-            // Update TextBox data
-            text_box_set_text(instance->text_box, furi_string_get_cstr(instance->text_box_store));
+            // Update TextBox data, log only grows while emulating
+            text_box_set_text_appended(
+                instance->text_box, furi_string_get_cstr(instance->text_box_store));
             consumed = true;
         } else if(event.event == GuiButtonTypeCenter) {
             if(state == NfcSceneEmulateStateWidget) {
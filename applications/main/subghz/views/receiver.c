@@ -13,6 +13,12 @@
 
 #define SUBGHZ_RAW_THRESHOLD_MIN -90.0f
 
+// RSSI meter area, redrawn alone on every RSSI sample
+#define RSSI_AREA_X      46
+#define RSSI_AREA_Y      52
+#define RSSI_AREA_WIDTH  (128 - RSSI_AREA_X)
+#define RSSI_AREA_HEIGHT 3
+
 typedef struct {
     FuriString* item_str;
     uint8_t type;
@@ -76,7 +82,8 @@ void subghz_receiver_rssi(SubGhzViewReceiver* instance, float rssi) {
                 model->u_rssi = (uint8_t)(rssi - SUBGHZ_RAW_THRESHOLD_MIN);
             }
         },
-        true);
+        false);
+    view_update_area(instance->view, RSSI_AREA_X, RSSI_AREA_Y, RSSI_AREA_WIDTH, RSSI_AREA_HEIGHT);
 }
 
 void subghz_view_receiver_set_lock(SubGhzViewReceiver* subghz_receiver, bool lock) {
@@ -201,9 +208,9 @@ static void subghz_view_receiver_draw_frame(Canvas* canvas, uint16_t idx, bool s
 static void subghz_view_rssi_draw(Canvas* canvas, SubGhzViewReceiverModel* model) {
     for(uint8_t i = 1; i < model->u_rssi; i++) {
         if(i % 5) {
-            canvas_draw_dot(canvas, 46 + i, 52);
-            canvas_draw_dot(canvas, 47 + i, 53);
-            canvas_draw_dot(canvas, 46 + i, 54);
+            canvas_draw_dot(canvas, RSSI_AREA_X + i, RSSI_AREA_Y);
+            canvas_draw_dot(canvas, RSSI_AREA_X + 1 + i, RSSI_AREA_Y + 1);
+            canvas_draw_dot(canvas, RSSI_AREA_X + i, RSSI_AREA_Y + 2);
         }
     }
 }
@@ -10,6 +10,9 @@
 #include <loader/loader.h>
 #include <lib/toolbox/args.h>
 #include <lib/toolbox/strint.h>
+#include <lib/toolbox/heap_info.h>
+#include <lib/toolbox/profiler.h>
+#include <lib/toolbox/thread_info.h>
 
 // Close to ISO, `date +'%Y-%m-%d %H:%M:%S %u'`
 #define CLI_DATE_FORMAT "%.4d-%.2d-%.2d %.2d:%.2d:%.2d %d"
@@ -191,23 +194,47 @@ bool cli_command_log_level_set_from_string(FuriString* level) {
             "<log debug> — debug information including <log info> (may impact system performance)\r\n");
         printf(
             "<log trace> — system traces including <log debug> (may impact system performance)\r\n");
+        printf(
+            "<log [level] deferred> — format records on the log thread, keeps callers timing\r\n");
+        printf("<log [level] binary> — stream binary records for scripts/log_decode.py\r\n");
     }
     return false;
 }
 
+bool cli_command_log_mode_from_string(FuriString* mode, FuriLogMode* log_mode) {
+    if(!furi_string_cmp(mode, "deferred")) {
+        *log_mode = FuriLogModeDeferred;
+    } else if(!furi_string_cmp(mode, "binary")) {
+        *log_mode = FuriLogModeBinary;
+    } else {
+        return false;
+    }
+    return true;
+}
+
 void cli_command_log(Cli* cli, FuriString* args, void* context) {
     UNUSED(context);
     FuriStreamBuffer* ring = furi_stream_buffer_alloc(CLI_COMMAND_LOG_RING_SIZE, 1);
     uint8_t buffer[CLI_COMMAND_LOG_BUFFER_SIZE];
     FuriLogLevel previous_level = furi_log_get_level();
+    FuriLogMode previous_mode = furi_log_get_mode();
+    FuriLogMode log_mode = previous_mode;
     bool restore_log_level = false;
 
-    if(furi_string_size(args) > 0) {
-        if(!cli_command_log_level_set_from_string(args)) {
-            furi_stream_buffer_free(ring);
-            return;
+    FuriString* arg = furi_string_alloc();
+    bool args_valid = true;
+    while(args_valid && args_read_string_and_trim(args, arg)) {
+        if(!cli_command_log_mode_from_string(arg, &log_mode)) {
+            args_valid = cli_command_log_level_set_from_string(arg);
+            restore_log_level = true;
         }
-        restore_log_level = true;
+    }
+    furi_string_free(arg);
+
+    if(!args_valid) {
+        if(restore_log_level) furi_log_set_level(previous_level);
+        furi_stream_buffer_free(ring);
+        return;
     }
 
     const char* current_level;
@@ -219,15 +246,18 @@ void cli_command_log(Cli* cli, FuriString* args, void* context) {
         .context = ring,
     };
 
-    furi_log_add_handler(log_handler);
-
     printf("Use <log ?> to list available log levels\r\n");
     printf("Press CTRL+C to stop...\r\n");
+
+    furi_log_add_handler(log_handler);
+    furi_log_set_mode(log_mode);
+
     while(!cli_cmd_interrupt_received(cli)) {
         size_t ret = furi_stream_buffer_receive(ring, buffer, CLI_COMMAND_LOG_BUFFER_SIZE, 50);
         cli_write(cli, buffer, ret);
     }
 
+    furi_log_set_mode(previous_mode);
     furi_log_remove_handler(log_handler);
 
     if(restore_log_level) {
@@ -462,6 +492,20 @@ void cli_command_free(Cli* cli, FuriString* args, void* context) {
 
     printf("Pool free: %zu\r\n", memmgr_pool_get_free());
     printf("Maximum pool block: %zu\r\n", memmgr_pool_get_max_block());
+
+    for(size_t i = 0; i < memmgr_heap_get_pool_count(); i++) {
+        MemmgrHeapPoolStats stats;
+        memmgr_heap_get_pool_stats(i, &stats);
+        printf(
+            "Heap pool %zu: slabs %zu, used %zu, free %zu, peak %zu, allocs %zu, fallbacks %zu\r\n",
+            stats.block_size,
+            stats.slabs,
+            stats.blocks_used,
+            stats.blocks_free,
+            stats.blocks_peak,
+            stats.allocations,
+            stats.fallbacks);
+    }
 }
 
 void cli_command_free_blocks(Cli* cli, FuriString* args, void* context) {
@@ -472,6 +516,195 @@ void cli_command_free_blocks(Cli* cli, FuriString* args, void* context) {
     memmgr_heap_printf_free_blocks();
 }
 
+#define CLI_COMMAND_HEAP_PROFILE_INTERVAL 8
+
+/** Heap Command
+ *
+ * Arguments:
+ * - profile - print heap layout and allocation profiler statistics
+ * - profile start [interval] - start profiling every interval-th allocation
+ * - profile stop - stop profiling
+ *
+ * Call sites are printed as return addresses, use scripts/heap_profile.py to
+ * symbolize them against the firmware ELF.
+ */
+void cli_command_heap(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(context);
+
+    FuriString* cmd = furi_string_alloc();
+
+    do {
+        if(!args_read_string_and_trim(args, cmd) || furi_string_cmp(cmd, "profile")) {
+            cli_print_usage("heap", "profile [start [interval]|stop]", furi_string_get_cstr(args));
+            break;
+        }
+
+        if(!args_read_string_and_trim(args, cmd)) {
+            heap_info_get(cli_command_info_callback, '.', NULL);
+        } else if(!furi_string_cmp(cmd, "start")) {
+            int interval = CLI_COMMAND_HEAP_PROFILE_INTERVAL;
+            args_read_int_and_trim(args, &interval);
+            if(interval < 1) {
+                printf("Interval must be positive\r\n");
+            } else if(memmgr_heap_profile_start(interval)) {
+                printf("Profiling every %d allocation(s)\r\n", interval);
+            } else {
+                printf("Not enough memory\r\n");
+            }
+        } else if(!furi_string_cmp(cmd, "stop")) {
+            memmgr_heap_profile_stop();
+        } else {
+            cli_print_usage("heap", "profile [start [interval]|stop]", furi_string_get_cstr(cmd));
+        }
+    } while(false);
+
+    furi_string_free(cmd);
+}
+
+/** Trace Command
+ *
+ * Arguments:
+ * - none - print collected zone events
+ * - start [events] - start tracing, keeping the last events per thread
+ * - stop - stop tracing
+ *
+ * Use scripts/trace_export.py to convert the output to a Chrome trace.
+ */
+void cli_command_trace(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(context);
+
+    FuriString* cmd = furi_string_alloc();
+
+    if(!args_read_string_and_trim(args, cmd)) {
+        profiler_trace_get(cli_command_info_callback, '.', NULL);
+    } else if(!furi_string_cmp(cmd, "start")) {
+        int events = PROFILER_TRACE_EVENTS_DEFAULT;
+        args_read_int_and_trim(args, &events);
+        if(events < 1 || (events & (events - 1))) {
+            printf("Events must be a power of 2\r\n");
+        } else if(profiler_trace_start(events)) {
+            printf("Tracing, keeping %d event(s) per thread\r\n", events);
+        } else {
+            printf("Not enough memory\r\n");
+        }
+    } else if(!furi_string_cmp(cmd, "stop")) {
+        profiler_trace_stop();
+    } else {
+        cli_print_usage("trace", "[start [events]|stop]", furi_string_get_cstr(cmd));
+    }
+
+    furi_string_free(cmd);
+}
+
+#define CLI_COMMAND_TELEMETRY_VIEW_SLICE_MS 100
+
+static void cli_command_telemetry_view(Cli* cli) {
+    FuriThreadTelemetryInfo info = {0};
+    if(!furi_thread_telemetry_get_info(&info)) {
+        printf("Telemetry is not running, use `telemetry start [period]`\r\n");
+        return;
+    }
+
+    FuriThreadTelemetryThread* thread = malloc(sizeof(FuriThreadTelemetryThread));
+    // CPU history graph, one character per sample, 12.5% steps
+    const char* levels = " .:-=+*#@";
+
+    bool interrupted = false;
+    while(!interrupted && furi_thread_telemetry_get_info(&info)) {
+        printf("\e[2J\e[0;0f"); // Clear display and return to 0
+        printf(
+            "Telemetry: period %lums, samples %lu, untracked threads %lu\r\n\r\n",
+            info.period,
+            info.samples,
+            info.untracked);
+        printf(
+            "%-20s %6s %6s %8s %9s %9s  %s\r\n",
+            "Name",
+            "CPU",
+            "Peak",
+            "Switches",
+            "Latency",
+            "Stack Min",
+            "CPU History");
+
+        for(size_t i = 0; i < FURI_THREAD_TELEMETRY_THREADS; i++) {
+            if(!furi_thread_telemetry_get_thread(i, thread) || !thread->count) continue;
+
+            const FuriThreadTelemetrySample* last = &thread->history[thread->count - 1];
+            uint16_t cpu_peak = 0;
+            uint16_t latency_max = 0;
+            char graph[FURI_THREAD_TELEMETRY_HISTORY + 1] = {};
+            for(size_t j = 0; j < thread->count; j++) {
+                const FuriThreadTelemetrySample* sample = &thread->history[j];
+                cpu_peak = MAX(cpu_peak, sample->cpu);
+                latency_max = MAX(latency_max, sample->latency_max);
+                graph[j] = levels[MIN(sample->cpu * 8U / 10000U, 8U)];
+            }
+
+            printf(
+                "%-20s %5u%% %5u%% %8u %7uus %9u  %s\r\n",
+                thread->name,
+                (last->cpu + 50) / 100,
+                (cpu_peak + 50) / 100,
+                last->switches,
+                latency_max,
+                last->stack_min_free,
+                graph);
+        }
+
+        // Period can be up to a minute, wait in slices to stay responsive to Ctrl-C
+        const uint32_t start = furi_get_tick();
+        const uint32_t period = furi_ms_to_ticks(info.period);
+        const uint32_t slice = furi_ms_to_ticks(CLI_COMMAND_TELEMETRY_VIEW_SLICE_MS);
+        uint32_t elapsed = 0;
+        while(!interrupted && elapsed < period) {
+            furi_delay_tick(MIN(slice, period - elapsed));
+            interrupted = cli_cmd_interrupt_received(cli);
+            elapsed = furi_get_tick() - start;
+        }
+    }
+
+    free(thread);
+}
+
+/** Telemetry Command
+ *
+ * Arguments:
+ * - none - show per-thread CPU, switches, latency and stack until interrupted
+ * - info - print collected history
+ * - start [period] - start sampling every period milliseconds
+ * - stop - stop sampling
+ */
+void cli_command_telemetry(Cli* cli, FuriString* args, void* context) {
+    UNUSED(context);
+
+    FuriString* cmd = furi_string_alloc();
+
+    if(!args_read_string_and_trim(args, cmd)) {
+        cli_command_telemetry_view(cli);
+    } else if(!furi_string_cmp(cmd, "info")) {
+        thread_info_get(cli_command_info_callback, '.', NULL);
+    } else if(!furi_string_cmp(cmd, "start")) {
+        int period = FURI_THREAD_TELEMETRY_PERIOD_DEFAULT;
+        args_read_int_and_trim(args, &period);
+        if(period < 1 || period > FURI_THREAD_TELEMETRY_PERIOD_MAX) {
+            printf("Period must be 1 to %d milliseconds\r\n", FURI_THREAD_TELEMETRY_PERIOD_MAX);
+        } else if(furi_thread_telemetry_start(period)) {
+            printf("Sampling every %dms\r\n", period);
+        } else {
+            printf("Not enough memory\r\n");
+        }
+    } else if(!furi_string_cmp(cmd, "stop")) {
+        furi_thread_telemetry_stop();
+    } else {
+        cli_print_usage("telemetry", "[info|start [period]|stop]", furi_string_get_cstr(cmd));
+    }
+
+    furi_string_free(cmd);
+}
+
 void cli_command_i2c(Cli* cli, FuriString* args, void* context) {
     UNUSED(cli);
     UNUSED(args);
@@ -510,6 +743,9 @@ void cli_commands_init(Cli* cli) {
     cli_add_command(cli, "top", CliCommandFlagParallelSafe, cli_command_top, NULL);
     cli_add_command(cli, "free", CliCommandFlagParallelSafe, cli_command_free, NULL);
     cli_add_command(cli, "free_blocks", CliCommandFlagParallelSafe, cli_command_free_blocks, NULL);
+    cli_add_command(cli, "heap", CliCommandFlagParallelSafe, cli_command_heap, NULL);
+    cli_add_command(cli, "trace", CliCommandFlagParallelSafe, cli_command_trace, NULL);
+    cli_add_command(cli, "telemetry", CliCommandFlagParallelSafe, cli_command_telemetry, NULL);
 
     cli_add_command(cli, "vibro", CliCommandFlagDefault, cli_command_vibro, NULL);
     cli_add_command(cli, "led", CliCommandFlagDefault, cli_command_led, NULL);
@@ -6,6 +6,9 @@
 #include <stdint.h>
 #include <u8g2_glue.h>
 
+#define CANVAS_DISPLAY_WIDTH  128
+#define CANVAS_DISPLAY_HEIGHT 64
+
 const CanvasFontParameters canvas_font_params[FontTotalNumber] = {
     [FontPrimary] = {.leading_default = 12, .leading_min = 11, .height = 8, .descender = 2},
     [FontSecondary] = {.leading_default = 11, .leading_min = 9, .height = 7, .descender = 2},
@@ -20,11 +23,14 @@ Canvas* canvas_init(void) {
     // Initialize mutex
     canvas->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
 
+    canvas->font = FontTotalNumber;
+
     // Initialize callback array
     CanvasCallbackPairArray_init(canvas->canvas_callback_pair);
 
     // Setup u8g2
     u8g2_Setup_st756x_flipper(&canvas->fb, U8G2_R0, u8x8_hw_spi_stm32, u8g2_gpio_and_delay_stm32);
+    canvas->commit_shadow = malloc(canvas_get_buffer_size(canvas));
     canvas->orientation = CanvasOrientationHorizontal;
     // Initialize display
     u8g2_InitDisplay(&canvas->fb);
@@ -41,6 +47,13 @@ Canvas* canvas_init(void) {
 void canvas_free(Canvas* canvas) {
     furi_check(canvas);
     compress_icon_free(canvas->compress_icon);
+    for(size_t i = 0; i < CANVAS_ICON_CACHE_ENTRIES; i++) {
+        free(canvas->icon_cache.entries[i].bitmap);
+    }
+    for(size_t i = 0; i < FontTotalNumber; i++) {
+        free(canvas->glyph_widths[i]);
+    }
+    free(canvas->commit_shadow);
     CanvasCallbackPairArray_clear(canvas->canvas_callback_pair);
     furi_mutex_free(canvas->mutex);
     free(canvas);
@@ -56,6 +69,86 @@ static void canvas_unlock(Canvas* canvas) {
     furi_check(furi_mutex_release(canvas->mutex) == FuriStatusOk);
 }
 
+static bool canvas_icon_cache_is_firmware_data(const uint8_t* data) {
+    const size_t address = (size_t)data;
+    return address >= furi_hal_flash_get_base() &&
+           address < (size_t)furi_hal_flash_get_free_start_address();
+}
+
+static void canvas_icon_cache_evict(CanvasIconCache* cache, CanvasIconCacheEntry* entry) {
+    cache->size -= entry->size;
+    free(entry->bitmap);
+    memset(entry, 0, sizeof(CanvasIconCacheEntry));
+}
+
+// Take an entry for a frame of given size, evicting least recently used frames
+static CanvasIconCacheEntry* canvas_icon_cache_alloc_entry(CanvasIconCache* cache, size_t size) {
+    CanvasIconCacheEntry* free_entry = NULL;
+    do {
+        CanvasIconCacheEntry* lru_entry = NULL;
+        for(size_t i = 0; i < CANVAS_ICON_CACHE_ENTRIES; i++) {
+            CanvasIconCacheEntry* entry = &cache->entries[i];
+            if(!entry->data) {
+                free_entry = entry;
+            } else if(!lru_entry || entry->last_used - lru_entry->last_used > INT32_MAX) {
+                lru_entry = entry;
+            }
+        }
+
+        if(free_entry && cache->size + size <= CANVAS_ICON_CACHE_SIZE) break;
+        canvas_icon_cache_evict(cache, lru_entry);
+        if(!free_entry) free_entry = lru_entry;
+    } while(cache->size + size > CANVAS_ICON_CACHE_SIZE);
+
+    return free_entry;
+}
+
+static const uint8_t*
+    canvas_icon_decode(Canvas* canvas, const uint8_t* data, size_t width, size_t height) {
+    CanvasIconCache* cache = &canvas->icon_cache;
+    const bool cacheable = canvas_icon_cache_is_firmware_data(data);
+
+    if(cacheable) {
+        for(size_t i = 0; i < CANVAS_ICON_CACHE_ENTRIES; i++) {
+            CanvasIconCacheEntry* entry = &cache->entries[i];
+            if(entry->data == data) {
+                entry->last_used = ++cache->use_counter;
+                cache->hits++;
+                return entry->bitmap;
+            }
+        }
+    }
+
+    uint8_t* bitmap = NULL;
+    compress_icon_decode(canvas->compress_icon, data, &bitmap);
+    // Uncompressed frames are drawn from icon data directly
+    if(bitmap == &data[1]) return bitmap;
+
+    cache->misses++;
+    const size_t size = (width + 7) / 8 * height;
+    // Large frames, like full screen animations, would push out everything else
+    if(cacheable && size <= CANVAS_ICON_CACHE_SIZE / 4) {
+        CanvasIconCacheEntry* entry = canvas_icon_cache_alloc_entry(cache, size);
+        entry->data = data;
+        entry->bitmap = malloc(size);
+        entry->size = size;
+        entry->last_used = ++cache->use_counter;
+        memcpy(entry->bitmap, bitmap, size);
+        cache->size += size;
+    }
+
+    return bitmap;
+}
+
+void canvas_get_icon_cache_stats(const Canvas* canvas, uint32_t* hits, uint32_t* misses) {
+    furi_check(canvas);
+    furi_check(hits);
+    furi_check(misses);
+
+    *hits = canvas->icon_cache.hits;
+    *misses = canvas->icon_cache.misses;
+}
+
 void canvas_reset(Canvas* canvas) {
     furi_check(canvas);
 
@@ -66,9 +159,40 @@ void canvas_reset(Canvas* canvas) {
     canvas_set_font_direction(canvas, CanvasDirectionLeftToRight);
 }
 
+// Send changed tile span of every display page, tile is 8 columns of a page
+static void canvas_commit_changed_pages(Canvas* canvas) {
+    uint8_t* buffer = canvas_get_buffer(canvas);
+    const uint8_t tile_width = u8g2_GetBufferTileWidth(&canvas->fb);
+    const uint8_t tile_height = u8g2_GetBufferTileHeight(&canvas->fb);
+    const size_t page_size = tile_width * 8;
+
+    for(uint8_t page = 0; page < tile_height; page++) {
+        const uint8_t* data = &buffer[page * page_size];
+        uint8_t* shadow = &canvas->commit_shadow[page * page_size];
+
+        size_t first = 0;
+        while(first < page_size && data[first] == shadow[first]) first++;
+        if(first == page_size) continue;
+        size_t last = page_size - 1;
+        while(data[last] == shadow[last]) last--;
+
+        const uint8_t tile_first = first / 8;
+        const uint8_t tile_last = last / 8;
+        u8g2_UpdateDisplayArea(&canvas->fb, tile_first, page, tile_last - tile_first + 1, 1);
+        memcpy(&shadow[tile_first * 8], &data[tile_first * 8], (tile_last - tile_first + 1) * 8);
+    }
+}
+
 void canvas_commit(Canvas* canvas) {
     furi_check(canvas);
-    u8g2_SendBuffer(&canvas->fb);
+
+    if(canvas->commit_shadow_valid) {
+        canvas_commit_changed_pages(canvas);
+    } else {
+        u8g2_SendBuffer(&canvas->fb);
+        memcpy(canvas->commit_shadow, canvas_get_buffer(canvas), canvas_get_buffer_size(canvas));
+        canvas->commit_shadow_valid = true;
+    }
 
     // Iterate over callbacks
     canvas_lock(canvas);
@@ -135,7 +259,20 @@ const CanvasFontParameters* canvas_get_font_params(const Canvas* canvas, Font fo
 
 void canvas_clear(Canvas* canvas) {
     furi_check(canvas);
-    u8g2_ClearBuffer(&canvas->fb);
+    if(canvas->clip) {
+        // Clip window limits the box to the clip area
+        const uint8_t color = canvas->fb.draw_color;
+        u8g2_SetDrawColor(&canvas->fb, ColorWhite);
+        u8g2_DrawBox(
+            &canvas->fb,
+            0,
+            0,
+            u8g2_GetDisplayWidth(&canvas->fb),
+            u8g2_GetDisplayHeight(&canvas->fb));
+        u8g2_SetDrawColor(&canvas->fb, color);
+    } else {
+        u8g2_ClearBuffer(&canvas->fb);
+    }
 }
 
 void canvas_set_color(Canvas* canvas, Color color) {
@@ -166,12 +303,51 @@ void canvas_set_font(Canvas* canvas, Font font) {
     } else {
         furi_crash();
     }
+    canvas->font = font;
 }
 
 void canvas_set_custom_u8g2_font(Canvas* canvas, const uint8_t* font) {
     furi_check(canvas);
     u8g2_SetFontMode(&canvas->fb, 1);
     u8g2_SetFont(&canvas->fb, font);
+    canvas->font = FontTotalNumber;
+}
+
+// Get glyph widths table of current font, NULL for custom fonts
+static const CanvasGlyphWidth* canvas_get_glyph_widths(Canvas* canvas) {
+    if(canvas->font == FontTotalNumber) return NULL;
+
+    CanvasGlyphWidth* glyph_widths = canvas->glyph_widths[canvas->font];
+    if(!glyph_widths) {
+        glyph_widths = malloc(sizeof(CanvasGlyphWidth) * CANVAS_GLYPH_WIDTH_COUNT);
+        for(size_t i = 0; i < CANVAS_GLYPH_WIDTH_COUNT; i++) {
+            const uint16_t encoding = CANVAS_GLYPH_WIDTH_FIRST + i;
+            if(!u8g2_IsGlyph(&canvas->fb, encoding)) {
+                glyph_widths[i].advance = 0;
+                glyph_widths[i].tail = CANVAS_GLYPH_WIDTH_MISSING;
+                continue;
+            }
+            // Same as u8g2 string width calculation does for the last glyph
+            glyph_widths[i].advance = u8g2_GetGlyphWidth(&canvas->fb, encoding);
+            glyph_widths[i].tail = 0;
+            if(canvas->fb.font_decode.glyph_width != 0) {
+                glyph_widths[i].tail = canvas->fb.font_decode.glyph_width +
+                                       canvas->fb.glyph_x_offset - glyph_widths[i].advance;
+            }
+        }
+        canvas->glyph_widths[canvas->font] = glyph_widths;
+    }
+
+    return glyph_widths;
+}
+
+static const CanvasGlyphWidth*
+    canvas_get_glyph_width(const CanvasGlyphWidth* glyph_widths, uint16_t symbol) {
+    if(!glyph_widths || symbol < CANVAS_GLYPH_WIDTH_FIRST ||
+       symbol >= CANVAS_GLYPH_WIDTH_FIRST + CANVAS_GLYPH_WIDTH_COUNT) {
+        return NULL;
+    }
+    return &glyph_widths[symbol - CANVAS_GLYPH_WIDTH_FIRST];
 }
 
 void canvas_draw_str(Canvas* canvas, int32_t x, int32_t y, const char* str) {
@@ -228,11 +404,33 @@ void canvas_draw_str_aligned(
 uint16_t canvas_string_width(Canvas* canvas, const char* str) {
     furi_check(canvas);
     if(!str) return 0;
+
+    const CanvasGlyphWidth* glyph_widths = canvas_get_glyph_widths(canvas);
+    if(glyph_widths) {
+        int32_t width = 0;
+        int8_t tail = 0;
+        const char* symbol = str;
+        for(; *symbol; symbol++) {
+            const CanvasGlyphWidth* glyph =
+                canvas_get_glyph_width(glyph_widths, (uint8_t)*symbol);
+            if(!glyph || glyph->tail == CANVAS_GLYPH_WIDTH_MISSING) break;
+            width += glyph->advance;
+            tail = glyph->tail;
+        }
+        // Strings with UTF-8, control symbols or missing glyphs are left to u8g2
+        if(!*symbol) return width + tail;
+    }
+
     return u8g2_GetUTF8Width(&canvas->fb, str);
 }
 
 size_t canvas_glyph_width(Canvas* canvas, uint16_t symbol) {
     furi_check(canvas);
+
+    const CanvasGlyphWidth* glyph =
+        canvas_get_glyph_width(canvas_get_glyph_widths(canvas), symbol);
+    if(glyph) return glyph->advance;
+
     return u8g2_GetGlyphWidth(&canvas->fb, symbol);
 }
 
@@ -247,8 +445,8 @@ void canvas_draw_bitmap(
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* bitmap_data = NULL;
-    compress_icon_decode(canvas->compress_icon, compressed_bitmap_data, &bitmap_data);
+    const uint8_t* bitmap_data =
+        canvas_icon_decode(canvas, compressed_bitmap_data, width, height);
     canvas_draw_u8g2_bitmap(&canvas->fb, x, y, width, height, bitmap_data, IconRotation0);
 }
 
@@ -262,9 +460,11 @@ void canvas_draw_icon_animation(
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* icon_data = NULL;
-    compress_icon_decode(
-        canvas->compress_icon, icon_animation_get_data(icon_animation), &icon_data);
+    const uint8_t* icon_data = canvas_icon_decode(
+        canvas,
+        icon_animation_get_data(icon_animation),
+        icon_animation_get_width(icon_animation),
+        icon_animation_get_height(icon_animation));
     canvas_draw_u8g2_bitmap(
         &canvas->fb,
         x,
@@ -389,8 +589,8 @@ void canvas_draw_icon_ex(
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* icon_data = NULL;
-    compress_icon_decode(canvas->compress_icon, icon_get_frame_data(icon, 0), &icon_data);
+    const uint8_t* icon_data = canvas_icon_decode(
+        canvas, icon_get_frame_data(icon, 0), icon_get_width(icon), icon_get_height(icon));
     canvas_draw_u8g2_bitmap(
         &canvas->fb, x, y, icon_get_width(icon), icon_get_height(icon), icon_data, rotation);
 }
@@ -401,8 +601,8 @@ void canvas_draw_icon(Canvas* canvas, int32_t x, int32_t y, const Icon* icon) {
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* icon_data = NULL;
-    compress_icon_decode(canvas->compress_icon, icon_get_frame_data(icon, 0), &icon_data);
+    const uint8_t* icon_data = canvas_icon_decode(
+        canvas, icon_get_frame_data(icon, 0), icon_get_width(icon), icon_get_height(icon));
     canvas_draw_u8g2_bitmap(
         &canvas->fb, x, y, icon_get_width(icon), icon_get_height(icon), icon_data, IconRotation0);
 }
@@ -561,6 +761,7 @@ void canvas_set_orientation(Canvas* canvas, CanvasOrientation orientation) {
         if(need_swap) FURI_SWAP(canvas->width, canvas->height);
         u8g2_SetDisplayRotation(&canvas->fb, rotate_cb);
         canvas->orientation = orientation;
+        if(canvas->clip) canvas_set_clip(canvas, &canvas->clip_area);
     }
 }
 
@@ -568,6 +769,72 @@ CanvasOrientation canvas_get_orientation(const Canvas* canvas) {
     return canvas->orientation;
 }
 
+CanvasArea canvas_area_convert(CanvasArea area, CanvasOrientation orientation, bool to_display) {
+    const bool vertical = orientation == CanvasOrientationVertical ||
+                          orientation == CanvasOrientationVerticalFlip;
+    const bool swap = vertical && to_display;
+    area.x1 = MIN(area.x1, swap ? CANVAS_DISPLAY_HEIGHT : CANVAS_DISPLAY_WIDTH);
+    area.y1 = MIN(area.y1, swap ? CANVAS_DISPLAY_WIDTH : CANVAS_DISPLAY_HEIGHT);
+    area.x0 = MIN(area.x0, area.x1);
+    area.y0 = MIN(area.y0, area.y1);
+
+    CanvasArea converted = area;
+    switch(orientation) {
+    case CanvasOrientationHorizontal:
+        break;
+    case CanvasOrientationHorizontalFlip:
+        converted.x0 = CANVAS_DISPLAY_WIDTH - area.x1;
+        converted.x1 = CANVAS_DISPLAY_WIDTH - area.x0;
+        converted.y0 = CANVAS_DISPLAY_HEIGHT - area.y1;
+        converted.y1 = CANVAS_DISPLAY_HEIGHT - area.y0;
+        break;
+    case CanvasOrientationVertical:
+        if(to_display) {
+            converted.x0 = area.y0;
+            converted.x1 = area.y1;
+            converted.y0 = CANVAS_DISPLAY_HEIGHT - area.x1;
+            converted.y1 = CANVAS_DISPLAY_HEIGHT - area.x0;
+        } else {
+            converted.x0 = CANVAS_DISPLAY_HEIGHT - area.y1;
+            converted.x1 = CANVAS_DISPLAY_HEIGHT - area.y0;
+            converted.y0 = area.x0;
+            converted.y1 = area.x1;
+        }
+        break;
+    case CanvasOrientationVerticalFlip:
+        if(to_display) {
+            converted.x0 = CANVAS_DISPLAY_WIDTH - area.y1;
+            converted.x1 = CANVAS_DISPLAY_WIDTH - area.y0;
+            converted.y0 = area.x0;
+            converted.y1 = area.x1;
+        } else {
+            converted.x0 = area.y0;
+            converted.x1 = area.y1;
+            converted.y0 = CANVAS_DISPLAY_WIDTH - area.x1;
+            converted.y1 = CANVAS_DISPLAY_WIDTH - area.x0;
+        }
+        break;
+    default:
+        furi_crash();
+    }
+
+    return converted;
+}
+
+void canvas_set_clip(Canvas* canvas, const CanvasArea* area) {
+    furi_check(canvas);
+
+    if(area) {
+        canvas->clip = true;
+        canvas->clip_area = *area;
+        const CanvasArea clip = canvas_area_convert(*area, canvas->orientation, false);
+        u8g2_SetClipWindow(&canvas->fb, clip.x0, clip.y0, clip.x1, clip.y1);
+    } else {
+        canvas->clip = false;
+        u8g2_SetMaxClipWindow(&canvas->fb);
+    }
+}
+
 void canvas_add_framebuffer_callback(Canvas* canvas, CanvasCommitCallback callback, void* context) {
     furi_check(canvas);
 
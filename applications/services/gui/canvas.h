@@ -91,6 +91,8 @@ typedef struct Canvas Canvas;
 void canvas_reset(Canvas* canvas);
 
 /** Commit canvas. Send buffer to display
+ *
+ * Only the parts of display pages that changed since the last commit are sent.
  *
  * @param      canvas  Canvas instance
  */
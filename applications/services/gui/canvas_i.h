@@ -14,6 +14,13 @@
 
 #define ICON_DECOMPRESSOR_BUFFER_SIZE (128u * 64 / 8)
 
+#define CANVAS_ICON_CACHE_ENTRIES 32
+#define CANVAS_ICON_CACHE_SIZE    (2048u)
+
+#define CANVAS_GLYPH_WIDTH_FIRST   (32u)
+#define CANVAS_GLYPH_WIDTH_COUNT   (96u)
+#define CANVAS_GLYPH_WIDTH_MISSING INT8_MIN
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -35,6 +42,44 @@ ARRAY_DEF(CanvasCallbackPairArray, CanvasCallbackPair, M_POD_OPLIST);
 
 ALGO_DEF(CanvasCallbackPairArray, CanvasCallbackPairArray_t);
 
+/** Canvas area, x1 and y1 are exclusive
+ */
+typedef struct {
+    uint8_t x0;
+    uint8_t y0;
+    uint8_t x1;
+    uint8_t y1;
+} CanvasArea;
+
+/** Decoded icon frame
+ */
+typedef struct {
+    const uint8_t* data; /**< Compressed frame data, NULL for a free entry */
+    uint8_t* bitmap; /**< Decoded frame */
+    size_t size; /**< Decoded frame size in bytes */
+    uint32_t last_used; /**< Value of use counter on the last draw */
+} CanvasIconCacheEntry;
+
+/** Least recently used decoded icon frames
+ *
+ * Only frames from firmware image are cached: application icons are unloaded
+ * together with application and their address can be taken by other data.
+ */
+typedef struct {
+    CanvasIconCacheEntry entries[CANVAS_ICON_CACHE_ENTRIES];
+    size_t size; /**< Total size of decoded frames */
+    uint32_t use_counter;
+    uint32_t hits;
+    uint32_t misses;
+} CanvasIconCache;
+
+/** Horizontal glyph metrics, taken from font once
+ */
+typedef struct {
+    int8_t advance; /**< Offset of the next glyph */
+    int8_t tail; /**< String width correction for the last glyph or CANVAS_GLYPH_WIDTH_MISSING */
+} CanvasGlyphWidth;
+
 /** Canvas structure
  */
 struct Canvas {
@@ -45,8 +90,19 @@ struct Canvas {
     size_t width;
     size_t height;
     CompressIcon* compress_icon;
+    CanvasIconCache icon_cache;
+    // Current font, FontTotalNumber for custom fonts
+    Font font;
+    // Printable ASCII glyph widths of built-in fonts, allocated on first use
+    CanvasGlyphWidth* glyph_widths[FontTotalNumber];
     CanvasCallbackPairArray_t canvas_callback_pair;
     FuriMutex* mutex;
+    // Clip area in display coordinates
+    bool clip;
+    CanvasArea clip_area;
+    // Display content as of the last commit
+    uint8_t* commit_shadow;
+    bool commit_shadow_valid;
 };
 
 /** Allocate memory and initialize canvas
@@ -107,6 +163,38 @@ void canvas_set_orientation(Canvas* canvas, CanvasOrientation orientation);
  */
 CanvasOrientation canvas_get_orientation(const Canvas* canvas);
 
+/** Get icon cache counters
+ *
+ * @param      canvas  Canvas instance
+ * @param      hits    pointer to store count of frames taken from cache
+ * @param      misses  pointer to store count of compressed frames decoded
+ */
+void canvas_get_icon_cache_stats(const Canvas* canvas, uint32_t* hits, uint32_t* misses);
+
+/** Convert area between canvas and display coordinates
+ *
+ * Canvas coordinates are the ones drawing functions use in given orientation,
+ * before frame offset is applied. Display coordinates are the ones of the
+ * horizontal orientation, in which framebuffer is laid out.
+ *
+ * @param      area         area to convert, clamped to the screen
+ * @param      orientation  CanvasOrientation of canvas coordinates
+ * @param      to_display   true to convert from canvas to display coordinates
+ *
+ * @return     converted area
+ */
+CanvasArea canvas_area_convert(CanvasArea area, CanvasOrientation orientation, bool to_display);
+
+/** Limit drawing to area
+ *
+ * Clip area is kept when orientation changes. canvas_clear only clears the
+ * clip area while it is set.
+ *
+ * @param      canvas  Canvas instance
+ * @param      area    area in display coordinates or NULL to reset clipping
+ */
+void canvas_set_clip(Canvas* canvas, const CanvasArea* area);
+
 /** Draw a u8g2 bitmap
  *
  * @param      u8g2     u8g2 instance
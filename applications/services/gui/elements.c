@@ -290,8 +290,8 @@ static size_t
     }
     size_t text_size = end - text;
     FuriString* str;
-    str = furi_string_alloc_set(text);
-    furi_string_left(str, text_size);
+    str = furi_string_alloc();
+    furi_string_set_strn(str, text, text_size);
     size_t result = 0;
 
     size_t len_px = canvas_string_width(canvas, furi_string_get_cstr(str));
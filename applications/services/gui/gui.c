@@ -39,9 +39,61 @@ size_t gui_active_view_port_count(Gui* gui, GuiLayer layer) {
 
 void gui_update(Gui* gui) {
     furi_assert(gui);
+
+    FURI_CRITICAL_ENTER();
+    gui->dirty_full = true;
+    FURI_CRITICAL_EXIT();
+
+    if(!gui->direct_draw) furi_thread_flags_set(gui->thread_id, GUI_THREAD_FLAG_DRAW);
+}
+
+void gui_update_area(Gui* gui, const CanvasArea* area) {
+    furi_assert(gui);
+    furi_assert(area);
+    furi_assert(area->x0 < area->x1 && area->y0 < area->y1);
+
+    FURI_CRITICAL_ENTER();
+    CanvasArea* dirty = &gui->dirty_area;
+    if(dirty->x0 < dirty->x1) {
+        dirty->x0 = MIN(dirty->x0, area->x0);
+        dirty->y0 = MIN(dirty->y0, area->y0);
+        dirty->x1 = MAX(dirty->x1, area->x1);
+        dirty->y1 = MAX(dirty->y1, area->y1);
+    } else {
+        *dirty = *area;
+    }
+    FURI_CRITICAL_EXIT();
+
     if(!gui->direct_draw) furi_thread_flags_set(gui->thread_id, GUI_THREAD_FLAG_DRAW);
 }
 
+static bool gui_area_intersects(const CanvasArea* a, const CanvasArea* b) {
+    return a->x0 < b->x1 && b->x0 < a->x1 && a->y0 < b->y1 && b->y0 < a->y1;
+}
+
+// Check if ViewPort drawn last time overlaps area, NULL area is the whole display
+static bool gui_view_port_in_area(const ViewPort* view_port, const CanvasArea* area) {
+    if(!area || !view_port->frame_valid) return true;
+    const CanvasArea frame =
+        canvas_area_convert(view_port->frame, view_port->frame_orientation, true);
+    return gui_area_intersects(&frame, area);
+}
+
+static bool gui_status_bar_in_area(const CanvasArea* area) {
+    if(!area) return true;
+    const CanvasOrientation orientation = furi_hal_rtc_is_flag_set(FuriHalRtcFlagHandOrient) ?
+                                              CanvasOrientationHorizontalFlip :
+                                              CanvasOrientationHorizontal;
+    const CanvasArea status_bar = {
+        .x0 = GUI_STATUS_BAR_X,
+        .y0 = GUI_STATUS_BAR_Y,
+        .x1 = GUI_STATUS_BAR_X + GUI_STATUS_BAR_WIDTH,
+        .y1 = GUI_STATUS_BAR_Y + GUI_STATUS_BAR_HEIGHT,
+    };
+    const CanvasArea display_status_bar = canvas_area_convert(status_bar, orientation, true);
+    return gui_area_intersects(&display_status_bar, area);
+}
+
 void gui_input_events_callback(const void* value, void* ctx) {
     furi_assert(value);
     furi_assert(ctx);
@@ -53,12 +105,12 @@ void gui_input_events_callback(const void* value, void* ctx) {
 }
 
 // Only Fullscreen supports vertical display for now
-static bool gui_redraw_fs(Gui* gui) {
+static bool gui_redraw_fs(Gui* gui, const CanvasArea* area) {
     canvas_set_orientation(gui->canvas, CanvasOrientationHorizontal);
     canvas_frame_set(gui->canvas, 0, 0, GUI_DISPLAY_WIDTH, GUI_DISPLAY_HEIGHT);
     ViewPort* view_port = gui_view_port_find_enabled(gui->layers[GuiLayerFullscreen]);
     if(view_port) {
-        view_port_draw(view_port, gui->canvas);
+        if(gui_view_port_in_area(view_port, area)) view_port_draw(view_port, gui->canvas);
         return true;
     } else {
         return false;
@@ -217,23 +269,23 @@ static void gui_redraw_status_bar(Gui* gui, bool need_attention) {
     }
 }
 
-static bool gui_redraw_window(Gui* gui) {
+static bool gui_redraw_window(Gui* gui, const CanvasArea* area) {
     canvas_set_orientation(gui->canvas, CanvasOrientationHorizontal);
     canvas_frame_set(gui->canvas, GUI_WINDOW_X, GUI_WINDOW_Y, GUI_WINDOW_WIDTH, GUI_WINDOW_HEIGHT);
     ViewPort* view_port = gui_view_port_find_enabled(gui->layers[GuiLayerWindow]);
     if(view_port) {
-        view_port_draw(view_port, gui->canvas);
+        if(gui_view_port_in_area(view_port, area)) view_port_draw(view_port, gui->canvas);
         return true;
     }
     return false;
 }
 
-static bool gui_redraw_desktop(Gui* gui) {
+static bool gui_redraw_desktop(Gui* gui, const CanvasArea* area) {
     canvas_set_orientation(gui->canvas, CanvasOrientationHorizontal);
     canvas_frame_set(gui->canvas, 0, 0, GUI_DISPLAY_WIDTH, GUI_DISPLAY_HEIGHT);
     ViewPort* view_port = gui_view_port_find_enabled(gui->layers[GuiLayerDesktop]);
     if(view_port) {
-        view_port_draw(view_port, gui->canvas);
+        if(gui_view_port_in_area(view_port, area)) view_port_draw(view_port, gui->canvas);
         return true;
     }
 
@@ -247,23 +299,38 @@ static void gui_redraw(Gui* gui) {
     do {
         if(gui->direct_draw) break;
 
+        // Take accumulated redraw requests, NULL area means full redraw
+        FURI_CRITICAL_ENTER();
+        const bool full = gui->dirty_full;
+        const CanvasArea dirty_area = gui->dirty_area;
+        gui->dirty_full = false;
+        gui->dirty_area = (CanvasArea){0};
+        FURI_CRITICAL_EXIT();
+
+        const CanvasArea* area = full ? NULL : &dirty_area;
+        // Requests were handled by previous redraw
+        if(area && area->x0 >= area->x1) break;
+
+        // Everything outside of the area is kept as it was drawn last time
+        if(area) canvas_set_clip(gui->canvas, area);
         canvas_reset(gui->canvas);
 
         if(gui->lockdown) {
-            gui_redraw_desktop(gui);
+            gui_redraw_desktop(gui, area);
             bool need_attention =
                 (gui_view_port_find_enabled(gui->layers[GuiLayerWindow]) != 0 ||
                  gui_view_port_find_enabled(gui->layers[GuiLayerFullscreen]) != 0);
-            gui_redraw_status_bar(gui, need_attention);
+            if(gui_status_bar_in_area(area)) gui_redraw_status_bar(gui, need_attention);
         } else {
-            if(!gui_redraw_fs(gui)) {
-                if(!gui_redraw_window(gui)) {
-                    gui_redraw_desktop(gui);
+            if(!gui_redraw_fs(gui, area)) {
+                if(!gui_redraw_window(gui, area)) {
+                    gui_redraw_desktop(gui, area);
                 }
-                gui_redraw_status_bar(gui, false);
+                if(gui_status_bar_in_area(area)) gui_redraw_status_bar(gui, false);
             }
         }
 
+        if(area) canvas_set_clip(gui->canvas, NULL);
         canvas_commit(gui->canvas);
     } while(false);
 
@@ -348,6 +415,32 @@ void gui_unlock(Gui* gui) {
     furi_check(furi_mutex_release(gui->mutex) == FuriStatusOk);
 }
 
+void gui_info_get(Gui* gui, PropertyValueCallback out, char sep, void* context) {
+    furi_check(gui);
+    furi_check(out);
+
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    gui_lock(gui);
+    canvas_get_icon_cache_stats(gui->canvas, &hits, &misses);
+    gui_unlock(gui);
+
+    FuriString* key = furi_string_alloc();
+    FuriString* value = furi_string_alloc();
+
+    PropertyValueContext property_context = {
+        .key = key, .value = value, .out = out, .sep = sep, .last = false, .context = context};
+
+    property_value_out(&property_context, NULL, 2, "format", "major", "1");
+    property_value_out(&property_context, NULL, 2, "format", "minor", "0");
+    property_value_out(&property_context, "%lu", 2, "icon_cache", "hits", hits);
+    property_context.last = true;
+    property_value_out(&property_context, "%lu", 2, "icon_cache", "misses", misses);
+
+    furi_string_free(key);
+    furi_string_free(value);
+}
+
 void gui_add_view_port(Gui* gui, ViewPort* view_port, GuiLayer layer) {
     furi_check(gui);
     furi_check(view_port);
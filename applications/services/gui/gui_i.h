@@ -11,6 +11,7 @@
 #include <furi_hal_rtc.h>
 #include <m-array.h>
 #include <stdio.h>
+#include <toolbox/property.h>
 
 #include "canvas.h"
 #include "canvas_i.h"
@@ -55,6 +56,10 @@ struct Gui {
     ViewPortArray_t layers[GuiLayerMAX];
     Canvas* canvas;
 
+    // Area to redraw in display coordinates, accessed in critical section
+    bool dirty_full;
+    CanvasArea dirty_area;
+
     // Input
     FuriMessageQueue* input_queue;
     FuriPubSub* input_events;
@@ -76,6 +81,16 @@ ViewPort* gui_view_port_find_enabled(ViewPortArray_t array);
  */
 void gui_update(Gui* gui);
 
+/** Update GUI, request redraw of display area
+ *
+ * Redraw requests are merged into the bounding box until GUI thread handles
+ * them. Full redraw request covers all of them.
+ *
+ * @param      gui   Gui instance
+ * @param      area  area in display coordinates, must not be empty
+ */
+void gui_update_area(Gui* gui, const CanvasArea* area);
+
 /** Input event callback
  * 
  * Used to receive input from input service or to inject new input events
@@ -103,3 +118,15 @@ void gui_lock(Gui* gui);
  * @param      gui   The Gui instance
  */
 void gui_unlock(Gui* gui);
+
+/** Get GUI counters as key-value pairs
+ *
+ * Reports icon cache hits and misses: frames drawn from the cache and
+ * compressed frames decoded.
+ *
+ * @param      gui      The Gui instance
+ * @param      out      output callback
+ * @param      sep      key parts separator
+ * @param      context  context to pass to the callback
+ */
+void gui_info_get(Gui* gui, PropertyValueCallback out, char sep, void* context);
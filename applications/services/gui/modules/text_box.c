@@ -3,15 +3,17 @@
 #include <gui/elements.h>
 #include <furi.h>
 #include <stdint.h>
+#include <m-array.h>
 
-#define TEXT_BOX_TEXT_WIDTH           (120)
-#define TEXT_BOX_TEXT_HEIGHT          (56)
-#define TEXT_BOX_MAX_LINES_PER_SCREEN (10)
+#define TEXT_BOX_TEXT_WIDTH  (120)
+#define TEXT_BOX_TEXT_HEIGHT (56)
 
 #define TEXT_BOX_LINES_SCROLL_SPEED_MEDIUM     (3)
 #define TEXT_BOX_LINES_SCROLL_SPEED_FAST       (5)
 #define TEXT_BOX_LINES_SCROLL_SPEED_SATURATION (9)
 
+ARRAY_DEF(TextBoxLineArray, uint32_t, M_POD_OPLIST);
+
 struct TextBox {
     View* view;
 
@@ -27,12 +29,14 @@ typedef struct {
     int32_t scroll_num;
     int32_t lines_on_screen;
 
+    // Text offsets of line starts, last line ends at the end of text
+    TextBoxLineArray_t lines;
+    // Scroll position text_on_screen is made for, -1 if it needs update
     int32_t line_offset;
-    int32_t text_offset;
     FuriString* text_on_screen;
-    FuriString* text_line;
 
     bool formatted;
+    bool appended;
 } TextBoxModel;
 
 static void text_box_process_down(TextBox* text_box, uint8_t lines) {
@@ -101,147 +105,80 @@ static bool text_box_view_input_callback(InputEvent* event, void* context) {
     return consumed;
 }
 
-static bool text_box_end_of_text_reached(TextBoxModel* model) {
-    return model->text[model->text_offset] == '\0';
-}
-
-static bool text_box_start_of_text_reached(TextBoxModel* model) {
-    return model->text_offset == 0;
-}
-
-static void text_box_seek_next_line(Canvas* canvas, TextBoxModel* model) {
+// Get text offset where line that starts at text offset ends
+static size_t text_box_seek_next_line(Canvas* canvas, const char* text, size_t text_offset) {
     size_t line_width = 0;
+    const size_t line_start = text_offset;
 
-    while(!text_box_end_of_text_reached(model)) {
-        char symb = model->text[model->text_offset];
+    while(text[text_offset] != '\0') {
+        char symb = text[text_offset];
         if(symb == '\n') {
-            model->text_offset++;
+            text_offset++;
             break;
         } else {
             size_t glyph_width = canvas_glyph_width(canvas, symb);
-            if(line_width + glyph_width > TEXT_BOX_TEXT_WIDTH) {
+            // Glyph wider than the line still takes a line of its own
+            if(line_width + glyph_width > TEXT_BOX_TEXT_WIDTH && text_offset != line_start) {
                 break;
             }
             line_width += glyph_width;
-            model->text_offset++;
+            text_offset++;
         }
     }
-}
 
-static void text_box_seek_end_of_prev_line(TextBoxModel* model) {
-    do {
-        if(text_box_start_of_text_reached(model)) break;
-        model->text_offset--;
-        if(text_box_start_of_text_reached(model)) break;
-        if(model->text[model->text_offset] == '\n') {
-            model->text_offset--;
-        }
-    } while(false);
+    return text_offset;
 }
 
-static void text_box_seek_prev_paragraph(TextBoxModel* model) {
-    while(!text_box_start_of_text_reached(model)) {
-        if(model->text[model->text_offset] == '\n') {
-            model->text_offset++;
-            break;
-        }
-        model->text_offset--;
+// Index lines from the start of the last indexed one, it could get longer if text was appended
+static void text_box_index_lines(Canvas* canvas, TextBoxModel* model) {
+    uint32_t text_offset = 0;
+    if(TextBoxLineArray_size(model->lines)) {
+        TextBoxLineArray_pop_back(&text_offset, model->lines);
     }
-}
-
-static void text_box_seek_prev_line(Canvas* canvas, TextBoxModel* model) {
-    int32_t start_text_offset = model->text_offset;
 
-    text_box_seek_end_of_prev_line(model);
-    text_box_seek_prev_paragraph(model);
+    do {
+        TextBoxLineArray_push_back(model->lines, text_offset);
+        text_offset = text_box_seek_next_line(canvas, model->text, text_offset);
+    } while(model->text[text_offset] != '\0');
 
-    int32_t current_text_offset = model->text_offset;
-    while(true) {
-        text_box_seek_next_line(canvas, model);
-        if(model->text_offset == start_text_offset) {
-            break;
-        }
-        current_text_offset = model->text_offset;
+    // One line more, for the end of text to stay in sight
+    int32_t lines_num = TextBoxLineArray_size(model->lines) + 1;
+    model->scroll_num = 0;
+    if(lines_num > model->lines_on_screen) {
+        model->scroll_num = lines_num - model->lines_on_screen;
     }
-    model->text_offset = current_text_offset;
-}
 
-static void text_box_move_line_offset(Canvas* canvas, TextBoxModel* model, int32_t line_offset) {
-    if(line_offset >= 0) {
-        for(int32_t i = 0; i < line_offset; i++) {
-            text_box_seek_next_line(canvas, model);
-        }
+    if(model->focus == TextBoxFocusEnd) {
+        model->scroll_pos = MAX(model->scroll_num - 1, 0);
     } else {
-        for(int32_t i = 0; i < (-line_offset); i++) {
-            text_box_seek_prev_line(canvas, model);
-        }
+        model->scroll_pos = MIN(model->scroll_pos, MAX(model->scroll_num - 1, 0));
     }
+    model->line_offset = -1;
 }
 
-static void text_box_update_screen_text(Canvas* canvas, TextBoxModel* model) {
+static void text_box_update_screen_text(TextBoxModel* model) {
     furi_string_reset(model->text_on_screen);
-    furi_string_reset(model->text_line);
-
-    int32_t start_text_offset = model->text_offset;
-
-    for(int32_t i = 0; i < model->lines_on_screen; i++) {
-        int32_t current_line_text_offset = model->text_offset;
-        text_box_seek_next_line(canvas, model);
-        int32_t next_line_text_offset = model->text_offset;
-        furi_string_set_strn(
-            model->text_line,
-            &model->text[current_line_text_offset],
-            next_line_text_offset - current_line_text_offset);
-        size_t str_len = furi_string_size(model->text_line);
-        if(furi_string_get_char(model->text_line, str_len - 1) != '\n') {
-            furi_string_push_back(model->text_line, '\n');
-        }
-        furi_string_cat(model->text_on_screen, model->text_line);
-
-        if(text_box_end_of_text_reached(model)) break;
-        current_line_text_offset = next_line_text_offset;
-    }
-
-    model->text_offset = start_text_offset;
-}
-
-static void text_box_update_text_on_screen(Canvas* canvas, TextBoxModel* model) {
-    int32_t line_offset = model->scroll_pos - model->line_offset;
-    text_box_move_line_offset(canvas, model, line_offset);
-    text_box_update_screen_text(canvas, model);
-    model->line_offset = model->scroll_pos;
-}
-
-static void text_box_prepare_model(Canvas* canvas, TextBoxModel* model) {
-    int32_t lines_num = 0;
-    model->text_offset = 0;
-    model->scroll_num = 0;
-    model->scroll_pos = 0;
-    model->line_offset = 0;
-    model->lines_on_screen = TEXT_BOX_TEXT_HEIGHT / canvas_current_font_height(canvas);
-
-    // Cache text offset to quick final text offset update if TextBoxFocusEnd is set
-    int32_t window_offset[TEXT_BOX_MAX_LINES_PER_SCREEN] = {};
-    do {
-        window_offset[lines_num % model->lines_on_screen] = model->text_offset;
-        text_box_seek_next_line(canvas, model);
-        lines_num++;
-    } while(!text_box_end_of_text_reached(model));
-    model->text_offset = 0;
-    lines_num++;
 
-    if(model->focus == TextBoxFocusEnd) {
-        if(lines_num > model->lines_on_screen) {
-            model->text_offset = window_offset[(lines_num - 1) % model->lines_on_screen];
+    const size_t lines_count = TextBoxLineArray_size(model->lines);
+    for(size_t i = model->scroll_pos;
+        i < lines_count && i < (size_t)(model->scroll_pos + model->lines_on_screen);
+        i++) {
+        const size_t line_start = *TextBoxLineArray_get(model->lines, i);
+        size_t line_end = line_start + strlen(&model->text[line_start]);
+        if(i + 1 < lines_count) {
+            line_end = *TextBoxLineArray_get(model->lines, i + 1);
         }
-    }
 
-    if(lines_num > model->lines_on_screen) {
-        model->scroll_num = lines_num - model->lines_on_screen;
-        model->scroll_pos = (model->focus == TextBoxFocusEnd) ? model->scroll_num - 1 : 0;
+        furi_string_cat_printf(
+            model->text_on_screen,
+            "%.*s",
+            (int)(line_end - line_start),
+            &model->text[line_start]);
+        if(line_end == line_start || model->text[line_end - 1] != '\n') {
+            furi_string_push_back(model->text_on_screen, '\n');
+        }
     }
 
-    text_box_update_screen_text(canvas, model);
     model->line_offset = model->scroll_pos;
 }
 
@@ -260,15 +197,22 @@ static void text_box_view_draw_callback(Canvas* canvas, void* _model) {
     }
 
     if(!model->formatted) {
-        text_box_prepare_model(canvas, model);
+        TextBoxLineArray_reset(model->lines);
+        model->scroll_pos = 0;
+        model->lines_on_screen = TEXT_BOX_TEXT_HEIGHT / canvas_current_font_height(canvas);
+        text_box_index_lines(canvas, model);
         model->formatted = true;
+        model->appended = false;
+    } else if(model->appended) {
+        text_box_index_lines(canvas, model);
+        model->appended = false;
     }
 
     elements_slightly_rounded_frame(canvas, 0, 0, 124, 64);
     elements_scrollbar(canvas, model->scroll_pos, model->scroll_num);
 
     if(model->line_offset != model->scroll_pos) {
-        text_box_update_text_on_screen(canvas, model);
+        text_box_update_screen_text(model);
     }
     elements_multiline_text(canvas, 3, 11, furi_string_get_cstr(model->text_on_screen));
 }
@@ -286,8 +230,8 @@ TextBox* text_box_alloc(void) {
         TextBoxModel * model,
         {
             model->text = NULL;
+            TextBoxLineArray_init(model->lines);
             model->text_on_screen = furi_string_alloc();
-            model->text_line = furi_string_alloc();
             model->formatted = false;
             model->font = TextBoxFontText;
         },
@@ -303,8 +247,8 @@ void text_box_free(TextBox* text_box) {
         text_box->view,
         TextBoxModel * model,
         {
+            TextBoxLineArray_clear(model->lines);
             furi_string_free(model->text_on_screen);
-            furi_string_free(model->text_line);
         },
         true);
     view_free(text_box->view);
@@ -326,14 +270,14 @@ void text_box_reset(TextBox* text_box) {
             model->text = NULL;
             model->font = TextBoxFontText;
             model->focus = TextBoxFocusStart;
-            furi_string_reset(model->text_line);
+            TextBoxLineArray_reset(model->lines);
             furi_string_reset(model->text_on_screen);
             model->line_offset = 0;
-            model->text_offset = 0;
             model->lines_on_screen = 0;
             model->scroll_num = 0;
             model->scroll_pos = 0;
             model->formatted = false;
+            model->appended = false;
         },
         true);
 }
@@ -352,10 +296,31 @@ void text_box_set_text(TextBox* text_box, const char* text) {
         true);
 }
 
+void text_box_set_text_appended(TextBox* text_box, const char* text) {
+    furi_check(text_box);
+    furi_check(text);
+
+    with_view_model(
+        text_box->view,
+        TextBoxModel * model,
+        {
+            model->text = text;
+            model->appended = true;
+        },
+        true);
+}
+
 void text_box_set_font(TextBox* text_box, TextBoxFont font) {
     furi_check(text_box);
 
-    with_view_model(text_box->view, TextBoxModel * model, { model->font = font; }, true);
+    with_view_model(
+        text_box->view,
+        TextBoxModel * model,
+        {
+            model->font = font;
+            model->formatted = false;
+        },
+        true);
 }
 
 void text_box_set_focus(TextBox* text_box, TextBoxFocus focus) {
@@ -57,6 +57,17 @@ void text_box_reset(TextBox* text_box);
  */
 void text_box_set_text(TextBox* text_box, const char* text);
 
+/** Set text for text_box that is the previous text with more text appended
+ *
+ * Lines of the previous text are kept and only the appended part is laid
+ * out, which keeps growing logs fast. Text may be at another address, but it
+ * must start with the previous text.
+ *
+ * @param      text_box  TextBox instance
+ * @param      text      text to set
+ */
+void text_box_set_text_appended(TextBox* text_box, const char* text);
+
 /** Set TextBox font
  *
  * @param      text_box  TextBox instance
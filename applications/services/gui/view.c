@@ -52,6 +52,11 @@ void view_set_update_callback(View* view, ViewUpdateCallback callback) {
     view->update_callback = callback;
 }
 
+void view_set_update_area_callback(View* view, ViewUpdateAreaCallback callback) {
+    furi_check(view);
+    view->update_area_callback = callback;
+}
+
 void view_set_update_callback_context(View* view, void* context) {
     furi_check(view);
     view->update_callback_context = context;
@@ -115,6 +120,15 @@ void view_commit_model(View* view, bool update) {
     }
 }
 
+void view_update_area(View* view, int32_t x, int32_t y, size_t width, size_t height) {
+    furi_check(view);
+    if(view->update_area_callback) {
+        view->update_area_callback(view, x, y, width, height, view->update_callback_context);
+    } else if(view->update_callback) {
+        view->update_callback(view, view->update_callback_context);
+    }
+}
+
 void view_icon_animation_callback(IconAnimation* instance, void* context) {
     UNUSED(instance);
     furi_check(context);
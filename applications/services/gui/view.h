@@ -76,6 +76,22 @@ typedef void (*ViewCallback)(void* context);
  */
 typedef void (*ViewUpdateCallback)(View* view, void* context);
 
+/** View Update Area Callback Called when only part of the view changed
+ * @param      view     pointer to view
+ * @param      x        area x, relative to the view
+ * @param      y        area y, relative to the view
+ * @param      width    area width
+ * @param      height   area height
+ * @param      context  pointer to context, same as for ViewUpdateCallback
+ */
+typedef void (*ViewUpdateAreaCallback)(
+    View* view,
+    int32_t x,
+    int32_t y,
+    size_t width,
+    size_t height,
+    void* context);
+
 /** View model types */
 typedef enum {
     /** Model is not allocated */
@@ -157,6 +173,15 @@ void view_set_exit_callback(View* view, ViewCallback callback);
  */
 void view_set_update_callback(View* view, ViewUpdateCallback callback);
 
+/** Set Update Area callback
+ *
+ * Uses the same context as the Update callback
+ *
+ * @param      view      View instance
+ * @param      callback  callback
+ */
+void view_set_update_area_callback(View* view, ViewUpdateAreaCallback callback);
+
 /** Set View Draw callback
  *
  * @param      view     View instance
@@ -208,6 +233,19 @@ void* view_get_model(View* view);
  */
 void view_commit_model(View* view, bool update);
 
+/** Request redraw of a part of the view
+ *
+ * Use after view_commit_model(view, false) when the model change only touched
+ * the given area. Falls back to a full update if the owner can't redraw areas.
+ *
+ * @param      view    View instance
+ * @param      x       area x, relative to the view
+ * @param      y       area y, relative to the view
+ * @param      width   area width
+ * @param      height  area height
+ */
+void view_update_area(View* view, int32_t x, int32_t y, size_t width, size_t height);
+
 #ifdef __cplusplus
 }
 #endif
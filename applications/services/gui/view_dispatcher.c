@@ -145,6 +145,7 @@ void view_dispatcher_add_view(ViewDispatcher* view_dispatcher, uint32_t view_id,
 
     ViewDict_set_at(view_dispatcher->views, view_id, view);
     view_set_update_callback(view, view_dispatcher_update);
+    view_set_update_area_callback(view, view_dispatcher_update_area);
     view_set_update_callback_context(view, view_dispatcher);
 
     // Unlock gui
@@ -175,6 +176,7 @@ void view_dispatcher_remove_view(ViewDispatcher* view_dispatcher, uint32_t view_
     furi_check(ViewDict_erase(view_dispatcher->views, view_id));
 
     view_set_update_callback(view, NULL);
+    view_set_update_area_callback(view, NULL);
     view_set_update_callback_context(view, NULL);
 
     // Unlock gui
@@ -368,6 +370,23 @@ void view_dispatcher_update(View* view, void* context) {
     }
 }
 
+void view_dispatcher_update_area(
+    View* view,
+    int32_t x,
+    int32_t y,
+    size_t width,
+    size_t height,
+    void* context) {
+    furi_check(view);
+    furi_check(context);
+
+    ViewDispatcher* view_dispatcher = context;
+
+    if(view_dispatcher->current_view == view) {
+        view_port_update_area(view_dispatcher->view_port, x, y, width, height);
+    }
+}
+
 bool view_dispatcher_run_event_callback(FuriEventLoopObject* object, void* context) {
     furi_assert(context);
     ViewDispatcher* instance = context;
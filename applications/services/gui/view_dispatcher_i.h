@@ -55,6 +55,15 @@ void view_dispatcher_set_current_view(ViewDispatcher* view_dispatcher, View* vie
 /** ViewDispatcher update event */
 void view_dispatcher_update(View* view, void* context);
 
+/** ViewDispatcher update area event */
+void view_dispatcher_update_area(
+    View* view,
+    int32_t x,
+    int32_t y,
+    size_t width,
+    size_t height,
+    void* context);
+
 /** ViewDispatcher run event loop event callback */
 bool view_dispatcher_run_event_callback(FuriEventLoopObject* object, void* context);
 
@@ -19,6 +19,13 @@ struct ViewHolder {
 
 static void view_holder_draw_callback(Canvas* canvas, void* context);
 static void view_holder_input_callback(InputEvent* event, void* context);
+static void view_holder_update_area(
+    View* view,
+    int32_t x,
+    int32_t y,
+    size_t width,
+    size_t height,
+    void* context);
 
 ViewHolder* view_holder_alloc(void) {
     ViewHolder* view_holder = malloc(sizeof(ViewHolder));
@@ -58,6 +65,7 @@ void view_holder_set_view(ViewHolder* view_holder, View* view) {
 
         view_exit(view_holder->view);
         view_set_update_callback(view_holder->view, NULL);
+        view_set_update_area_callback(view_holder->view, NULL);
         view_set_update_callback_context(view_holder->view, NULL);
     }
 
@@ -73,6 +81,7 @@ void view_holder_set_view(ViewHolder* view_holder, View* view) {
         }
 
         view_set_update_callback(view_holder->view, view_holder_update);
+        view_set_update_area_callback(view_holder->view, view_holder_update_area);
         view_set_update_callback_context(view_holder->view, view_holder);
 
         view_enter(view_holder->view);
@@ -136,6 +145,22 @@ void view_holder_send_to_back(ViewHolder* view_holder) {
     gui_view_port_send_to_back(view_holder->gui, view_holder->view_port);
 }
 
+static void view_holder_update_area(
+    View* view,
+    int32_t x,
+    int32_t y,
+    size_t width,
+    size_t height,
+    void* context) {
+    furi_check(view);
+    furi_check(context);
+
+    ViewHolder* view_holder = context;
+    if(view == view_holder->view) {
+        view_port_update_area(view_holder->view_port, x, y, width, height);
+    }
+}
+
 static void view_holder_draw_callback(Canvas* canvas, void* context) {
     ViewHolder* view_holder = context;
     if(view_holder->view) {
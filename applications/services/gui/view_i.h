@@ -25,6 +25,7 @@ struct View {
     ViewOrientation orientation;
 
     ViewUpdateCallback update_callback;
+    ViewUpdateAreaCallback update_area_callback;
     void* update_callback_context;
 
     void* model;
@@ -192,10 +192,50 @@ void view_port_update(ViewPort* view_port) {
     furi_mutex_release(view_port->mutex);
 }
 
+void view_port_update_area(
+    ViewPort* view_port,
+    int32_t x,
+    int32_t y,
+    size_t width,
+    size_t height) {
+    furi_check(view_port);
+
+    // We are not going to lockup system, but will notify you instead
+    // Make sure that you don't call viewport methods inside of another mutex, especially one that is used in draw call
+    if(furi_mutex_acquire(view_port->mutex, 2) != FuriStatusOk) {
+        FURI_LOG_W(TAG, "ViewPort lockup: see %s:%d", __FILE__, __LINE__ - 3);
+    }
+
+    if(view_port->gui && view_port->is_enabled) {
+        if(view_port->frame_valid) {
+            const CanvasArea* frame = &view_port->frame;
+            const int32_t x1 = x + (int32_t)MIN(width, (size_t)UINT8_MAX);
+            const int32_t y1 = y + (int32_t)MIN(height, (size_t)UINT8_MAX);
+            const CanvasArea area = {
+                .x0 = CLAMP(frame->x0 + x, frame->x1, frame->x0),
+                .y0 = CLAMP(frame->y0 + y, frame->y1, frame->y0),
+                .x1 = CLAMP(frame->x0 + x1, frame->x1, frame->x0),
+                .y1 = CLAMP(frame->y0 + y1, frame->y1, frame->y0),
+            };
+            // Nothing to redraw if area is outside of the ViewPort
+            if(area.x0 < area.x1 && area.y0 < area.y1) {
+                CanvasArea display_area =
+                    canvas_area_convert(area, view_port->frame_orientation, true);
+                gui_update_area(view_port->gui, &display_area);
+            }
+        } else {
+            gui_update(view_port->gui);
+        }
+    }
+
+    furi_mutex_release(view_port->mutex);
+}
+
 void view_port_gui_set(ViewPort* view_port, Gui* gui) {
     furi_check(view_port);
     furi_check(furi_mutex_acquire(view_port->mutex, FuriWaitForever) == FuriStatusOk);
     view_port->gui = gui;
+    view_port->frame_valid = false;
     furi_check(furi_mutex_release(view_port->mutex) == FuriStatusOk);
 }
 
@@ -213,6 +253,14 @@ void view_port_draw(ViewPort* view_port, Canvas* canvas) {
 
     if(view_port->draw_callback) {
         view_port_setup_canvas_orientation(view_port, canvas);
+        view_port->frame_valid = true;
+        view_port->frame = (CanvasArea){
+            .x0 = MIN(canvas->offset_x, UINT8_MAX),
+            .y0 = MIN(canvas->offset_y, UINT8_MAX),
+            .x1 = MIN(canvas->offset_x + canvas->width, UINT8_MAX),
+            .y1 = MIN(canvas->offset_y + canvas->height, UINT8_MAX),
+        };
+        view_port->frame_orientation = canvas_get_orientation(canvas);
         view_port->draw_callback(canvas, view_port->draw_callback_context);
     }
 
@@ -97,6 +97,26 @@ void view_port_input_callback_set(
  */
 void view_port_update(ViewPort* view_port);
 
+/** Emit update signal for an area of ViewPort to GUI system.
+ *
+ * Only the layers overlapping the area are redrawn, and drawing is clipped to
+ * the area. Draw callback still has to draw the whole ViewPort, it is up to
+ * canvas to drop what is outside. Same as view_port_update if ViewPort was
+ * not drawn yet.
+ *
+ * @param      view_port  ViewPort instance
+ * @param      x          area x coordinate in ViewPort canvas
+ * @param      y          area y coordinate in ViewPort canvas
+ * @param      width      area width
+ * @param      height     area height
+ */
+void view_port_update_area(
+    ViewPort* view_port,
+    int32_t x,
+    int32_t y,
+    size_t width,
+    size_t height);
+
 /** Set ViewPort orientation.
  *
  * @param      view_port    ViewPort instance
@@ -22,6 +22,11 @@ struct ViewPort {
 
     ViewPortInputCallback input_callback;
     void* input_callback_context;
+
+    // Canvas frame of the last draw, for area updates
+    bool frame_valid;
+    CanvasArea frame;
+    CanvasOrientation frame_orientation;
 };
 
 /** Set GUI reference.
@@ -28,6 +28,21 @@ static void view_stack_update_callback(View* view_top_or_bottom, void* context)
     }
 }
 
+static void view_stack_update_area_callback(
+    View* view_top_or_bottom,
+    int32_t x,
+    int32_t y,
+    size_t width,
+    size_t height,
+    void* context) {
+    furi_assert(view_top_or_bottom);
+    furi_assert(context);
+
+    // Stacked views share the stack view origin
+    View* view_stack_view = context;
+    view_update_area(view_stack_view, x, y, width, height);
+}
+
 static void view_stack_enter(void* context) {
     furi_assert(context);
 
@@ -82,6 +97,7 @@ void view_stack_free(ViewStack* view_stack) {
     for(int i = 0; i < MAX_VIEWS; ++i) {
         if(model->views[i]) {
             view_set_update_callback(model->views[i], NULL);
+            view_set_update_area_callback(model->views[i], NULL);
             view_set_update_callback_context(model->views[i], NULL);
         }
     }
@@ -131,6 +147,7 @@ void view_stack_add_view(ViewStack* view_stack, View* view) {
         if(!model->views[i]) {
             model->views[i] = view;
             view_set_update_callback(model->views[i], view_stack_update_callback);
+            view_set_update_area_callback(model->views[i], view_stack_update_area_callback);
             view_set_update_callback_context(model->views[i], view_stack->view);
             if(view->enter_callback) {
                 view->enter_callback(view->context);
@@ -157,6 +174,7 @@ void view_stack_remove_view(ViewStack* view_stack, View* view) {
                 view->exit_callback(view->context);
             }
             view_set_update_callback(model->views[i], NULL);
+            view_set_update_area_callback(model->views[i], NULL);
             view_set_update_callback_context(model->views[i], NULL);
             model->views[i] = NULL;
             result = true;
@@ -40,11 +40,11 @@ void input_press_timer_callback(void* arg) {
     input_pin->press_counter++;
     if(input_pin->press_counter == INPUT_LONG_PRESS_COUNTS) {
         event.type = InputTypeLong;
-        furi_pubsub_publish(input_pin->event_pubsub, &event);
+        furi_pubsub_publish_event(input_pin->event_pubsub, &event, INPUT_TYPE_MASK(event.type));
     } else if(input_pin->press_counter > INPUT_LONG_PRESS_COUNTS) {
         input_pin->press_counter--;
         event.type = InputTypeRepeat;
-        furi_pubsub_publish(input_pin->event_pubsub, &event);
+        furi_pubsub_publish_event(input_pin->event_pubsub, &event, INPUT_TYPE_MASK(event.type));
     }
 }
 
@@ -141,14 +141,15 @@ int32_t input_srv(void* p) {
                         furi_delay_tick(1);
                     if(pin_states[i].press_counter < INPUT_LONG_PRESS_COUNTS) {
                         event.type = InputTypeShort;
-                        furi_pubsub_publish(event_pubsub, &event);
+                        furi_pubsub_publish_event(
+                            event_pubsub, &event, INPUT_TYPE_MASK(event.type));
                     }
                     pin_states[i].press_counter = 0;
                 }
 
                 // Send Press/Release event
                 event.type = pin_states[i].state ? InputTypePress : InputTypeRelease;
-                furi_pubsub_publish(event_pubsub, &event);
+                furi_pubsub_publish_event(event_pubsub, &event, INPUT_TYPE_MASK(event.type));
             }
         }
 
@@ -27,6 +27,11 @@ typedef enum {
     InputTypeMAX, /**< Special value for exceptional */
 } InputType;
 
+/** Input event mask of the type, input events are published with it
+ * and can be filtered with furi_pubsub_subscribe_mask
+ */
+#define INPUT_TYPE_MASK(type) (1UL << (type))
+
 /** Input Event, dispatches with FuriPubSub */
 typedef struct {
     union {
@@ -90,7 +90,7 @@ static void input_cli_send(Cli* cli, FuriString* args, FuriPubSub* event_pubsub)
     } while(false);
 
     if(parsed) { //-V547
-        furi_pubsub_publish(event_pubsub, &event);
+        furi_pubsub_publish_event(event_pubsub, &event, INPUT_TYPE_MASK(event.type));
     } else {
         input_cli_send_print_usage();
     }
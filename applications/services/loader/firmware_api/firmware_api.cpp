@@ -7,21 +7,39 @@
 #include <firmware_api_table.h>
 
 #include <furi_hal_info.h>
+#include <toolbox/crc32_calc.h>
 
 static_assert(!has_hash_collisions(elf_api_table), "Detected API method hash collision!");
 
-constexpr HashtableApiInterface elf_api_interface{
+static constexpr auto elf_api_perfect_hash = perfect_hash_table(elf_api_table);
+
+static_assert(
+    perfect_hash_is_complete(elf_api_perfect_hash, elf_api_table),
+    "API perfect hash is incomplete!");
+
+constexpr PerfectHashApiInterface elf_api_interface{
     {
         .api_version_major = (elf_api_version >> 16),
         .api_version_minor = (elf_api_version & 0xFFFF),
-        .resolver_callback = &elf_resolve_from_hashtable,
+        .resolver_callback = &elf_resolve_from_perfect_hash,
     },
-    elf_api_table.cbegin(),
-    elf_api_table.cend(),
+    elf_api_perfect_hash.table.data(),
+    elf_api_perfect_hash.displacements.data(),
+    elf_api_perfect_hash.table.size(),
+    elf_api_perfect_hash.bucket_count,
 };
-const ElfApiInterface* const firmware_api_interface = &elf_api_interface;
+const ElfApiInterface* const firmware_api_interface = &elf_api_interface.base;
 
 extern "C" void furi_hal_info_get_api_version(uint16_t* major, uint16_t* minor) {
     *major = firmware_api_interface->api_version_major;
     *minor = firmware_api_interface->api_version_minor;
 }
+
+extern "C" uint32_t firmware_api_get_table_crc(void) {
+    static uint32_t table_crc = 0;
+    if(!table_crc) {
+        table_crc = crc32_calc_buffer(
+            0, elf_api_perfect_hash.table.data(), sizeof(elf_api_perfect_hash.table));
+    }
+    return table_crc;
+}
@@ -2,4 +2,19 @@
 
 #include <flipper_application/elf/elf_api_interface.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 extern const ElfApiInterface* const firmware_api_interface;
+
+/**
+ * @brief Get CRC32 of the firmware API table
+ * Changes whenever any API symbol resolves to another address
+ * @return uint32_t
+ */
+uint32_t firmware_api_get_table_crc(void);
+
+#ifdef __cplusplus
+}
+#endif
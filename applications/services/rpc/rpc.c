@@ -25,6 +25,14 @@ typedef enum {
 
 #define RPC_ALL_EVENTS (RpcEvtNewData | RpcEvtDisconnect)
 
+/* Fits a screen frame or a storage data chunk together with message headers,
+ * larger messages are sized first and encoded into a temporary buffer */
+#define RPC_TX_BUFFER_SIZE (RPC_BUFFER_SIZE + 128)
+/* Room for the varint length prefix of a message */
+#define RPC_TX_PREFIX_SIZE (5)
+
+#define RPC_TX_RATE_PERIOD_MS (1000)
+
 DICT_DEF2(RpcHandlerDict, pb_size_t, M_DEFAULT_OPLIST, RpcHandler, M_POD_OPLIST)
 
 typedef struct {
@@ -83,6 +91,12 @@ struct RpcSession {
     RpcSessionTerminatedCallback terminated_callback;
     RpcOwner owner;
     void* context;
+
+    uint8_t* tx_buffer;
+    RpcSessionStats tx_stats;
+    uint32_t tx_rate_start;
+    uint32_t tx_rate_messages;
+    uint32_t tx_rate_bytes;
 };
 
 struct Rpc {
@@ -182,6 +196,20 @@ size_t rpc_session_get_available_size(RpcSession* session) {
     return furi_stream_buffer_spaces_available(session->stream);
 }
 
+void rpc_session_get_stats(RpcSession* session, RpcSessionStats* stats) {
+    furi_check(session);
+    furi_check(stats);
+
+    furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
+    *stats = session->tx_stats;
+    // Nothing was sent for a whole period since the rates were measured
+    if(furi_get_tick() - session->tx_rate_start >= 2 * RPC_TX_RATE_PERIOD_MS) {
+        stats->tx_messages_per_second = 0;
+        stats->tx_bytes_per_second = 0;
+    }
+    furi_mutex_release(session->callbacks_mutex);
+}
+
 bool rpc_pb_stream_read(pb_istream_t* istream, pb_byte_t* buf, size_t count) {
     furi_assert(istream);
     furi_assert(buf);
@@ -339,7 +367,11 @@ static int32_t rpc_session_worker(void* context) {
         pb_release(&PB_Main_msg, session->decoded_message);
 
         if(session->terminate) {
-            FURI_LOG_D(TAG, "Session terminated");
+            FURI_LOG_D(
+                TAG,
+                "Session terminated, sent %lu messages, %lu bytes",
+                session->tx_stats.tx_messages,
+                session->tx_stats.tx_bytes);
             break;
         }
     }
@@ -358,6 +390,7 @@ static void rpc_session_thread_pending_callback(void* context, uint32_t arg) {
     }
     free(session->system_contexts);
     free(session->decoded_message);
+    free(session->tx_buffer);
     RpcHandlerDict_clear(session->handlers);
     furi_stream_buffer_free(session->stream);
 
@@ -389,6 +422,8 @@ RpcSession* rpc_session_open(Rpc* rpc, RpcOwner owner) {
     session->terminate = false;
     session->decode_error = false;
     session->owner = owner;
+    session->tx_buffer = malloc(RPC_TX_BUFFER_SIZE);
+    session->tx_rate_start = furi_get_tick();
     RpcHandlerDict_init(session->handlers);
 
     session->decoded_message = malloc(sizeof(PB_Main));
@@ -446,36 +481,88 @@ void rpc_add_handler(RpcSession* session, pb_size_t message_tag, RpcHandler* han
     RpcHandlerDict_set_at(session->handlers, message_tag, *handler);
 }
 
+/* Encodes message with its length prefix into the session transmit buffer in a single pass.
+ * Must be called with callbacks mutex taken, which also guards the transmit buffer. */
+static uint8_t* rpc_session_encode(RpcSession* session, const PB_Main* message, size_t* size) {
+    uint8_t* buffer = session->tx_buffer;
+
+    // Encode the message body behind the room reserved for its length prefix
+    pb_ostream_t ostream = pb_ostream_from_buffer(
+        buffer + RPC_TX_PREFIX_SIZE, RPC_TX_BUFFER_SIZE - RPC_TX_PREFIX_SIZE);
+
+    if(pb_encode(&ostream, &PB_Main_msg, message)) {
+        const size_t message_size = ostream.bytes_written;
+
+        // Backpatch the length prefix right in front of the body
+        uint8_t prefix[RPC_TX_PREFIX_SIZE];
+        pb_ostream_t prefix_ostream = pb_ostream_from_buffer(prefix, sizeof(prefix));
+        furi_check(pb_encode_varint(&prefix_ostream, message_size));
+
+        buffer += RPC_TX_PREFIX_SIZE - prefix_ostream.bytes_written;
+        memcpy(buffer, prefix, prefix_ostream.bytes_written);
+        *size = prefix_ostream.bytes_written + message_size;
+    } else {
+        session->tx_stats.tx_oversized++;
+
+        ostream = (pb_ostream_t)PB_OSTREAM_SIZING;
+        bool result = pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+        furi_check(result && ostream.bytes_written);
+
+        buffer = malloc(ostream.bytes_written);
+        ostream = pb_ostream_from_buffer(buffer, ostream.bytes_written);
+        pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+        *size = ostream.bytes_written;
+    }
+
+    return buffer;
+}
+
+static void rpc_session_update_tx_stats(RpcSession* session, size_t size) {
+    session->tx_stats.tx_messages++;
+    session->tx_stats.tx_bytes += size;
+    session->tx_rate_messages++;
+    session->tx_rate_bytes += size;
+
+    const uint32_t now = furi_get_tick();
+    const uint32_t elapsed = now - session->tx_rate_start;
+
+    if(elapsed >= RPC_TX_RATE_PERIOD_MS) {
+        session->tx_stats.tx_messages_per_second =
+            (uint64_t)session->tx_rate_messages * RPC_TX_RATE_PERIOD_MS / elapsed;
+        session->tx_stats.tx_bytes_per_second =
+            (uint64_t)session->tx_rate_bytes * RPC_TX_RATE_PERIOD_MS / elapsed;
+        session->tx_rate_start = now;
+        session->tx_rate_messages = 0;
+        session->tx_rate_bytes = 0;
+    }
+}
+
 void rpc_send(RpcSession* session, PB_Main* message) {
     furi_assert(session);
     furi_assert(message);
 
-    pb_ostream_t ostream = PB_OSTREAM_SIZING;
-
 #ifdef SRV_RPC_DEBUG
     FURI_LOG_I(TAG, "OUTPUT:");
     rpc_debug_print_message(message);
 #endif
 
-    bool result = pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
-    furi_check(result && ostream.bytes_written);
-
-    uint8_t* buffer = malloc(ostream.bytes_written);
-    ostream = pb_ostream_from_buffer(buffer, ostream.bytes_written);
-
-    pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+    furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
+    if(session->send_bytes_callback) {
+        size_t size = 0;
+        uint8_t* buffer = rpc_session_encode(session, message, &size);
 
 #ifdef SRV_RPC_DEBUG
-    rpc_debug_print_data("OUTPUT", buffer, ostream.bytes_written);
+        rpc_debug_print_data("OUTPUT", buffer, size);
 #endif
 
-    furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
-    if(session->send_bytes_callback) {
-        session->send_bytes_callback(session->context, buffer, ostream.bytes_written);
+        session->send_bytes_callback(session->context, buffer, size);
+        rpc_session_update_tx_stats(session, size);
+
+        if(buffer < session->tx_buffer || buffer >= session->tx_buffer + RPC_TX_BUFFER_SIZE) {
+            free(buffer);
+        }
     }
     furi_mutex_release(session->callbacks_mutex);
-
-    free(buffer);
 }
 
 void rpc_send_and_release(RpcSession* session, PB_Main* message) {
@@ -30,6 +30,15 @@ typedef void (*RpcSessionClosedCallback)(void* context);
  * and all operations were finished */
 typedef void (*RpcSessionTerminatedCallback)(void* context);
 
+/** RPC session transmit statistics */
+typedef struct {
+    uint32_t tx_messages; /**< messages sent */
+    uint32_t tx_bytes; /**< bytes sent */
+    uint32_t tx_messages_per_second; /**< messages sent during the last measured second */
+    uint32_t tx_bytes_per_second; /**< bytes sent during the last measured second */
+    uint32_t tx_oversized; /**< messages that didn't fit the transmit buffer */
+} RpcSessionStats;
+
 /** RPC owner */
 typedef enum {
     RpcOwnerUnknown = 0,
@@ -136,6 +145,13 @@ size_t rpc_session_feed(RpcSession* session, const uint8_t* buffer, size_t size,
  */
 size_t rpc_session_get_available_size(RpcSession* session);
 
+/** Get transmit statistics of RPC session
+ *
+ * @param   session     pointer to RpcSession descriptor
+ * @param   stats       pointer to RpcSessionStats to fill
+ */
+void rpc_session_get_stats(RpcSession* session, RpcSessionStats* stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -51,6 +51,41 @@ typedef enum {
 
 #define RPC_GUI_INPUT_RESET (0u)
 
+/*
+ * Screen stream encoding
+ *
+ * Frames are sent as is by default. A client switches the encoding with a
+ * ScreenFrame message whose data is a single RpcGuiStreamMode byte, before or
+ * during streaming. While streaming, the switch is answered with an empty
+ * response after the last frame in the previous encoding.
+ *
+ * In delta mode data of every frame starts with a RpcGuiStreamFrame byte:
+ * - Key: the whole framebuffer
+ * - Pages: bit mask of changed 8 row pages, LSB first, followed by the pages
+ * - XorRle: (unchanged byte count, changed byte count, changed bytes XOR
+ *   previous frame) triplets, counts are single bytes
+ * Deltas are taken against the previous frame sent in the session. Frames
+ * that do not change anything are not sent, frames committed while the link
+ * is busy are coalesced, and every RPC_GUI_STREAM_KEYFRAME_INTERVAL frames
+ * is a key frame.
+ */
+typedef enum {
+    RpcGuiStreamModeFull,
+    RpcGuiStreamModeDelta,
+    RpcGuiStreamModeMAX,
+} RpcGuiStreamMode;
+
+typedef enum {
+    RpcGuiStreamFrameKey,
+    RpcGuiStreamFramePages,
+    RpcGuiStreamFrameXorRle,
+} RpcGuiStreamFrame;
+
+#define RPC_GUI_STREAM_PAGE_SIZE         (128u)
+#define RPC_GUI_STREAM_KEYFRAME_INTERVAL (64u)
+#define RPC_GUI_STREAM_FRAME_HEADER_SIZE (1u)
+#define RPC_GUI_STREAM_CONTROL_SIZE      (1u)
+
 typedef struct {
     RpcSession* session;
     Gui* gui;
@@ -64,6 +99,24 @@ typedef struct {
     // Transmit
     PB_Main* transmit_frame;
     FuriThread* transmit_thread;
+    FuriMutex* transmit_mutex;
+    size_t framebuffer_size;
+
+    // Guarded by transmit_mutex
+    uint8_t* frame_pending;
+    CanvasOrientation frame_pending_orientation;
+    bool frame_pending_valid;
+    bool stream_mode_requested;
+    RpcGuiStreamMode stream_mode_request;
+    uint32_t stream_mode_command_id;
+
+    // Owned by the transmit thread while streaming
+    uint8_t* frame_current;
+    uint8_t* frame_previous;
+    CanvasOrientation frame_previous_orientation;
+    bool frame_previous_valid;
+    size_t frames_since_key;
+    RpcGuiStreamMode stream_mode;
 
     bool virtual_display_not_empty;
     bool is_streaming;
@@ -90,17 +143,131 @@ static void rpc_system_gui_screen_stream_frame_callback(
     furi_assert(context);
 
     RpcGuiSystem* rpc_gui = (RpcGuiSystem*)context;
-    uint8_t* buffer = rpc_gui->transmit_frame->content.gui_screen_frame.data->bytes;
 
-    furi_assert(size == rpc_gui->transmit_frame->content.gui_screen_frame.data->size);
+    furi_assert(size == rpc_gui->framebuffer_size);
 
-    memcpy(buffer, data, size);
-    rpc_gui->transmit_frame->content.gui_screen_frame.orientation =
-        rpc_system_gui_screen_orientation_map[orientation];
+    // Overwrite the frame that has not been picked up yet, if any
+    furi_check(furi_mutex_acquire(rpc_gui->transmit_mutex, FuriWaitForever) == FuriStatusOk);
+    memcpy(rpc_gui->frame_pending, data, size);
+    rpc_gui->frame_pending_orientation = orientation;
+    rpc_gui->frame_pending_valid = true;
+    furi_check(furi_mutex_release(rpc_gui->transmit_mutex) == FuriStatusOk);
 
     furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagTransmit);
 }
 
+// Returns a bit mask of changed pages
+static uint32_t rpc_system_gui_screen_stream_compare_pages(
+    const uint8_t* frame,
+    const uint8_t* previous,
+    size_t size) {
+    const size_t page_count = size / RPC_GUI_STREAM_PAGE_SIZE;
+    furi_assert(page_count <= 32);
+
+    uint32_t mask = 0;
+    for(size_t page = 0; page < page_count; page++) {
+        const size_t offset = page * RPC_GUI_STREAM_PAGE_SIZE;
+        if(memcmp(&frame[offset], &previous[offset], RPC_GUI_STREAM_PAGE_SIZE) != 0) {
+            mask |= 1UL << page;
+        }
+    }
+
+    return mask;
+}
+
+// Returns 0 if the encoded frame doesn't fit into out_size
+static size_t rpc_system_gui_screen_stream_encode_xor_rle(
+    const uint8_t* frame,
+    const uint8_t* previous,
+    size_t size,
+    uint8_t* out,
+    size_t out_size) {
+    size_t out_len = 0;
+    size_t i = 0;
+
+    while(i < size) {
+        size_t unchanged = 0;
+        while(i < size && frame[i] == previous[i] && unchanged < UINT8_MAX) {
+            unchanged++;
+            i++;
+        }
+        if(i == size) break;
+
+        const size_t start = i;
+        size_t changed = 0;
+        while(i < size && frame[i] != previous[i] && changed < UINT8_MAX) {
+            changed++;
+            i++;
+        }
+
+        if(out_len + 2 + changed > out_size) return 0;
+        out[out_len++] = unchanged;
+        out[out_len++] = changed;
+        for(size_t j = start; j < i; j++) {
+            out[out_len++] = frame[j] ^ previous[j];
+        }
+    }
+
+    return out_len;
+}
+
+// Fills transmit_frame data, returns false if there is nothing to send
+static bool rpc_system_gui_screen_stream_encode(RpcGuiSystem* rpc_gui, bool key) {
+    pb_bytes_array_t* data = rpc_gui->transmit_frame->content.gui_screen_frame.data;
+    const uint8_t* frame = rpc_gui->frame_current;
+    const uint8_t* previous = rpc_gui->frame_previous;
+    const size_t size = rpc_gui->framebuffer_size;
+
+    if(rpc_gui->stream_mode == RpcGuiStreamModeFull) {
+        memcpy(data->bytes, frame, size);
+        data->size = size;
+        return true;
+    }
+
+    uint8_t* payload = &data->bytes[RPC_GUI_STREAM_FRAME_HEADER_SIZE];
+
+    if(!key) {
+        const size_t page_count = size / RPC_GUI_STREAM_PAGE_SIZE;
+        const size_t mask_size = (page_count + 7) / 8;
+        const uint32_t mask = rpc_system_gui_screen_stream_compare_pages(frame, previous, size);
+        if(mask == 0) return false;
+
+        // Use the shortest encoding, XOR RLE gives up once it gets longer than the others
+        const size_t pages_len =
+            mask_size + (size_t)__builtin_popcount(mask) * RPC_GUI_STREAM_PAGE_SIZE;
+        const size_t rle_len = rpc_system_gui_screen_stream_encode_xor_rle(
+            frame, previous, size, payload, MIN(pages_len, size) - 1);
+
+        if(rle_len) {
+            data->bytes[0] = RpcGuiStreamFrameXorRle;
+            data->size = RPC_GUI_STREAM_FRAME_HEADER_SIZE + rle_len;
+            return true;
+        } else if(pages_len < size) {
+            for(size_t i = 0; i < mask_size; i++) {
+                payload[i] = mask >> (i * 8);
+            }
+            uint8_t* page_data = &payload[mask_size];
+            for(size_t page = 0; page < page_count; page++) {
+                if(mask & (1UL << page)) {
+                    memcpy(
+                        page_data,
+                        &frame[page * RPC_GUI_STREAM_PAGE_SIZE],
+                        RPC_GUI_STREAM_PAGE_SIZE);
+                    page_data += RPC_GUI_STREAM_PAGE_SIZE;
+                }
+            }
+            data->bytes[0] = RpcGuiStreamFramePages;
+            data->size = RPC_GUI_STREAM_FRAME_HEADER_SIZE + pages_len;
+            return true;
+        }
+    }
+
+    data->bytes[0] = RpcGuiStreamFrameKey;
+    memcpy(payload, frame, size);
+    data->size = RPC_GUI_STREAM_FRAME_HEADER_SIZE + size;
+    return true;
+}
+
 static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context) {
     furi_assert(context);
 
@@ -112,14 +279,64 @@ static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context)
             furi_thread_flags_wait(RpcGuiWorkerFlagAny, FuriFlagWaitAny, FuriWaitForever);
 
         if(flags & RpcGuiWorkerFlagTransmit) {
-            transmit_time = furi_get_tick();
-            rpc_send(rpc_gui->session, rpc_gui->transmit_frame);
-            transmit_time = furi_get_tick() - transmit_time;
-
-            // Guaranteed bandwidth reserve
-            uint32_t extra_delay = transmit_time / 20;
-            if(extra_delay > 500) extra_delay = 500;
-            if(extra_delay) furi_delay_tick(extra_delay);
+            furi_check(
+                furi_mutex_acquire(rpc_gui->transmit_mutex, FuriWaitForever) == FuriStatusOk);
+            bool mode_requested = rpc_gui->stream_mode_requested;
+            uint32_t mode_command_id = rpc_gui->stream_mode_command_id;
+            rpc_gui->stream_mode_requested = false;
+            bool frame_valid = rpc_gui->frame_pending_valid;
+            CanvasOrientation orientation = rpc_gui->frame_pending_orientation;
+            if(frame_valid) {
+                uint8_t* frame = rpc_gui->frame_pending;
+                rpc_gui->frame_pending = rpc_gui->frame_current;
+                rpc_gui->frame_current = frame;
+                rpc_gui->frame_pending_valid = false;
+            }
+            if(mode_requested) {
+                rpc_gui->stream_mode = rpc_gui->stream_mode_request;
+            }
+            furi_check(furi_mutex_release(rpc_gui->transmit_mutex) == FuriStatusOk);
+
+            if(mode_requested) {
+                // Frames after the response are in the new encoding, starting with a key frame
+                rpc_send_and_release_empty(rpc_gui->session, mode_command_id, PB_CommandStatus_OK);
+                rpc_gui->frames_since_key = RPC_GUI_STREAM_KEYFRAME_INTERVAL;
+                if(!frame_valid && rpc_gui->frame_previous_valid) {
+                    memcpy(
+                        rpc_gui->frame_current,
+                        rpc_gui->frame_previous,
+                        rpc_gui->framebuffer_size);
+                    orientation = rpc_gui->frame_previous_orientation;
+                    frame_valid = true;
+                }
+            }
+
+            if(frame_valid) {
+                bool key = !rpc_gui->frame_previous_valid ||
+                           (rpc_gui->frame_previous_orientation != orientation) ||
+                           (rpc_gui->frames_since_key >= RPC_GUI_STREAM_KEYFRAME_INTERVAL);
+                if(rpc_system_gui_screen_stream_encode(rpc_gui, key)) {
+                    rpc_gui->transmit_frame->content.gui_screen_frame.orientation =
+                        rpc_system_gui_screen_orientation_map[orientation];
+
+                    transmit_time = furi_get_tick();
+                    rpc_send(rpc_gui->session, rpc_gui->transmit_frame);
+                    transmit_time = furi_get_tick() - transmit_time;
+
+                    rpc_gui->frames_since_key = key ? 1 : rpc_gui->frames_since_key + 1;
+
+                    uint8_t* frame = rpc_gui->frame_previous;
+                    rpc_gui->frame_previous = rpc_gui->frame_current;
+                    rpc_gui->frame_current = frame;
+                    rpc_gui->frame_previous_orientation = orientation;
+                    rpc_gui->frame_previous_valid = true;
+
+                    // Guaranteed bandwidth reserve
+                    uint32_t extra_delay = transmit_time / 20;
+                    if(extra_delay > 500) extra_delay = 500;
+                    if(extra_delay) furi_delay_tick(extra_delay);
+                }
+            }
         }
 
         if(flags & RpcGuiWorkerFlagExit) {
@@ -130,6 +347,27 @@ static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context)
     return 0;
 }
 
+static void rpc_system_gui_screen_stream_stop(RpcGuiSystem* rpc_gui) {
+    if(!rpc_gui->is_streaming) return;
+
+    rpc_gui->is_streaming = false;
+    // Remove GUI framebuffer callback
+    gui_remove_framebuffer_callback(
+        rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, rpc_gui);
+    // Stop and release worker thread
+    furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
+    furi_thread_join(rpc_gui->transmit_thread);
+    furi_thread_free(rpc_gui->transmit_thread);
+    // Release frames
+    pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
+    free(rpc_gui->transmit_frame);
+    rpc_gui->transmit_frame = NULL;
+    furi_mutex_free(rpc_gui->transmit_mutex);
+    free(rpc_gui->frame_pending);
+    free(rpc_gui->frame_current);
+    free(rpc_gui->frame_previous);
+}
+
 static void rpc_system_gui_start_screen_stream_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -148,13 +386,21 @@ static void rpc_system_gui_start_screen_stream_process(const PB_Main* request, v
 
         rpc_gui->is_streaming = true;
         size_t framebuffer_size = gui_get_framebuffer_size(rpc_gui->gui);
-        // Reusable Frame
+        rpc_gui->framebuffer_size = framebuffer_size;
+        // Reusable Frame, large enough for a delta mode key frame
         rpc_gui->transmit_frame = malloc(sizeof(PB_Main));
         rpc_gui->transmit_frame->which_content = PB_Main_gui_screen_frame_tag;
         rpc_gui->transmit_frame->command_status = PB_CommandStatus_OK;
-        rpc_gui->transmit_frame->content.gui_screen_frame.data =
-            malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(framebuffer_size));
+        rpc_gui->transmit_frame->content.gui_screen_frame.data = malloc(
+            PB_BYTES_ARRAY_T_ALLOCSIZE(RPC_GUI_STREAM_FRAME_HEADER_SIZE + framebuffer_size));
         rpc_gui->transmit_frame->content.gui_screen_frame.data->size = framebuffer_size;
+        // Frames passed from GUI to the transmission thread
+        rpc_gui->transmit_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+        rpc_gui->frame_pending = malloc(framebuffer_size);
+        rpc_gui->frame_pending_valid = false;
+        rpc_gui->frame_current = malloc(framebuffer_size);
+        rpc_gui->frame_previous = malloc(framebuffer_size);
+        rpc_gui->frame_previous_valid = false;
         // Transmission thread for async TX
         rpc_gui->transmit_thread = furi_thread_alloc_ex(
             "GuiRpcWorker", 1024, rpc_system_gui_screen_stream_frame_transmit_thread, rpc_gui);
@@ -175,24 +421,44 @@ static void rpc_system_gui_stop_screen_stream_process(const PB_Main* request, vo
     RpcSession* session = rpc_gui->session;
     furi_assert(session);
 
-    if(rpc_gui->is_streaming) {
-        rpc_gui->is_streaming = false;
-        // Remove GUI framebuffer callback
-        gui_remove_framebuffer_callback(
-            rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
-        // Stop and release worker thread
-        furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
-        furi_thread_join(rpc_gui->transmit_thread);
-        furi_thread_free(rpc_gui->transmit_thread);
-        // Release frame
-        pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
-        free(rpc_gui->transmit_frame);
-        rpc_gui->transmit_frame = NULL;
-    }
+    rpc_system_gui_screen_stream_stop(rpc_gui);
 
     rpc_send_and_release_empty(session, request->command_id, PB_CommandStatus_OK);
 }
 
+static void rpc_system_gui_screen_stream_control_process(const PB_Main* request, void* context) {
+    furi_assert(request);
+    furi_assert(context);
+
+    FURI_LOG_D(TAG, "ScreenStreamControl");
+
+    RpcGuiSystem* rpc_gui = context;
+    RpcSession* session = rpc_gui->session;
+    furi_assert(session);
+
+    const pb_bytes_array_t* data = request->content.gui_screen_frame.data;
+    if(!data || data->size != RPC_GUI_STREAM_CONTROL_SIZE ||
+       data->bytes[0] >= RpcGuiStreamModeMAX) {
+        rpc_send_and_release_empty(
+            session, request->command_id, PB_CommandStatus_ERROR_INVALID_PARAMETERS);
+        return;
+    }
+
+    if(rpc_gui->is_streaming) {
+        // Transmission thread switches the encoding between frames and responds
+        furi_check(furi_mutex_acquire(rpc_gui->transmit_mutex, FuriWaitForever) == FuriStatusOk);
+        rpc_gui->stream_mode_request = data->bytes[0];
+        rpc_gui->stream_mode_command_id = request->command_id;
+        rpc_gui->stream_mode_requested = true;
+        furi_check(furi_mutex_release(rpc_gui->transmit_mutex) == FuriStatusOk);
+        furi_thread_flags_set(
+            furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagTransmit);
+    } else {
+        rpc_gui->stream_mode = data->bytes[0];
+        rpc_send_and_release_empty(session, request->command_id, PB_CommandStatus_OK);
+    }
+}
+
 static void
     rpc_system_gui_send_input_event_request_process(const PB_Main* request, void* context) {
     furi_assert(request);
@@ -235,7 +501,7 @@ static void
     }
 
     // Submit event
-    furi_pubsub_publish(rpc_gui->input_events, &event);
+    furi_pubsub_publish_event(rpc_gui->input_events, &event, INPUT_TYPE_MASK(event.type));
     rpc_send_and_release_empty(session, request->command_id, PB_CommandStatus_OK);
 }
 
@@ -363,12 +629,19 @@ static void rpc_system_gui_virtual_display_frame_process(const PB_Main* request,
     RpcSession* session = rpc_gui->session;
     furi_assert(session);
 
+    // Frames of any other size control the screen stream
+    size_t buffer_size = canvas_get_buffer_size(rpc_gui->gui->canvas);
+    const pb_bytes_array_t* data = request->content.gui_screen_frame.data;
+    if(!data || data->size != buffer_size) {
+        rpc_system_gui_screen_stream_control_process(request, context);
+        return;
+    }
+
     if(!rpc_gui->virtual_display_view_port) {
         FURI_LOG_W(TAG, "Virtual display is not started, ignoring incoming frame packet");
         return;
     }
 
-    size_t buffer_size = canvas_get_buffer_size(rpc_gui->gui->canvas);
     memcpy(
         rpc_gui->virtual_display_buffer,
         request->content.gui_screen_frame.data->bytes,
@@ -455,7 +728,7 @@ void rpc_system_gui_free(void* context) {
                 .sequence_source = INPUT_SEQUENCE_SOURCE_SOFTWARE,
                 .sequence_counter = rpc_gui->input_key_counter[key],
             };
-            furi_pubsub_publish(rpc_gui->input_events, &event);
+            furi_pubsub_publish_event(rpc_gui->input_events, &event, INPUT_TYPE_MASK(event.type));
         }
     }
 
@@ -472,20 +745,8 @@ void rpc_system_gui_free(void* context) {
         view_port_free(rpc_gui->rpc_session_active_viewport);
     }
 
-    if(rpc_gui->is_streaming) {
-        rpc_gui->is_streaming = false;
-        // Remove GUI framebuffer callback
-        gui_remove_framebuffer_callback(
-            rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
-        // Stop and release worker thread
-        furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
-        furi_thread_join(rpc_gui->transmit_thread);
-        furi_thread_free(rpc_gui->transmit_thread);
-        // Release frame
-        pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
-        free(rpc_gui->transmit_frame);
-        rpc_gui->transmit_frame = NULL;
-    }
+    rpc_system_gui_screen_stream_stop(rpc_gui);
+
     furi_record_close(RECORD_INPUT_EVENTS);
     furi_record_close(RECORD_GUI);
     free(rpc_gui);
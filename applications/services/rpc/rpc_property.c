@@ -3,6 +3,10 @@
 #include <furi_hal_info.h>
 #include <furi_hal_power.h>
 #include <core/core_defines.h>
+#include <toolbox/heap_info.h>
+#include <toolbox/profiler.h>
+#include <toolbox/thread_info.h>
+#include <gui/gui_i.h>
 
 #include "rpc_i.h"
 
@@ -11,6 +15,10 @@
 #define PROPERTY_CATEGORY_DEVICE_INFO "devinfo"
 #define PROPERTY_CATEGORY_POWER_INFO  "pwrinfo"
 #define PROPERTY_CATEGORY_POWER_DEBUG "pwrdebug"
+#define PROPERTY_CATEGORY_HEAP_INFO   "heapinfo"
+#define PROPERTY_CATEGORY_TRACE       "trace"
+#define PROPERTY_CATEGORY_THREAD_INFO "threadinfo"
+#define PROPERTY_CATEGORY_GUI_INFO    "guiinfo"
 
 typedef struct {
     RpcSession* session;
@@ -81,6 +89,16 @@ static void rpc_system_property_get_process(const PB_Main* request, void* contex
         furi_hal_power_info_get(rpc_system_property_get_callback, '.', &property_context);
     } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_POWER_DEBUG)) {
         furi_hal_power_debug_get(rpc_system_property_get_callback, &property_context);
+    } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_HEAP_INFO)) {
+        heap_info_get(rpc_system_property_get_callback, '.', &property_context);
+    } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_TRACE)) {
+        profiler_trace_get(rpc_system_property_get_callback, '.', &property_context);
+    } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_THREAD_INFO)) {
+        thread_info_get(rpc_system_property_get_callback, '.', &property_context);
+    } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_GUI_INFO)) {
+        Gui* gui = furi_record_open(RECORD_GUI);
+        gui_info_get(gui, rpc_system_property_get_callback, '.', &property_context);
+        furi_record_close(RECORD_GUI);
     } else {
         rpc_send_and_release_empty(
             session, request->command_id, PB_CommandStatus_ERROR_INVALID_PARAMETERS);
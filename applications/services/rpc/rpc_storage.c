@@ -1,6 +1,7 @@
 #include <core/common_defines.h>
 #include <core/memmgr.h>
 #include <core/record.h>
+#include <furi_hal_rtc.h>
 #include <rpc/rpc.h>
 #include <rpc/rpc_i.h>
 #include <storage/filesystem_api_defines.h>
@@ -9,6 +10,8 @@
 #include <lib/toolbox/path.h>
 #include <update_util/int_backup.h>
 #include <toolbox/tar/tar_archive.h>
+#include <toolbox/compress.h>
+#include <toolbox/dir_walk.h>
 
 #include <pb_decode.h>
 #include <storage.pb.h>
@@ -18,21 +21,202 @@
 
 #define MAX_NAME_LENGTH 255
 
-static const size_t MAX_DATA_SIZE = 512;
+/* Size of file data in a single read or write message */
+#ifndef RPC_STORAGE_CHUNK_SIZE
+#define RPC_STORAGE_CHUNK_SIZE (512)
+#endif
+
+/* Number of file chunks in flight while the previous ones are sent or received,
+ * must not exceed the number of asynchronous storage requests allowed */
+#ifndef RPC_STORAGE_PIPELINE_WINDOW
+#define RPC_STORAGE_PIPELINE_WINDOW (2)
+#endif
+
+_Static_assert(
+    RPC_STORAGE_PIPELINE_WINDOW <= STORAGE_ASYNC_PENDING_MAX,
+    "RPC storage pipeline window exceeds the number of pending storage requests");
+
+static const size_t MAX_DATA_SIZE = RPC_STORAGE_CHUNK_SIZE;
+
+/* Transfer option appended to the path of read and write requests, data chunks are then
+ * compressed separately with compress_encode(). It can't be a part of a FAT file name,
+ * so older firmware rejects such requests and clients can fall back to raw transfers.
+ * Chunk format is described in documentation/RpcExtensions.md */
+#define RPC_STORAGE_COMPRESSION_SUFFIX "|heatshrink"
+
+/* List option appended to the path, lists the whole subtree with paths relative to it.
+ * Every entry also carries its modification time in data, see documentation/RpcExtensions.md */
+#define RPC_STORAGE_MANIFEST_SUFFIX "|manifest"
+
+/* Number of remembered file checksums, enough for include_md5 listings of a typical folder */
+#define RPC_STORAGE_MD5_CACHE_SIZE  (64)
+#define RPC_STORAGE_MD5_STRING_SIZE (16 * 2 + 1)
+/* Files modified this recently may still change within their timestamp resolution */
+#define RPC_STORAGE_MD5_CACHE_MTIME_GUARD (2)
 
 typedef enum {
     RpcStorageStateIdle = 0,
     RpcStorageStateWriting,
 } RpcStorageState;
 
+typedef struct {
+    StorageBatchOp op;
+    pb_bytes_array_t* data;
+} RpcStorageChunk;
+
+/* File chunks processed by the storage service asynchronously,
+ * in the order they were submitted */
+typedef struct {
+    StorageAsync* async;
+    RpcStorageChunk chunks[RPC_STORAGE_PIPELINE_WINDOW];
+    size_t head;
+    size_t pending;
+} RpcStoragePipeline;
+
+/* Checksum of a file, valid while its size and modification time stay the same */
+typedef struct {
+    FuriString* path;
+    uint64_t size;
+    uint32_t mtime;
+    char md5sum[RPC_STORAGE_MD5_STRING_SIZE];
+} RpcStorageMd5CacheEntry;
+
 typedef struct {
     RpcSession* session;
     Storage* api;
     File* file;
+    RpcStoragePipeline* pipeline;
+    Compress* compress;
+    RpcStorageMd5CacheEntry* md5_cache;
+    size_t md5_cache_next;
     RpcStorageState state;
     uint32_t current_command_id;
 } RpcStorageSystem;
 
+static RpcStoragePipeline* rpc_system_storage_pipeline_alloc(Storage* api) {
+    RpcStoragePipeline* pipeline = malloc(sizeof(RpcStoragePipeline));
+    pipeline->async = storage_async_alloc(api, NULL);
+
+    for(size_t i = 0; i < RPC_STORAGE_PIPELINE_WINDOW; ++i) {
+        pipeline->chunks[i].data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(MAX_DATA_SIZE));
+    }
+
+    return pipeline;
+}
+
+static void rpc_system_storage_pipeline_free(RpcStoragePipeline* pipeline) {
+    // Waits for the chunks still in flight
+    storage_async_free(pipeline->async);
+
+    for(size_t i = 0; i < RPC_STORAGE_PIPELINE_WINDOW; ++i) {
+        free(pipeline->chunks[i].data);
+    }
+
+    free(pipeline);
+}
+
+static bool rpc_system_storage_pipeline_is_full(RpcStoragePipeline* pipeline) {
+    return pipeline->pending == RPC_STORAGE_PIPELINE_WINDOW;
+}
+
+/* Get the chunk to be filled before submitting it */
+static RpcStorageChunk* rpc_system_storage_pipeline_next(RpcStoragePipeline* pipeline) {
+    furi_assert(!rpc_system_storage_pipeline_is_full(pipeline));
+    return &pipeline->chunks[(pipeline->head + pipeline->pending) % RPC_STORAGE_PIPELINE_WINDOW];
+}
+
+static void rpc_system_storage_pipeline_submit(
+    RpcStoragePipeline* pipeline,
+    StorageBatchOpType type,
+    File* file,
+    size_t size) {
+    RpcStorageChunk* chunk = rpc_system_storage_pipeline_next(pipeline);
+    chunk->op = (StorageBatchOp){
+        .type = type,
+        .file = file,
+        .buffer = chunk->data->bytes,
+        .size = size,
+    };
+
+    furi_check(storage_async_submit(pipeline->async, &chunk->op, 1, false, NULL, NULL));
+    pipeline->pending++;
+}
+
+/* Wait for the oldest chunk in flight */
+static RpcStorageChunk* rpc_system_storage_pipeline_wait(RpcStoragePipeline* pipeline) {
+    furi_assert(pipeline->pending > 0);
+    furi_check(storage_async_dispatch(pipeline->async, FuriWaitForever));
+
+    RpcStorageChunk* chunk = &pipeline->chunks[pipeline->head];
+    pipeline->head = (pipeline->head + 1) % RPC_STORAGE_PIPELINE_WINDOW;
+    pipeline->pending--;
+
+    return chunk;
+}
+
+static bool rpc_system_storage_chunk_is_complete(const RpcStorageChunk* chunk) {
+    return chunk->op.error == FSE_OK && chunk->op.processed == chunk->op.size;
+}
+
+/* Strip a transfer option from a request path */
+static bool rpc_system_storage_path_take_option(FuriString* path, const char* option) {
+    if(!furi_string_end_with(path, option)) {
+        return false;
+    }
+
+    furi_string_left(path, furi_string_size(path) - strlen(option));
+    return true;
+}
+
+/* Calculate md5 of a file, reusing the checksum calculated for the same path,
+ * size and modification time */
+static bool rpc_system_storage_md5_calc(
+    RpcStorageSystem* rpc_storage,
+    File* file,
+    const char* path,
+    const FileInfo* fileinfo,
+    FuriString* md5,
+    FS_Error* file_error) {
+    // Without a modification time there is nothing to tell a rewritten file by
+    if(!fileinfo->mtime) {
+        return md5_string_calc_file(file, path, md5, file_error);
+    }
+
+    if(!rpc_storage->md5_cache) {
+        rpc_storage->md5_cache =
+            malloc(sizeof(RpcStorageMd5CacheEntry) * RPC_STORAGE_MD5_CACHE_SIZE);
+    }
+
+    for(size_t i = 0; i < RPC_STORAGE_MD5_CACHE_SIZE; ++i) {
+        RpcStorageMd5CacheEntry* entry = &rpc_storage->md5_cache[i];
+        if(entry->path && entry->size == fileinfo->size && entry->mtime == fileinfo->mtime &&
+           furi_string_equal_str(entry->path, path)) {
+            furi_string_set(md5, entry->md5sum);
+            if(file_error) *file_error = FSE_OK;
+            return true;
+        }
+    }
+
+    bool result = md5_string_calc_file(file, path, md5, file_error);
+
+    uint32_t now = furi_hal_rtc_get_timestamp();
+    if(result && now >= fileinfo->mtime + RPC_STORAGE_MD5_CACHE_MTIME_GUARD) {
+        RpcStorageMd5CacheEntry* entry = &rpc_storage->md5_cache[rpc_storage->md5_cache_next];
+        rpc_storage->md5_cache_next =
+            (rpc_storage->md5_cache_next + 1) % RPC_STORAGE_MD5_CACHE_SIZE;
+
+        if(!entry->path) {
+            entry->path = furi_string_alloc();
+        }
+        furi_string_set(entry->path, path);
+        entry->size = fileinfo->size;
+        entry->mtime = fileinfo->mtime;
+        snprintf(entry->md5sum, sizeof(entry->md5sum), "%s", furi_string_get_cstr(md5));
+    }
+
+    return result;
+}
+
 static void rpc_system_storage_reset_state(
     RpcStorageSystem* rpc_storage,
     RpcSession* session,
@@ -49,6 +233,12 @@ static void rpc_system_storage_reset_state(
         }
 
         if(rpc_storage->state == RpcStorageStateWriting) {
+            rpc_system_storage_pipeline_free(rpc_storage->pipeline);
+            rpc_storage->pipeline = NULL;
+            if(rpc_storage->compress) {
+                compress_free(rpc_storage->compress);
+                rpc_storage->compress = NULL;
+            }
             storage_file_close(rpc_storage->file);
             storage_file_free(rpc_storage->file);
         }
@@ -249,6 +439,90 @@ static bool rpc_system_storage_list_filter(
     return result;
 }
 
+static void rpc_system_storage_list_manifest(
+    RpcStorageSystem* rpc_storage,
+    const PB_Main* request,
+    FuriString* root) {
+    RpcSession* session = rpc_storage->session;
+    const PB_Storage_ListRequest* list_request = &request->content.storage_list_request;
+
+    PB_Main response = {
+        .command_id = request->command_id,
+        .has_next = false,
+        .which_content = PB_Main_storage_list_response_tag,
+        .command_status = PB_CommandStatus_OK,
+    };
+    PB_Storage_ListResponse* list = &response.content.storage_list_response;
+
+    while(furi_string_size(root) > 1 && furi_string_end_with(root, "/")) {
+        furi_string_left(root, furi_string_size(root) - 1);
+    }
+
+    DirWalk* dir_walk = dir_walk_alloc(rpc_storage->api);
+    File* file = storage_file_alloc(rpc_storage->api);
+    FuriString* path = furi_string_alloc();
+    FuriString* md5 = furi_string_alloc();
+    size_t i = 0;
+
+    if(dir_walk_open(dir_walk, furi_string_get_cstr(root))) {
+        FileInfo fileinfo;
+        DirWalkResult result;
+
+        while((result = dir_walk_read(dir_walk, path, &fileinfo)) == DirWalkOK) {
+            // Names are relative to the root
+            const char* name = furi_string_get_cstr(path) + furi_string_size(root) + 1;
+            if(!rpc_system_storage_list_filter(list_request, &fileinfo, name)) continue;
+
+            if(i == COUNT_OF(list->file)) {
+                list->file_count = i;
+                response.has_next = true;
+                rpc_send_and_release(session, &response);
+                i = 0;
+            }
+
+            PB_Storage_File* entry = &list->file[i++];
+            bool is_dir = file_info_is_dir(&fileinfo);
+            entry->type = is_dir ? PB_Storage_File_FileType_DIR : PB_Storage_File_FileType_FILE;
+            entry->size = fileinfo.size;
+            entry->name = strdup(name);
+            entry->md5sum[0] = '\0';
+
+            // Modification time, little endian
+            entry->data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(sizeof(uint32_t)));
+            entry->data->size = sizeof(uint32_t);
+            memcpy(entry->data->bytes, &fileinfo.mtime, sizeof(uint32_t));
+
+            if(list_request->include_md5 && !is_dir &&
+               rpc_system_storage_md5_calc(
+                   rpc_storage, file, furi_string_get_cstr(path), &fileinfo, md5, NULL)) {
+                snprintf(entry->md5sum, sizeof(entry->md5sum), "%s", furi_string_get_cstr(md5));
+            }
+        }
+
+        if(result == DirWalkError) {
+            response.command_status = rpc_system_storage_get_error(dir_walk_get_error(dir_walk));
+        }
+    } else {
+        response.command_status = rpc_system_storage_get_error(dir_walk_get_error(dir_walk));
+    }
+
+    list->file_count = i;
+    if(response.command_status == PB_CommandStatus_OK) {
+        response.has_next = false;
+        rpc_send_and_release(session, &response);
+    } else {
+        // Unfinished batch is dropped, the error ends the stream
+        pb_release(&PB_Main_msg, &response);
+        rpc_send_and_release_empty(session, request->command_id, response.command_status);
+    }
+
+    dir_walk_close(dir_walk);
+    dir_walk_free(dir_walk);
+    storage_file_free(file);
+    furi_string_free(path);
+    furi_string_free(md5);
+}
+
 static void rpc_system_storage_list_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -264,6 +538,14 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
 
     rpc_system_storage_reset_state(rpc_storage, session, true);
 
+    FuriString* manifest_root = furi_string_alloc_set(list_request->path);
+    if(rpc_system_storage_path_take_option(manifest_root, RPC_STORAGE_MANIFEST_SUFFIX)) {
+        rpc_system_storage_list_manifest(rpc_storage, request, manifest_root);
+        furi_string_free(manifest_root);
+        return;
+    }
+    furi_string_free(manifest_root);
+
     if(!strcmp(list_request->path, "/")) {
         rpc_system_storage_list_root(request, context);
         return;
@@ -313,7 +595,13 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
                 if(include_md5 && !file_info_is_dir(&fileinfo)) {
                     furi_string_printf(md5_path, "%s/%s", list_request->path, name); //-V576
 
-                    if(md5_string_calc_file(file, furi_string_get_cstr(md5_path), md5, NULL)) {
+                    if(rpc_system_storage_md5_calc(
+                           rpc_storage,
+                           file,
+                           furi_string_get_cstr(md5_path),
+                           &fileinfo,
+                           md5,
+                           NULL)) {
                         char* md5sum = list->file[i].md5sum;
                         size_t md5sum_size = sizeof(list->file[i].md5sum);
                         snprintf(md5sum, md5sum_size, "%s", furi_string_get_cstr(md5));
@@ -354,58 +642,97 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
 
     rpc_system_storage_reset_state(rpc_storage, session, true);
 
-    /* use same message memory to send response */
-    PB_Main* response = malloc(sizeof(PB_Main));
-    const char* path = request->content.storage_read_request.path;
+    FuriString* path = furi_string_alloc_set(request->content.storage_read_request.path);
+    bool compressed = rpc_system_storage_path_take_option(path, RPC_STORAGE_COMPRESSION_SUFFIX);
+
     File* file = storage_file_alloc(rpc_storage->api);
-    bool fs_operation_success = storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING);
+    bool fs_operation_success =
+        storage_file_open(file, furi_string_get_cstr(path), FSAM_READ, FSOM_OPEN_EXISTING);
+    PB_CommandStatus command_status = rpc_system_storage_get_file_error(file);
 
     if(fs_operation_success) {
-        size_t size_left = storage_file_size(file);
+        /* use same message memory to send response */
+        PB_Main* response = malloc(sizeof(PB_Main));
+        RpcStoragePipeline* pipeline = rpc_system_storage_pipeline_alloc(rpc_storage->api);
+        Compress* compress = NULL;
+        pb_bytes_array_t* encoded = NULL;
+        if(compressed) {
+            // Chunk that doesn't compress is stored as is, with a single byte header
+            compress = compress_alloc(CompressTypeHeatshrink, &compress_config_heatshrink_default);
+            encoded = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(MAX_DATA_SIZE + 1));
+        }
+        uint64_t size_left = storage_file_size(file);
+        uint64_t size_to_submit = size_left;
+
         do {
+            // Next chunks are read by the storage service while the current one is sent
+            while(!rpc_system_storage_pipeline_is_full(pipeline) && size_to_submit) {
+                size_t read_size = MIN(size_to_submit, MAX_DATA_SIZE);
+                rpc_system_storage_pipeline_submit(
+                    pipeline, StorageBatchOpTypeFileRead, file, read_size);
+                size_to_submit -= read_size;
+            }
+
             response->command_id = request->command_id;
             response->which_content = PB_Main_storage_read_response_tag;
             response->command_status = PB_CommandStatus_OK;
+            response->content.storage_read_response.has_file = true;
 
-            size_t read_size = MIN(size_left, MAX_DATA_SIZE);
-            if(read_size) {
-                response->content.storage_read_response.has_file = true;
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(read_size));
-                uint8_t* buffer = &response->content.storage_read_response.file.data->bytes[0];
-                uint16_t* read_size_msg = &response->content.storage_read_response.file.data->size;
+            if(size_left) {
+                RpcStorageChunk* chunk = rpc_system_storage_pipeline_wait(pipeline);
+                fs_operation_success = rpc_system_storage_chunk_is_complete(chunk);
+                command_status = rpc_system_storage_get_error(chunk->op.error);
 
-                *read_size_msg = storage_file_read(file, buffer, read_size);
-                size_left -= *read_size_msg;
-                fs_operation_success = (*read_size_msg == read_size);
+                chunk->data->size = chunk->op.processed;
+                size_left -= chunk->op.processed;
 
+                response->content.storage_read_response.file.data = chunk->data;
                 response->has_next = fs_operation_success && (size_left > 0);
             } else {
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(0));
-                response->content.storage_read_response.file.data->size = 0;
-#pragma GCC diagnostic pop
-                response->content.storage_read_response.has_file = true;
+                // Empty file still gets a response with empty data
+                pb_bytes_array_t* data = rpc_system_storage_pipeline_next(pipeline)->data;
+                data->size = 0;
+
+                response->content.storage_read_response.file.data = data;
                 response->has_next = false;
-                fs_operation_success = true;
+            }
+
+            // Empty data is encoded too, so every compressed response starts with a header
+            if(fs_operation_success && compress) {
+                pb_bytes_array_t* data = response->content.storage_read_response.file.data;
+                size_t encoded_size = 0;
+                furi_check(compress_encode(
+                    compress,
+                    data->bytes,
+                    data->size,
+                    encoded->bytes,
+                    MAX_DATA_SIZE + 1,
+                    &encoded_size));
+                encoded->size = encoded_size;
+                response->content.storage_read_response.file.data = encoded;
             }
 
             if(fs_operation_success) {
-                rpc_send_and_release(session, response);
+                // Data buffers are owned by the pipeline, so the message isn't released
+                rpc_send(session, response);
             }
         } while((size_left != 0) && fs_operation_success);
+
+        rpc_system_storage_pipeline_free(pipeline);
+        if(compress) {
+            compress_free(compress);
+            free(encoded);
+        }
+        free(response);
     }
 
     if(!fs_operation_success) {
-        rpc_send_and_release_empty(
-            session, request->command_id, rpc_system_storage_get_file_error(file));
+        rpc_send_and_release_empty(session, request->command_id, command_status);
     }
 
-    free(response);
     storage_file_close(file);
     storage_file_free(file);
+    furi_string_free(path);
 }
 
 static void rpc_system_storage_write_process(const PB_Main* request, void* context) {
@@ -436,24 +763,81 @@ static void rpc_system_storage_write_process(const PB_Main* request, void* conte
 
     if(rpc_storage->state != RpcStorageStateWriting) {
         rpc_storage->file = storage_file_alloc(rpc_storage->api);
+        rpc_storage->pipeline = rpc_system_storage_pipeline_alloc(rpc_storage->api);
         rpc_storage->current_command_id = request->command_id;
         rpc_storage->state = RpcStorageStateWriting;
-        const char* path = request->content.storage_write_request.path;
-        fs_operation_success =
-            storage_file_open(rpc_storage->file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS);
+
+        FuriString* path = furi_string_alloc_set(request->content.storage_write_request.path);
+        if(rpc_system_storage_path_take_option(path, RPC_STORAGE_COMPRESSION_SUFFIX)) {
+            rpc_storage->compress =
+                compress_alloc(CompressTypeHeatshrink, &compress_config_heatshrink_default);
+        }
+
+        fs_operation_success = storage_file_open(
+            rpc_storage->file, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_ALWAYS);
+        furi_string_free(path);
     }
 
     File* file = rpc_storage->file;
+    RpcStoragePipeline* pipeline = rpc_storage->pipeline;
+    FS_Error fs_error = storage_file_get_error(file);
     bool send_response = false;
 
     if(fs_operation_success) {
-        if(request->content.storage_write_request.has_file &&
-           request->content.storage_write_request.file.data &&
-           request->content.storage_write_request.file.data->size) {
-            uint8_t* buffer = request->content.storage_write_request.file.data->bytes;
-            size_t buffer_size = request->content.storage_write_request.file.data->size;
-            size_t written_size = storage_file_write(file, buffer, buffer_size);
-            fs_operation_success = (written_size == buffer_size);
+        pb_bytes_array_t* data = request->content.storage_write_request.file.data;
+        size_t size_left = 0;
+        size_t offset = 0;
+
+        if(request->content.storage_write_request.has_file && data) {
+            size_left = data->size;
+        }
+
+        // Chunks are written by the storage service while the next ones are received
+        while(fs_operation_success && size_left) {
+            if(rpc_system_storage_pipeline_is_full(pipeline)) {
+                RpcStorageChunk* chunk = rpc_system_storage_pipeline_wait(pipeline);
+                fs_operation_success = rpc_system_storage_chunk_is_complete(chunk);
+                fs_error = chunk->op.error;
+            }
+
+            if(fs_operation_success) {
+                RpcStorageChunk* chunk = rpc_system_storage_pipeline_next(pipeline);
+                size_t write_size = 0;
+
+                if(rpc_storage->compress) {
+                    // Every message carries a separately compressed chunk
+                    fs_operation_success = compress_decode(
+                        rpc_storage->compress,
+                        data->bytes,
+                        size_left,
+                        chunk->data->bytes,
+                        MAX_DATA_SIZE,
+                        &write_size);
+                    if(!fs_operation_success) {
+                        fs_error = FSE_INVALID_PARAMETER;
+                    }
+                    size_left = 0;
+                } else {
+                    write_size = MIN(size_left, MAX_DATA_SIZE);
+                    memcpy(chunk->data->bytes, &data->bytes[offset], write_size);
+                    offset += write_size;
+                    size_left -= write_size;
+                }
+
+                if(fs_operation_success && write_size) {
+                    rpc_system_storage_pipeline_submit(
+                        pipeline, StorageBatchOpTypeFileWrite, file, write_size);
+                }
+            }
+        }
+
+        // Last chunk is acknowledged once everything is written
+        if(!request->has_next) {
+            while(fs_operation_success && pipeline->pending) {
+                RpcStorageChunk* chunk = rpc_system_storage_pipeline_wait(pipeline);
+                fs_operation_success = rpc_system_storage_chunk_is_complete(chunk);
+                fs_error = chunk->op.error;
+            }
         }
 
         send_response = !request->has_next;
@@ -462,7 +846,7 @@ static void rpc_system_storage_write_process(const PB_Main* request, void* conte
     PB_CommandStatus command_status = PB_CommandStatus_OK;
     if(!fs_operation_success) {
         send_response = true;
-        command_status = rpc_system_storage_get_file_error(file);
+        command_status = rpc_system_storage_get_error(fs_error);
         if(command_status == PB_CommandStatus_OK) {
             // Report errors not handled by underlying APIs
             command_status = PB_CommandStatus_ERROR_STORAGE_INTERNAL;
@@ -591,8 +975,18 @@ static void rpc_system_storage_md5sum_process(const PB_Main* request, void* cont
     File* file = storage_file_alloc(rpc_storage->api);
     FuriString* md5 = furi_string_alloc();
     FS_Error file_error;
+    FileInfo fileinfo;
 
-    if(md5_string_calc_file(file, filename, md5, &file_error)) {
+    bool result = false;
+    if(storage_common_stat(rpc_storage->api, filename, &fileinfo) == FSE_OK) {
+        result = rpc_system_storage_md5_calc(
+            rpc_storage, file, filename, &fileinfo, md5, &file_error);
+    } else {
+        // Let the calculation report the actual error
+        result = md5_string_calc_file(file, filename, md5, &file_error);
+    }
+
+    if(result) {
         PB_Main response = {
             .command_id = request->command_id,
             .command_status = PB_CommandStatus_OK,
@@ -788,6 +1182,15 @@ void rpc_system_storage_free(void* context) {
 
     rpc_system_storage_reset_state(rpc_storage, session, false);
 
+    if(rpc_storage->md5_cache) {
+        for(size_t i = 0; i < RPC_STORAGE_MD5_CACHE_SIZE; ++i) {
+            if(rpc_storage->md5_cache[i].path) {
+                furi_string_free(rpc_storage->md5_cache[i].path);
+            }
+        }
+        free(rpc_storage->md5_cache);
+    }
+
     furi_record_close(RECORD_STORAGE);
     rpc_storage->api = NULL;
     free(rpc_storage);
@@ -42,6 +42,7 @@ Storage* storage_app_alloc(void) {
     }
 
     storage_ext_init(&app->storage[ST_EXT]);
+    app->dir_cache = storage_dir_cache_alloc();
 
     // sd icon gui
     app->sd_gui.enabled = false;
@@ -69,6 +70,7 @@ void storage_tick(Storage* app) {
     if(app->storage[ST_EXT].status == StorageStatusNotReady && app->sd_gui.enabled == true) {
         app->sd_gui.enabled = false;
         view_port_enabled_set(app->sd_gui.view_port, false);
+        storage_dir_cache_reset(app->dir_cache);
 
         FURI_LOG_I(TAG, "SD card unmount");
         StorageEvent event = {.type = StorageEventTypeCardUnmount};
@@ -84,6 +86,7 @@ void storage_tick(Storage* app) {
        app->sd_gui.enabled == false) {
         app->sd_gui.enabled = true;
         view_port_enabled_set(app->sd_gui.view_port, true);
+        storage_dir_cache_reset(app->dir_cache);
 
         if(app->storage[ST_EXT].status == StorageStatusOK) {
             FURI_LOG_I(TAG, "SD card mount");
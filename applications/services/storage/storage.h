@@ -422,6 +422,141 @@ bool storage_common_equivalent_path(Storage* storage, const char* path1, const c
  */
 bool storage_common_is_subdir(Storage* storage, const char* parent, const char* child);
 
+/******************* Batch Functions *******************/
+
+/**
+ * @brief Enumeration of operations that can be submitted in a batch.
+ */
+typedef enum {
+    StorageBatchOpTypeFileOpen, /**< Open a file: uses file, path, access_mode, open_mode. */
+    StorageBatchOpTypeFileClose, /**< Close a file: uses file. */
+    StorageBatchOpTypeFileRead, /**< Read from a file: uses file, buffer, size. */
+    StorageBatchOpTypeFileWrite, /**< Write to a file: uses file, buffer, size. */
+    StorageBatchOpTypeDirOpen, /**< Open a directory: uses file, path. */
+    StorageBatchOpTypeDirClose, /**< Close a directory: uses file. */
+    StorageBatchOpTypeDirRead, /**< Read a directory entry: uses file, fileinfo, buffer (name), size. */
+    StorageBatchOpTypeCommonStat, /**< Get item information: uses path, fileinfo (may be NULL). */
+} StorageBatchOpType;
+
+/**
+ * @brief Single operation in a batch.
+ *
+ * Input fields not used by the operation type are ignored.
+ * Output fields are filled by the storage service.
+ */
+typedef struct {
+    StorageBatchOpType type; /**< Type of the operation. */
+    File* file; /**< File or directory instance. */
+    const char* path; /**< Zero-terminated path string. */
+    FS_AccessMode access_mode; /**< Access mode for StorageBatchOpTypeFileOpen. */
+    FS_OpenMode open_mode; /**< Open mode for StorageBatchOpTypeFileOpen. */
+    FileInfo* fileinfo; /**< Information object for stat and directory read. */
+    void* buffer; /**< Data buffer for read and write, name buffer for directory read. */
+    uint16_t size; /**< Size of the buffer in bytes. */
+    FS_Error error; /**< [out] Operation result. */
+    uint16_t processed; /**< [out] Number of bytes read or written. */
+} StorageBatchOp;
+
+/**
+ * @brief Execute several operations with a single call to the storage service.
+ *
+ * All operations are processed by the storage thread in order, without returning
+ * control to the caller in between. Unlike storage_file_open() and storage_dir_open(),
+ * open operations do not wait for an already open item to be closed and fail with
+ * FSE_ALREADY_OPEN instead.
+ *
+ * @param storage pointer to a storage API instance.
+ * @param ops pointer to an array of operations.
+ * @param ops_count number of operations in the array.
+ * @param stop_on_error stop processing at the first operation that did not return FSE_OK.
+ * @return number of operations that were executed.
+ */
+size_t storage_batch_execute(
+    Storage* storage,
+    StorageBatchOp* ops,
+    size_t ops_count,
+    bool stop_on_error);
+
+/** Maximum number of batches pending on one asynchronous batch execution instance */
+#define STORAGE_ASYNC_PENDING_MAX 8
+
+/** Asynchronous batch execution instance */
+typedef struct StorageAsync StorageAsync;
+
+/**
+ * @brief Asynchronous batch completion callback.
+ *
+ * Called from the event loop thread that was provided to storage_async_alloc(),
+ * or from the thread calling storage_async_dispatch() if there is no event loop.
+ *
+ * @param ops pointer to the array of operations that was submitted.
+ * @param ops_count number of operations in the array.
+ * @param executed number of operations that were executed.
+ * @param context pointer to a user-specified object.
+ */
+typedef void (*StorageAsyncCallback)(
+    StorageBatchOp* ops,
+    size_t ops_count,
+    size_t executed,
+    void* context);
+
+/**
+ * @brief Allocate an asynchronous batch execution instance.
+ *
+ * Completion callbacks are delivered through the given event loop,
+ * must be called from the event loop thread. Without an event loop
+ * completions are delivered by storage_async_dispatch().
+ *
+ * @param storage pointer to a storage API instance.
+ * @param event_loop pointer to the event loop instance to deliver completions to, may be NULL.
+ * @return pointer to the created instance.
+ */
+StorageAsync* storage_async_alloc(Storage* storage, FuriEventLoop* event_loop);
+
+/**
+ * @brief Free an asynchronous batch execution instance.
+ *
+ * Waits for all submitted batches to complete. Callbacks of the batches that were
+ * not delivered yet are not called.
+ *
+ * @param instance pointer to the instance to be freed.
+ */
+void storage_async_free(StorageAsync* instance);
+
+/**
+ * @brief Submit a batch for asynchronous execution.
+ *
+ * The operations array and all buffers referenced by it must stay valid
+ * until the completion callback is called.
+ *
+ * @param instance pointer to an asynchronous batch execution instance.
+ * @param ops pointer to an array of operations.
+ * @param ops_count number of operations in the array.
+ * @param stop_on_error stop processing at the first operation that did not return FSE_OK.
+ * @param callback pointer to the completion callback function.
+ * @param context pointer to a user-specified object (will be passed to the callback).
+ * @return true if the batch was submitted, false if too many batches are pending.
+ */
+bool storage_async_submit(
+    StorageAsync* instance,
+    StorageBatchOp* ops,
+    size_t ops_count,
+    bool stop_on_error,
+    StorageAsyncCallback callback,
+    void* context);
+
+/**
+ * @brief Wait for the next submitted batch to complete and call its callback.
+ *
+ * Batches complete in the order they were submitted.
+ * Only for instances allocated without an event loop.
+ *
+ * @param instance pointer to an asynchronous batch execution instance.
+ * @param timeout maximum time to wait, in ticks.
+ * @return true if a batch was completed, false on timeout or if nothing is pending.
+ */
+bool storage_async_dispatch(StorageAsync* instance, uint32_t timeout);
+
 /******************* Error Functions *******************/
 
 /**
@@ -509,6 +644,19 @@ FS_Error storage_sd_info(Storage* storage, SDInfo* info);
  */
 FS_Error storage_sd_status(Storage* storage);
 
+/**
+ * @brief Get SD card file cache statistics.
+ *
+ * Small sequential reads are served from per-file read-ahead buffers and small writes
+ * are coalesced in per-file write-behind buffers, which are flushed on sync, seek,
+ * truncate and close.
+ *
+ * @param storage pointer to a storage API instance.
+ * @param stats pointer to the statistics object to contain the requested information.
+ * @return FSE_OK if the statistics were successfully received, any other error code on failure.
+ */
+FS_Error storage_sd_cache_stats(Storage* storage, SDCacheStats* stats);
+
 /************ Internal Storage Backup/Restore ************/
 
 typedef void (*StorageNameConverter)(FuriString*);
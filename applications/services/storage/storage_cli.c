@@ -62,6 +62,19 @@ static void storage_cli_info(Cli* cli, FuriString* path, FuriString* args) {
                 sd_info.manufacturing_month,
                 sd_info.manufacturing_year);
         }
+
+        SDCacheStats cache_stats;
+        if(storage_sd_cache_stats(api, &cache_stats) == FSE_OK) {
+            printf(
+                "Cache reads: %lu, hits: %lu, prefetches: %lu\r\n"
+                "Cache writes: %lu, coalesced: %lu, flushes: %lu\r\n",
+                cache_stats.read_requests,
+                cache_stats.read_hits,
+                cache_stats.read_prefetches,
+                cache_stats.write_requests,
+                cache_stats.write_coalesced,
+                cache_stats.write_flushes);
+        }
     } else {
         storage_cli_print_usage();
     }
@@ -0,0 +1,442 @@
+#include "storage_dir_cache.h"
+#include "storage.h"
+#include <string.h>
+
+#define TAG "StorageDirCache"
+
+// Record: flags (1 byte), size (8 bytes), mtime (4 bytes), zero-terminated name
+#define STORAGE_DIR_CACHE_RECORD_HEADER_SIZE \
+    (sizeof(uint8_t) + sizeof(uint64_t) + sizeof(uint32_t))
+#define STORAGE_DIR_CACHE_INITIAL_CAPACITY   256
+
+typedef struct {
+    FuriString* path;
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+    uint32_t last_used;
+    uint32_t references;
+    bool attached;
+} StorageDirCacheListing;
+
+struct StorageDirCacheHandle {
+    StorageDirCacheListing* listing;
+    size_t offset;
+    bool hit;
+    bool recording;
+    char* name;
+    StorageDirCacheHandle* next;
+};
+
+struct StorageDirCache {
+    StorageDirCacheListing* listings[STORAGE_DIR_CACHE_LISTINGS_MAX];
+    size_t size;
+    uint32_t use_counter;
+    StorageDirCacheHandle* recording;
+};
+
+/******************* Listings *******************/
+
+static void storage_dir_cache_record_get(const uint8_t* record, FileInfo* fileinfo) {
+    fileinfo->flags = record[0];
+    memcpy(&fileinfo->size, &record[1], sizeof(uint64_t));
+    memcpy(&fileinfo->mtime, &record[1 + sizeof(uint64_t)], sizeof(uint32_t));
+}
+
+static void storage_dir_cache_record_set(uint8_t* record, const FileInfo* fileinfo) {
+    record[0] = fileinfo->flags;
+    memcpy(&record[1], &fileinfo->size, sizeof(uint64_t));
+    memcpy(&record[1 + sizeof(uint64_t)], &fileinfo->mtime, sizeof(uint32_t));
+}
+
+// FAT names on the SD card are case-insensitive, LittleFS on /int is not
+static bool storage_dir_cache_path_ignores_case(const char* path) {
+    return strncmp(path, STORAGE_EXT_PATH_PREFIX, strlen(STORAGE_EXT_PATH_PREFIX)) == 0;
+}
+
+static bool storage_dir_cache_path_equal(FuriString* path, const char* other, size_t other_size) {
+    const char* cstr = furi_string_get_cstr(path);
+    if(furi_string_size(path) != other_size) return false;
+
+    return storage_dir_cache_path_ignores_case(cstr) ? strncasecmp(cstr, other, other_size) == 0 :
+                                                       strncmp(cstr, other, other_size) == 0;
+}
+
+static size_t storage_dir_cache_path_size(const char* path) {
+    size_t size = strlen(path);
+    while(size > 1 && path[size - 1] == '/') {
+        size--;
+    }
+    return size;
+}
+
+static size_t storage_dir_cache_parent_size(const char* path, size_t path_size) {
+    while(path_size > 0 && path[path_size - 1] != '/') {
+        path_size--;
+    }
+    return path_size ? path_size - 1 : 0;
+}
+
+static bool storage_dir_cache_path_affected(FuriString* path, const char* changed_path) {
+    size_t changed_size = storage_dir_cache_path_size(changed_path);
+    size_t parent_size = storage_dir_cache_parent_size(changed_path, changed_size);
+
+    return storage_dir_cache_path_equal(path, changed_path, changed_size) ||
+           storage_dir_cache_path_equal(path, changed_path, parent_size);
+}
+
+static StorageDirCacheListing* storage_dir_cache_listing_alloc(const char* path, size_t size) {
+    StorageDirCacheListing* listing = malloc(sizeof(StorageDirCacheListing));
+    listing->path = furi_string_alloc();
+    furi_string_set_strn(listing->path, path, size);
+    return listing;
+}
+
+static void storage_dir_cache_listing_free(StorageDirCacheListing* listing) {
+    furi_string_free(listing->path);
+    free(listing->data);
+    free(listing);
+}
+
+static void storage_dir_cache_listing_release(StorageDirCacheListing* listing) {
+    furi_assert(listing->references > 0);
+    listing->references--;
+
+    if(!listing->attached && listing->references == 0) {
+        storage_dir_cache_listing_free(listing);
+    }
+}
+
+static void storage_dir_cache_detach(StorageDirCache* cache, size_t index) {
+    StorageDirCacheListing* listing = cache->listings[index];
+    cache->listings[index] = NULL;
+    cache->size -= listing->size;
+    listing->attached = false;
+
+    // Open directories keep reading detached listings until they are closed
+    if(listing->references == 0) {
+        storage_dir_cache_listing_free(listing);
+    }
+}
+
+static bool storage_dir_cache_listing_find_record(
+    StorageDirCacheListing* listing,
+    const char* name,
+    FileInfo* fileinfo) {
+    size_t offset = 0;
+    bool ignore_case = storage_dir_cache_path_ignores_case(furi_string_get_cstr(listing->path));
+
+    while(offset < listing->size) {
+        const uint8_t* record = &listing->data[offset];
+        const char* record_name = (const char*)&record[STORAGE_DIR_CACHE_RECORD_HEADER_SIZE];
+
+        if(ignore_case ? strcasecmp(record_name, name) == 0 : strcmp(record_name, name) == 0) {
+            if(fileinfo) {
+                storage_dir_cache_record_get(record, fileinfo);
+            }
+            return true;
+        }
+
+        offset += STORAGE_DIR_CACHE_RECORD_HEADER_SIZE + strlen(record_name) + 1;
+    }
+
+    return false;
+}
+
+/******************* Cache *******************/
+
+StorageDirCache* storage_dir_cache_alloc(void) {
+    StorageDirCache* cache = malloc(sizeof(StorageDirCache));
+    return cache;
+}
+
+void storage_dir_cache_free(StorageDirCache* cache) {
+    furi_check(cache);
+    furi_check(cache->recording == NULL);
+
+    storage_dir_cache_reset(cache);
+    free(cache);
+}
+
+void storage_dir_cache_reset(StorageDirCache* cache) {
+    furi_check(cache);
+
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_LISTINGS_MAX; i++) {
+        if(cache->listings[i]) {
+            storage_dir_cache_detach(cache, i);
+        }
+    }
+
+    for(StorageDirCacheHandle* handle = cache->recording; handle; handle = handle->next) {
+        handle->recording = false;
+    }
+}
+
+void storage_dir_cache_invalidate(StorageDirCache* cache, const char* path) {
+    furi_check(cache);
+    furi_check(path);
+
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_LISTINGS_MAX; i++) {
+        if(cache->listings[i] &&
+           storage_dir_cache_path_affected(cache->listings[i]->path, path)) {
+            storage_dir_cache_detach(cache, i);
+        }
+    }
+
+    for(StorageDirCacheHandle* handle = cache->recording; handle; handle = handle->next) {
+        if(storage_dir_cache_path_affected(handle->listing->path, path)) {
+            handle->recording = false;
+        }
+    }
+}
+
+bool storage_dir_cache_stat(StorageDirCache* cache, const char* path, FileInfo* fileinfo) {
+    furi_check(cache);
+    furi_check(path);
+
+    // Leave anything but plain item paths to the filesystem
+    const char* separator = strrchr(path, '/');
+    if(!separator || separator[1] == '\0') return false;
+
+    size_t parent_size = separator - path;
+
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_LISTINGS_MAX; i++) {
+        StorageDirCacheListing* listing = cache->listings[i];
+
+        // Names missing from the listing are not reported as absent: FatFs may still
+        // match them differently, e.g. by a short name, so let it have the final word
+        if(listing && storage_dir_cache_path_equal(listing->path, path, parent_size) &&
+           storage_dir_cache_listing_find_record(listing, separator + 1, fileinfo)) {
+            listing->last_used = ++cache->use_counter;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/******************* Directories *******************/
+
+StorageDirCacheHandle* storage_dir_cache_open(StorageDirCache* cache, const char* path) {
+    furi_check(cache);
+    furi_check(path);
+
+    StorageDirCacheHandle* handle = malloc(sizeof(StorageDirCacheHandle));
+    size_t path_size = storage_dir_cache_path_size(path);
+
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_LISTINGS_MAX; i++) {
+        StorageDirCacheListing* listing = cache->listings[i];
+        if(listing && storage_dir_cache_path_equal(listing->path, path, path_size)) {
+            listing->references++;
+            listing->last_used = ++cache->use_counter;
+            handle->listing = listing;
+            handle->hit = true;
+            return handle;
+        }
+    }
+
+    handle->listing = storage_dir_cache_listing_alloc(path, path_size);
+    handle->recording = true;
+    handle->name = malloc(STORAGE_DIR_CACHE_NAME_SIZE);
+    handle->next = cache->recording;
+    cache->recording = handle;
+
+    return handle;
+}
+
+static void
+    storage_dir_cache_stop_recording(StorageDirCache* cache, StorageDirCacheHandle* handle) {
+    StorageDirCacheHandle** link = &cache->recording;
+    while(*link != handle) {
+        furi_check(*link);
+        link = &(*link)->next;
+    }
+    *link = handle->next;
+
+    if(handle->listing) {
+        storage_dir_cache_listing_free(handle->listing);
+        handle->listing = NULL;
+    }
+
+    free(handle->name);
+    handle->name = NULL;
+    handle->recording = false;
+}
+
+void storage_dir_cache_close(StorageDirCache* cache, StorageDirCacheHandle* handle) {
+    furi_check(cache);
+    furi_check(handle);
+
+    if(handle->hit) {
+        storage_dir_cache_listing_release(handle->listing);
+    } else if(handle->name) {
+        storage_dir_cache_stop_recording(cache, handle);
+    }
+
+    free(handle);
+}
+
+bool storage_dir_cache_is_hit(StorageDirCacheHandle* handle) {
+    furi_check(handle);
+    return handle->hit;
+}
+
+bool storage_dir_cache_read(
+    StorageDirCacheHandle* handle,
+    FileInfo* fileinfo,
+    char* name,
+    uint16_t name_length) {
+    furi_check(handle);
+    furi_check(handle->hit);
+
+    StorageDirCacheListing* listing = handle->listing;
+    if(handle->offset >= listing->size) {
+        return false;
+    }
+
+    const uint8_t* record = &listing->data[handle->offset];
+    const char* record_name = (const char*)&record[STORAGE_DIR_CACHE_RECORD_HEADER_SIZE];
+
+    if(fileinfo) {
+        storage_dir_cache_record_get(record, fileinfo);
+    }
+
+    if(name) {
+        snprintf(name, name_length, "%s", record_name);
+    }
+
+    handle->offset += STORAGE_DIR_CACHE_RECORD_HEADER_SIZE + strlen(record_name) + 1;
+    return true;
+}
+
+void storage_dir_cache_rewind(StorageDirCacheHandle* handle) {
+    furi_check(handle);
+
+    if(handle->hit) {
+        handle->offset = 0;
+    } else if(handle->listing) {
+        // Listing recorded from scratch reflects the current directory state again
+        handle->listing->size = 0;
+        handle->recording = true;
+    }
+}
+
+char* storage_dir_cache_get_name_buffer(StorageDirCacheHandle* handle) {
+    furi_check(handle);
+    return handle->recording ? handle->name : NULL;
+}
+
+void storage_dir_cache_record(
+    StorageDirCache* cache,
+    StorageDirCacheHandle* handle,
+    const FileInfo* fileinfo) {
+    furi_check(cache);
+    furi_check(handle);
+    furi_check(fileinfo);
+
+    if(!handle->recording) return;
+
+    StorageDirCacheListing* listing = handle->listing;
+    size_t name_size = strnlen(handle->name, STORAGE_DIR_CACHE_NAME_SIZE - 1) + 1;
+    size_t record_size = STORAGE_DIR_CACHE_RECORD_HEADER_SIZE + name_size;
+    size_t required = listing->size + record_size;
+
+    if(required > STORAGE_DIR_CACHE_SIZE) {
+        // Too large to be cached, keep reading from the filesystem
+        handle->recording = false;
+        return;
+    }
+
+    if(required > listing->capacity) {
+        size_t capacity = MAX(listing->capacity * 2, (size_t)STORAGE_DIR_CACHE_INITIAL_CAPACITY);
+        capacity = MIN(MAX(capacity, required), (size_t)STORAGE_DIR_CACHE_SIZE);
+
+        uint8_t* data = malloc(capacity);
+        if(listing->data) {
+            memcpy(data, listing->data, listing->size);
+            free(listing->data);
+        }
+        listing->data = data;
+        listing->capacity = capacity;
+    }
+
+    uint8_t* record = &listing->data[listing->size];
+    storage_dir_cache_record_set(record, fileinfo);
+    memcpy(&record[STORAGE_DIR_CACHE_RECORD_HEADER_SIZE], handle->name, name_size - 1);
+    record[record_size - 1] = '\0';
+    listing->size = required;
+}
+
+static void storage_dir_cache_attach(StorageDirCache* cache, StorageDirCacheListing* listing) {
+    // Replace the listing recorded by another handle in the meantime
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_LISTINGS_MAX; i++) {
+        StorageDirCacheListing* cached = cache->listings[i];
+        if(cached && storage_dir_cache_path_equal(
+                         cached->path,
+                         furi_string_get_cstr(listing->path),
+                         furi_string_size(listing->path))) {
+            storage_dir_cache_detach(cache, i);
+        }
+    }
+
+    // Evict least recently used listings until there is enough space and a free slot
+    while(true) {
+        size_t free_slot = STORAGE_DIR_CACHE_LISTINGS_MAX;
+        size_t oldest = STORAGE_DIR_CACHE_LISTINGS_MAX;
+
+        for(size_t i = 0; i < STORAGE_DIR_CACHE_LISTINGS_MAX; i++) {
+            if(!cache->listings[i]) {
+                free_slot = i;
+            } else if(
+                oldest == STORAGE_DIR_CACHE_LISTINGS_MAX ||
+                cache->listings[i]->last_used < cache->listings[oldest]->last_used) {
+                oldest = i;
+            }
+        }
+
+        if(free_slot < STORAGE_DIR_CACHE_LISTINGS_MAX &&
+           cache->size + listing->size <= STORAGE_DIR_CACHE_SIZE) {
+            cache->listings[free_slot] = listing;
+            break;
+        }
+
+        furi_check(oldest < STORAGE_DIR_CACHE_LISTINGS_MAX);
+        storage_dir_cache_detach(cache, oldest);
+    }
+
+    // Give back unused capacity
+    if(listing->capacity > listing->size) {
+        uint8_t* data = NULL;
+        if(listing->size) {
+            data = malloc(listing->size);
+            memcpy(data, listing->data, listing->size);
+        }
+        free(listing->data);
+        listing->data = data;
+        listing->capacity = listing->size;
+    }
+
+    cache->size += listing->size;
+    listing->attached = true;
+    listing->last_used = ++cache->use_counter;
+
+    FURI_LOG_D(
+        TAG, "Cached %s: %zu bytes", furi_string_get_cstr(listing->path), listing->size);
+}
+
+void storage_dir_cache_finish(
+    StorageDirCache* cache,
+    StorageDirCacheHandle* handle,
+    bool complete) {
+    furi_check(cache);
+    furi_check(handle);
+
+    if(handle->hit || !handle->name) return;
+
+    if(complete && handle->recording) {
+        storage_dir_cache_attach(cache, handle->listing);
+        handle->listing = NULL;
+    }
+
+    storage_dir_cache_stop_recording(cache, handle);
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include <furi.h>
+#include "filesystem_api_defines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Total size of cached directory entries, in bytes */
+#define STORAGE_DIR_CACHE_SIZE (8 * 1024)
+
+/** Maximum number of cached directories */
+#define STORAGE_DIR_CACHE_LISTINGS_MAX 8
+
+/** Maximum name length of a cached directory entry, including terminator */
+#define STORAGE_DIR_CACHE_NAME_SIZE 256
+
+typedef struct StorageDirCache StorageDirCache;
+
+typedef struct StorageDirCacheHandle StorageDirCacheHandle;
+
+StorageDirCache* storage_dir_cache_alloc(void);
+
+void storage_dir_cache_free(StorageDirCache* cache);
+
+/** Drop all cached listings, used when the card is mounted, unmounted or formatted
+ * @param cache StorageDirCache instance
+ */
+void storage_dir_cache_reset(StorageDirCache* cache);
+
+/** Drop listings affected by a change of an item: the listing of its parent
+ * directory and, for a directory, its own listing
+ * @param cache StorageDirCache instance
+ * @param path full path of the changed item
+ */
+void storage_dir_cache_invalidate(StorageDirCache* cache, const char* path);
+
+/** Get item information from cached listings
+ * @param cache StorageDirCache instance
+ * @param path full path of the item
+ * @param fileinfo item information, may be NULL
+ * @return true if the item was found in the cache
+ */
+bool storage_dir_cache_stat(StorageDirCache* cache, const char* path, FileInfo* fileinfo);
+
+/** Start serving an open directory
+ *
+ * Directory is served from the cache if there is a complete listing for it,
+ * otherwise a listing is recorded while it is read from the filesystem.
+ *
+ * @param cache StorageDirCache instance
+ * @param path full path of the directory
+ * @return handle to be passed to other directory functions
+ */
+StorageDirCacheHandle* storage_dir_cache_open(StorageDirCache* cache, const char* path);
+
+/** Stop serving an open directory
+ * @param cache StorageDirCache instance
+ * @param handle handle returned by storage_dir_cache_open
+ */
+void storage_dir_cache_close(StorageDirCache* cache, StorageDirCacheHandle* handle);
+
+/** Check whether the directory is served from the cache
+ * @param handle handle returned by storage_dir_cache_open
+ * @return true if the filesystem must not be accessed for this directory
+ */
+bool storage_dir_cache_is_hit(StorageDirCacheHandle* handle);
+
+/** Read next entry of a directory served from the cache
+ * @param handle handle returned by storage_dir_cache_open
+ * @param fileinfo entry information, may be NULL
+ * @param name entry name buffer, may be NULL
+ * @param name_length size of the name buffer
+ * @return false if there are no more entries
+ */
+bool storage_dir_cache_read(
+    StorageDirCacheHandle* handle,
+    FileInfo* fileinfo,
+    char* name,
+    uint16_t name_length);
+
+/** Rewind a directory, restarts recording for directories not served from the cache
+ * @param handle handle returned by storage_dir_cache_open
+ */
+void storage_dir_cache_rewind(StorageDirCacheHandle* handle);
+
+/** Get the buffer to read the next filesystem entry name into while recording
+ * @param handle handle returned by storage_dir_cache_open
+ * @return buffer of STORAGE_DIR_CACHE_NAME_SIZE bytes, NULL if not recording
+ */
+char* storage_dir_cache_get_name_buffer(StorageDirCacheHandle* handle);
+
+/** Record an entry read from the filesystem
+ * @param cache StorageDirCache instance
+ * @param handle handle returned by storage_dir_cache_open
+ * @param fileinfo entry information
+ */
+void storage_dir_cache_record(
+    StorageDirCache* cache,
+    StorageDirCacheHandle* handle,
+    const FileInfo* fileinfo);
+
+/** Finish recording, the listing is committed if it is complete and still valid
+ * @param cache StorageDirCache instance
+ * @param handle handle returned by storage_dir_cache_open
+ * @param complete true if the end of the directory was reached, false on error
+ */
+void storage_dir_cache_finish(
+    StorageDirCache* cache,
+    StorageDirCacheHandle* handle,
+    bool complete);
+
+#ifdef __cplusplus
+}
+#endif
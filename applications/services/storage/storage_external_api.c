@@ -11,9 +11,11 @@
 #define MAX_EXT_LEN      16
 #define FILE_BUFFER_SIZE 512
 
+#define STORAGE_API_LOCK_POOL_SIZE 8
+
 #define TAG "StorageApi"
 
-#define S_API_PROLOGUE FuriApiLock lock = api_lock_alloc_locked();
+#define S_API_PROLOGUE FuriApiLock lock = storage_api_lock_acquire();
 
 #define S_FILE_API_PROLOGUE           \
     furi_check(file);                 \
@@ -24,7 +26,8 @@
     furi_check(                                                                      \
         furi_message_queue_put(storage->message_queue, &message, FuriWaitForever) == \
         FuriStatusOk);                                                               \
-    api_lock_wait_unlock_and_free(lock)
+    api_lock_wait_unlock(lock);                                                      \
+    storage_api_lock_release(lock)
 
 #define S_API_MESSAGE(_command)      \
     SAReturn return_data;            \
@@ -50,6 +53,44 @@
 typedef enum {
     StorageEventFlagFileClose = (1 << 0),
 } StorageEventFlag;
+
+/****************** API LOCK POOL ******************/
+
+// Waiting on a lock clears it, so a lock can be reused for the next call right away.
+// Keeping a few of them around saves an allocation and a kernel object setup per call.
+static FuriApiLock storage_api_lock_pool[STORAGE_API_LOCK_POOL_SIZE];
+static size_t storage_api_lock_pool_count = 0;
+
+static FuriApiLock storage_api_lock_acquire(void) {
+    FuriApiLock lock = NULL;
+
+    FURI_CRITICAL_ENTER();
+    if(storage_api_lock_pool_count > 0) {
+        lock = storage_api_lock_pool[--storage_api_lock_pool_count];
+    }
+    FURI_CRITICAL_EXIT();
+
+    if(!lock) {
+        lock = api_lock_alloc_locked();
+    }
+
+    return lock;
+}
+
+static void storage_api_lock_release(FuriApiLock lock) {
+    bool pooled = false;
+
+    FURI_CRITICAL_ENTER();
+    if(storage_api_lock_pool_count < STORAGE_API_LOCK_POOL_SIZE) {
+        storage_api_lock_pool[storage_api_lock_pool_count++] = lock;
+        pooled = true;
+    }
+    FURI_CRITICAL_EXIT();
+
+    if(!pooled) {
+        api_lock_free(lock);
+    }
+}
 /****************** FILE ******************/
 
 static bool storage_file_open_internal(
@@ -847,6 +888,177 @@ bool storage_common_is_subdir(Storage* storage, const char* parent, const char*
     return storage_internal_equivalent_path(storage, parent, child, true);
 }
 
+/****************** BATCH ******************/
+
+size_t storage_batch_execute(
+    Storage* storage,
+    StorageBatchOp* ops,
+    size_t ops_count,
+    bool stop_on_error) {
+    furi_check(storage);
+    furi_check(ops || ops_count == 0);
+
+    if(ops_count == 0) {
+        return 0;
+    }
+
+    S_API_PROLOGUE;
+
+    SAData data = {
+        .batch = {
+            .ops = ops,
+            .ops_count = ops_count,
+            .stop_on_error = stop_on_error,
+            .thread_id = furi_thread_get_current_id(),
+            .completion_queue = NULL,
+            .completion_item = NULL,
+        }};
+
+    S_API_MESSAGE(StorageCommandBatch);
+    S_API_EPILOGUE;
+    return return_data.size_value;
+}
+
+typedef struct {
+    SAData data;
+    SAReturn return_data;
+    StorageAsyncCallback callback;
+    void* context;
+} StorageAsyncRequest;
+
+struct StorageAsync {
+    Storage* storage;
+    FuriEventLoop* event_loop;
+    FuriMessageQueue* completion_queue;
+    size_t pending;
+};
+
+static bool storage_async_complete(StorageAsync* instance, uint32_t timeout) {
+    StorageAsyncRequest* request;
+    if(furi_message_queue_get(instance->completion_queue, &request, timeout) != FuriStatusOk) {
+        return false;
+    }
+
+    furi_assert(instance->pending > 0);
+    instance->pending--;
+
+    if(request->callback) {
+        request->callback(
+            request->data.batch.ops,
+            request->data.batch.ops_count,
+            request->return_data.size_value,
+            request->context);
+    }
+
+    free(request);
+    return true;
+}
+
+static bool storage_async_completion_callback(FuriEventLoopObject* object, void* context) {
+    StorageAsync* instance = context;
+    furi_assert(object == instance->completion_queue);
+
+    furi_check(storage_async_complete(instance, 0));
+    return true;
+}
+
+StorageAsync* storage_async_alloc(Storage* storage, FuriEventLoop* event_loop) {
+    furi_check(storage);
+
+    StorageAsync* instance = malloc(sizeof(StorageAsync));
+    instance->storage = storage;
+    instance->event_loop = event_loop;
+    instance->completion_queue =
+        furi_message_queue_alloc(STORAGE_ASYNC_PENDING_MAX, sizeof(StorageAsyncRequest*));
+
+    if(event_loop) {
+        furi_event_loop_subscribe_message_queue(
+            event_loop,
+            instance->completion_queue,
+            FuriEventLoopEventIn,
+            storage_async_completion_callback,
+            instance);
+    }
+
+    return instance;
+}
+
+void storage_async_free(StorageAsync* instance) {
+    furi_check(instance);
+
+    if(instance->event_loop) {
+        furi_event_loop_unsubscribe(instance->event_loop, instance->completion_queue);
+    }
+
+    // The storage thread still references the queue until all batches are completed
+    while(instance->pending > 0) {
+        StorageAsyncRequest* request;
+        furi_check(
+            furi_message_queue_get(instance->completion_queue, &request, FuriWaitForever) ==
+            FuriStatusOk);
+        free(request);
+        instance->pending--;
+    }
+
+    furi_message_queue_free(instance->completion_queue);
+    free(instance);
+}
+
+bool storage_async_submit(
+    StorageAsync* instance,
+    StorageBatchOp* ops,
+    size_t ops_count,
+    bool stop_on_error,
+    StorageAsyncCallback callback,
+    void* context) {
+    furi_check(instance);
+    furi_check(ops || ops_count == 0);
+
+    // Completion queue must never be full, otherwise the storage thread would block on it
+    if(instance->pending >= STORAGE_ASYNC_PENDING_MAX) {
+        return false;
+    }
+
+    StorageAsyncRequest* request = malloc(sizeof(StorageAsyncRequest));
+    request->callback = callback;
+    request->context = context;
+    request->data.batch = (SADataBatch){
+        .ops = ops,
+        .ops_count = ops_count,
+        .stop_on_error = stop_on_error,
+        .thread_id = furi_thread_get_current_id(),
+        .completion_queue = instance->completion_queue,
+        .completion_item = request,
+    };
+
+    StorageMessage message = {
+        .lock = NULL,
+        .command = StorageCommandBatch,
+        .data = &request->data,
+        .return_data = &request->return_data,
+    };
+
+    instance->pending++;
+
+    Storage* storage = instance->storage;
+    furi_check(
+        furi_message_queue_put(storage->message_queue, &message, FuriWaitForever) ==
+        FuriStatusOk);
+
+    return true;
+}
+
+bool storage_async_dispatch(StorageAsync* instance, uint32_t timeout) {
+    furi_check(instance);
+    furi_check(instance->event_loop == NULL);
+
+    if(instance->pending == 0) {
+        return false;
+    }
+
+    return storage_async_complete(instance, timeout);
+}
+
 /****************** ERROR ******************/
 
 const char* storage_error_get_desc(FS_Error error_id) {
@@ -913,6 +1125,20 @@ FS_Error storage_sd_info(Storage* storage, SDInfo* info) {
     return S_RETURN_ERROR;
 }
 
+FS_Error storage_sd_cache_stats(Storage* storage, SDCacheStats* stats) {
+    furi_check(storage);
+    furi_check(stats);
+
+    S_API_PROLOGUE;
+    SAData data = {
+        .sdcachestats = {
+            .stats = stats,
+        }};
+    S_API_MESSAGE(StorageCommandSDCacheStats);
+    S_API_EPILOGUE;
+    return S_RETURN_ERROR;
+}
+
 FS_Error storage_sd_status(Storage* storage) {
     furi_check(storage);
 
@@ -9,18 +9,24 @@ void storage_file_init(StorageFile* obj) {
     obj->file = NULL;
     obj->file_data = NULL;
     obj->path = furi_string_alloc();
+    obj->dir_cache = NULL;
+    obj->write_access = false;
 }
 
 void storage_file_init_set(StorageFile* obj, const StorageFile* src) {
     obj->file = src->file;
     obj->file_data = src->file_data;
     obj->path = furi_string_alloc_set(src->path);
+    obj->dir_cache = src->dir_cache;
+    obj->write_access = src->write_access;
 }
 
 void storage_file_set(StorageFile* obj, const StorageFile* src) { //-V524
     obj->file = src->file;
     obj->file_data = src->file_data;
     furi_string_set(obj->path, src->path);
+    obj->dir_cache = src->dir_cache;
+    obj->write_access = src->write_access;
 }
 
 void storage_file_clear(StorageFile* obj) {
@@ -75,7 +81,7 @@ uint32_t storage_data_get_timestamp(StorageData* storage) {
 
 /****************** storage glue ******************/
 
-static StorageFile* storage_get_file(const File* file, StorageData* storage) {
+StorageFile* storage_get_storage_file(const File* file, StorageData* storage) {
     StorageFile* storage_file_ref = NULL;
 
     StorageFileList_it_t it;
@@ -93,7 +99,7 @@ static StorageFile* storage_get_file(const File* file, StorageData* storage) {
 }
 
 bool storage_has_file(const File* file, StorageData* storage) {
-    return storage_get_file(file, storage) != NULL;
+    return storage_get_storage_file(file, storage) != NULL;
 }
 
 bool storage_path_already_open(FuriString* path, StorageData* storage) {
@@ -115,13 +121,13 @@ bool storage_path_already_open(FuriString* path, StorageData* storage) {
 }
 
 void storage_set_storage_file_data(const File* file, void* file_data, StorageData* storage) {
-    StorageFile* storage_file_ref = storage_get_file(file, storage);
+    StorageFile* storage_file_ref = storage_get_storage_file(file, storage);
     furi_check(storage_file_ref != NULL);
     storage_file_ref->file_data = file_data;
 }
 
 void* storage_get_storage_file_data(const File* file, StorageData* storage) {
-    StorageFile* storage_file_ref = storage_get_file(file, storage);
+    StorageFile* storage_file_ref = storage_get_storage_file(file, storage);
     furi_check(storage_file_ref != NULL);
     return storage_file_ref->file_data;
 }
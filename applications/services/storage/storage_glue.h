@@ -2,6 +2,7 @@
 
 #include <furi.h>
 #include "filesystem_api_internal.h"
+#include "storage_dir_cache.h"
 #include <m-list.h>
 
 #ifdef __cplusplus
@@ -25,6 +26,8 @@ typedef struct {
     File* file;
     void* file_data;
     FuriString* path;
+    StorageDirCacheHandle* dir_cache; /**< directory cache handle of an open directory */
+    bool write_access; /**< file was opened for writing */
 } StorageFile;
 
 typedef enum {
@@ -64,6 +67,7 @@ struct StorageData {
     uint32_t timestamp;
 };
 
+StorageFile* storage_get_storage_file(const File* file, StorageData* storage);
 bool storage_has_file(const File* file, StorageData* storage_data);
 bool storage_path_already_open(FuriString* path, StorageData* storage_data);
 
@@ -23,6 +23,7 @@ typedef struct {
 struct Storage {
     FuriMessageQueue* message_queue;
     StorageData storage[STORAGE_COUNT];
+    StorageDirCache* dir_cache;
     StorageSDGui sd_gui;
     FuriPubSub* pubsub;
 };
@@ -93,6 +93,19 @@ typedef struct {
     SDInfo* info;
 } SAInfo;
 
+typedef struct {
+    SDCacheStats* stats;
+} SACacheStats;
+
+typedef struct {
+    StorageBatchOp* ops;
+    size_t ops_count;
+    bool stop_on_error;
+    FuriThreadId thread_id;
+    FuriMessageQueue* completion_queue;
+    void* completion_item;
+} SADataBatch;
+
 typedef union {
     SADataFOpen fopen;
     SADataFRead fread;
@@ -114,12 +127,16 @@ typedef union {
     SADataPath path;
 
     SAInfo sdinfo;
+    SACacheStats sdcachestats;
+
+    SADataBatch batch;
 } SAData;
 
 typedef union {
     bool bool_value;
     uint16_t uint16_value;
     uint64_t uint64_value;
+    size_t size_value;
     FS_Error error_value;
     const char* cstring_value;
 } SAReturn;
@@ -151,10 +168,12 @@ typedef enum {
     StorageCommandCommonResolvePath,
     StorageCommandSDMount,
     StorageCommandCommonEquivalentPath,
+    StorageCommandBatch,
+    StorageCommandSDCacheStats,
 } StorageCommand;
 
 typedef struct {
-    FuriApiLock lock;
+    FuriApiLock lock; /**< NULL for asynchronous requests */
     StorageCommand command;
     SAData* data;
     SAReturn* return_data;
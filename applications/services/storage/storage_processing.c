@@ -122,6 +122,12 @@ bool storage_process_file_open(
 
             const char* path_cstr_no_vfs = cstr_path_without_vfs_prefix(path);
             FS_CALL(storage, file.open(storage, file, path_cstr_no_vfs, access_mode, open_mode));
+
+            // Creating or writing a file changes the listing of its directory
+            if((access_mode & FSAM_WRITE) || open_mode != FSOM_OPEN_EXISTING) {
+                storage_get_storage_file(file, storage)->write_access = true;
+                storage_dir_cache_invalidate(app->dir_cache, furi_string_get_cstr(path));
+            }
         }
     }
 
@@ -136,6 +142,13 @@ bool storage_process_file_close(Storage* app, File* file) {
         file->error_id = FSE_INVALID_PARAMETER;
     } else {
         FS_CALL(storage, file.close(storage, file));
+
+        // Directory entry of a written file is only updated on sync or close
+        StorageFile* storage_file = storage_get_storage_file(file, storage);
+        if(storage_file->write_access) {
+            storage_dir_cache_invalidate(app->dir_cache, furi_string_get_cstr(storage_file->path));
+        }
+
         storage_pop_storage_file(file, storage);
 
         StorageEvent event = {.type = StorageEventTypeFileClose};
@@ -230,6 +243,9 @@ static bool storage_process_file_sync(Storage* app, File* file) {
     } else {
         storage_data_timestamp(storage);
         FS_CALL(storage, file.sync(storage, file));
+
+        StorageFile* storage_file = storage_get_storage_file(file, storage);
+        storage_dir_cache_invalidate(app->dir_cache, furi_string_get_cstr(storage_file->path));
     }
 
     return ret;
@@ -273,7 +289,22 @@ bool storage_process_dir_open(Storage* app, File* file, FuriString* path) {
             file->error_id = FSE_ALREADY_OPEN;
         } else {
             storage_push_storage_file(file, path, storage);
-            FS_CALL(storage, dir.open(storage, file, cstr_path_without_vfs_prefix(path)));
+
+            StorageDirCacheHandle* dir_cache =
+                storage_dir_cache_open(app->dir_cache, furi_string_get_cstr(path));
+            storage_get_storage_file(file, storage)->dir_cache = dir_cache;
+
+            if(storage_dir_cache_is_hit(dir_cache)) {
+                file->error_id = FSE_OK;
+                ret = true;
+            } else {
+                FS_CALL(storage, dir.open(storage, file, cstr_path_without_vfs_prefix(path)));
+
+                // Nothing to record for a directory that couldn't be opened
+                if(!ret) {
+                    storage_dir_cache_finish(app->dir_cache, dir_cache, false);
+                }
+            }
         }
     }
 
@@ -287,7 +318,17 @@ bool storage_process_dir_close(Storage* app, File* file) {
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
     } else {
-        FS_CALL(storage, dir.close(storage, file));
+        StorageFile* storage_file = storage_get_storage_file(file, storage);
+        StorageDirCacheHandle* dir_cache = storage_file->dir_cache;
+
+        if(storage_dir_cache_is_hit(dir_cache)) {
+            file->error_id = FSE_OK;
+            ret = true;
+        } else {
+            FS_CALL(storage, dir.close(storage, file));
+        }
+
+        storage_dir_cache_close(app->dir_cache, dir_cache);
         storage_pop_storage_file(file, storage);
 
         StorageEvent event = {.type = StorageEventTypeDirClose};
@@ -309,7 +350,30 @@ bool storage_process_dir_read(
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
     } else {
-        FS_CALL(storage, dir.read(storage, file, fileinfo, name, name_length));
+        StorageDirCacheHandle* dir_cache = storage_get_storage_file(file, storage)->dir_cache;
+        char* cache_name = storage_dir_cache_get_name_buffer(dir_cache);
+
+        if(storage_dir_cache_is_hit(dir_cache)) {
+            ret = storage_dir_cache_read(dir_cache, fileinfo, name, name_length);
+            file->error_id = ret ? FSE_OK : FSE_NOT_EXIST;
+        } else if(cache_name) {
+            // Read the full entry to record it, then hand it to the caller
+            FileInfo cache_fileinfo;
+            FS_CALL(
+                storage,
+                dir.read(storage, file, &cache_fileinfo, cache_name, STORAGE_DIR_CACHE_NAME_SIZE));
+
+            if(ret) {
+                storage_dir_cache_record(app->dir_cache, dir_cache, &cache_fileinfo);
+                if(fileinfo) *fileinfo = cache_fileinfo;
+                if(name) snprintf(name, name_length, "%s", cache_name);
+            } else {
+                bool complete = file->error_id == FSE_NOT_EXIST;
+                storage_dir_cache_finish(app->dir_cache, dir_cache, complete);
+            }
+        } else {
+            FS_CALL(storage, dir.read(storage, file, fileinfo, name, name_length));
+        }
     }
 
     return ret;
@@ -322,7 +386,16 @@ bool storage_process_dir_rewind(Storage* app, File* file) {
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
     } else {
-        FS_CALL(storage, dir.rewind(storage, file));
+        StorageDirCacheHandle* dir_cache = storage_get_storage_file(file, storage)->dir_cache;
+
+        if(storage_dir_cache_is_hit(dir_cache)) {
+            file->error_id = FSE_OK;
+            ret = true;
+        } else {
+            FS_CALL(storage, dir.rewind(storage, file));
+        }
+
+        storage_dir_cache_rewind(dir_cache);
     }
 
     return ret;
@@ -347,7 +420,9 @@ static FS_Error storage_process_common_stat(Storage* app, FuriString* path, File
     FS_Error ret = storage_get_data(app, path, &storage);
 
     if(ret == FSE_OK) {
-        FS_CALL(storage, common.stat(storage, cstr_path_without_vfs_prefix(path), fileinfo));
+        if(!storage_dir_cache_stat(app->dir_cache, furi_string_get_cstr(path), fileinfo)) {
+            FS_CALL(storage, common.stat(storage, cstr_path_without_vfs_prefix(path), fileinfo));
+        }
     }
 
     return ret;
@@ -367,6 +442,7 @@ static FS_Error storage_process_common_remove(Storage* app, FuriString* path) {
 
         storage_data_timestamp(storage);
         FS_CALL(storage, common.remove(storage, cstr_path_without_vfs_prefix(path)));
+        storage_dir_cache_invalidate(app->dir_cache, furi_string_get_cstr(path));
     } while(false);
 
     return ret;
@@ -379,6 +455,7 @@ static FS_Error storage_process_common_mkdir(Storage* app, FuriString* path) {
     if(ret == FSE_OK) {
         storage_data_timestamp(storage);
         FS_CALL(storage, common.mkdir(storage, cstr_path_without_vfs_prefix(path)));
+        storage_dir_cache_invalidate(app->dir_cache, furi_string_get_cstr(path));
     }
 
     return ret;
@@ -438,6 +515,7 @@ static FS_Error storage_process_sd_format(Storage* app) {
     } else {
         ret = sd_format_card(&app->storage[ST_EXT]);
         storage_data_timestamp(&app->storage[ST_EXT]);
+        storage_dir_cache_reset(app->dir_cache);
     }
 
     return ret;
@@ -460,6 +538,7 @@ static FS_Error storage_process_sd_unmount(Storage* app) {
 
         sd_unmount_card(storage);
         storage_data_timestamp(storage);
+        storage_dir_cache_reset(app->dir_cache);
     } while(false);
 
     return ret;
@@ -477,6 +556,7 @@ static FS_Error storage_process_sd_mount(Storage* app) {
 
         ret = sd_mount_card(storage, true);
         storage_data_timestamp(storage);
+        storage_dir_cache_reset(app->dir_cache);
     } while(false);
 
     return ret;
@@ -494,6 +574,18 @@ static FS_Error storage_process_sd_info(Storage* app, SDInfo* info) {
     return ret;
 }
 
+static FS_Error storage_process_sd_cache_stats(Storage* app, SDCacheStats* stats) {
+    FS_Error ret = FSE_OK;
+
+    if(storage_data_status(&app->storage[ST_EXT]) == StorageStatusNotReady) {
+        ret = FSE_NOT_READY;
+    } else {
+        ret = sd_cache_stats(&app->storage[ST_EXT], stats);
+    }
+
+    return ret;
+}
+
 static FS_Error storage_process_sd_status(Storage* app) {
     FS_Error ret;
     StorageStatus status = storage_data_status(&app->storage[ST_EXT]);
@@ -567,6 +659,79 @@ void storage_process_alias(
     }
 }
 
+/****************** Batch processing ******************/
+
+static void storage_process_batch_op(Storage* app, StorageBatchOp* op, FuriThreadId thread_id) {
+    FuriString* path = NULL;
+    op->processed = 0;
+
+    switch(op->type) {
+    case StorageBatchOpTypeFileOpen:
+        path = furi_string_alloc_set(op->path);
+        storage_process_alias(app, path, thread_id, true);
+        op->file->type = FileTypeOpenFile;
+        storage_process_file_open(app, op->file, path, op->access_mode, op->open_mode);
+        op->error = op->file->error_id;
+        break;
+    case StorageBatchOpTypeFileClose:
+        storage_process_file_close(app, op->file);
+        op->file->type = FileTypeClosed;
+        op->error = op->file->error_id;
+        break;
+    case StorageBatchOpTypeFileRead:
+        op->processed = storage_process_file_read(app, op->file, op->buffer, op->size);
+        op->error = op->file->error_id;
+        break;
+    case StorageBatchOpTypeFileWrite:
+        op->processed = storage_process_file_write(app, op->file, op->buffer, op->size);
+        op->error = op->file->error_id;
+        break;
+    case StorageBatchOpTypeDirOpen:
+        path = furi_string_alloc_set(op->path);
+        storage_process_alias(app, path, thread_id, true);
+        op->file->type = FileTypeOpenDir;
+        storage_process_dir_open(app, op->file, path);
+        op->error = op->file->error_id;
+        break;
+    case StorageBatchOpTypeDirClose:
+        storage_process_dir_close(app, op->file);
+        op->file->type = FileTypeClosed;
+        op->error = op->file->error_id;
+        break;
+    case StorageBatchOpTypeDirRead:
+        storage_process_dir_read(app, op->file, op->fileinfo, op->buffer, op->size);
+        op->error = op->file->error_id;
+        break;
+    case StorageBatchOpTypeCommonStat:
+        path = furi_string_alloc_set(op->path);
+        storage_process_alias(app, path, thread_id, false);
+        op->error = storage_process_common_stat(app, path, op->fileinfo);
+        break;
+    default:
+        op->error = FSE_INVALID_PARAMETER;
+        break;
+    }
+
+    if(path != NULL) {
+        furi_string_free(path);
+    }
+}
+
+static size_t storage_process_batch(Storage* app, const SADataBatch* batch) {
+    size_t executed = 0;
+
+    while(executed < batch->ops_count) {
+        StorageBatchOp* op = &batch->ops[executed++];
+        storage_process_batch_op(app, op, batch->thread_id);
+
+        if(batch->stop_on_error && op->error != FSE_OK) {
+            break;
+        }
+    }
+
+    return executed;
+}
+
 /****************** API calls processing ******************/
 
 void storage_process_message_internal(Storage* app, StorageMessage* message) {
@@ -720,6 +885,19 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
         break;
     }
 
+    // Batch operations
+    case StorageCommandBatch: {
+        const SADataBatch batch = message->data->batch;
+        message->return_data->size_value = storage_process_batch(app, &batch);
+        // Asynchronous request may be freed by the submitter as soon as it is posted
+        if(batch.completion_queue) {
+            furi_check(
+                furi_message_queue_put(batch.completion_queue, &batch.completion_item, 0) ==
+                FuriStatusOk);
+        }
+        break;
+    }
+
     // SD operations
     case StorageCommandSDFormat:
         message->return_data->error_value = storage_process_sd_format(app);
@@ -737,13 +915,19 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
     case StorageCommandSDStatus:
         message->return_data->error_value = storage_process_sd_status(app);
         break;
+    case StorageCommandSDCacheStats:
+        message->return_data->error_value =
+            storage_process_sd_cache_stats(app, message->data->sdcachestats.stats);
+        break;
     }
 
     if(path != NULL) { //-V547
         furi_string_free(path);
     }
 
-    api_lock_unlock(message->lock);
+    if(message->lock) {
+        api_lock_unlock(message->lock);
+    }
 }
 
 void storage_process_message(Storage* app, StorageMessage* message) {
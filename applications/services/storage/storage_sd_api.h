@@ -34,6 +34,15 @@ typedef struct {
     uint16_t manufacturing_year;
 } SDInfo;
 
+typedef struct {
+    uint32_t read_requests; /**< File read requests */
+    uint32_t read_hits; /**< Read requests fully served from read-ahead buffers */
+    uint32_t read_prefetches; /**< Read-ahead buffer refills */
+    uint32_t write_requests; /**< File write requests */
+    uint32_t write_coalesced; /**< Write requests merged into write-behind buffers */
+    uint32_t write_flushes; /**< Write-behind buffer flushes */
+} SDCacheStats;
+
 const char* sd_api_get_fs_type_text(SDFsType fs_type);
 
 #ifdef __cplusplus
@@ -15,14 +15,40 @@ typedef FRESULT SDError;
 
 #define TAG "StorageExt"
 
+// Read-ahead / write-behind buffer size, must fit into UINT
+#define SD_FILE_CACHE_SIZE (_MAX_SS * 4)
+// Requests of this size and above bypass the buffer
+#define SD_FILE_CACHE_BYPASS_SIZE (SD_FILE_CACHE_SIZE / 2)
+// Number of small reads without a seek in between to consider access sequential
+#define SD_FILE_CACHE_SEQUENTIAL_READS 2
+
 /********************* Definitions ********************/
 
 typedef struct {
     FATFS* fs;
     const char* path;
     bool sd_was_present;
+    SDCacheStats cache_stats;
 } SDData;
 
+/*
+ * Per-file buffer. Depending on the last operation it holds either:
+ * - read-ahead data: [cache_offset, cache_offset + cache_length), the FatFs file pointer
+ *   is at the end of the buffer and the logical position is cache_offset + cache_position;
+ * - write-behind data (cache_dirty): bytes not yet written at cache_offset, the FatFs file
+ *   pointer is at cache_offset and the logical position is cache_offset + cache_length.
+ * Any other operation flushes the buffer first, see storage_ext_file_cache_flush().
+ */
+typedef struct {
+    SDFile file;
+    uint8_t* cache;
+    FSIZE_t cache_offset;
+    uint16_t cache_length;
+    uint16_t cache_position;
+    bool cache_dirty;
+    uint8_t sequential_reads;
+} SDFileData;
+
 static FS_Error storage_ext_parse_error(SDError error);
 
 /******************* Core Functions *******************/
@@ -314,6 +340,12 @@ FS_Error sd_card_info(StorageData* storage, SDInfo* sd_info) {
     return storage_ext_parse_error(error);
 }
 
+FS_Error sd_cache_stats(StorageData* storage, SDCacheStats* stats) {
+    SDData* sd_data = storage->data;
+    *stats = sd_data->cache_stats;
+    return FSE_OK;
+}
+
 static void storage_ext_tick_internal(StorageData* storage, bool notify) {
     SDData* sd_data = storage->data;
 
@@ -387,6 +419,87 @@ static FS_Error storage_ext_parse_error(SDError error) {
 
 /******************* File Functions *******************/
 
+static SDError storage_ext_file_cache_flush(StorageData* storage, SDFileData* file_data) {
+    SDData* sd_data = storage->data;
+    SDError result = FR_OK;
+
+    if(file_data->cache_dirty) {
+#ifndef FURI_RAM_EXEC
+        UINT bytes_written = 0;
+        result =
+            f_write(&file_data->file, file_data->cache, file_data->cache_length, &bytes_written);
+        if(result == FR_OK && bytes_written != file_data->cache_length) {
+            // No space left, report it now since the write call has already succeeded
+            result = FR_DENIED;
+        }
+        sd_data->cache_stats.write_flushes++;
+#endif
+        file_data->cache_dirty = false;
+    } else if(file_data->cache_position < file_data->cache_length) {
+        // Return the file pointer from the end of the read-ahead data to the logical position
+        result = f_lseek(&file_data->file, file_data->cache_offset + file_data->cache_position);
+    }
+
+    file_data->cache_length = 0;
+    file_data->cache_position = 0;
+
+    return result;
+}
+
+static FSIZE_t storage_ext_file_cache_tell(SDFileData* file_data) {
+    if(file_data->cache_dirty) {
+        return file_data->cache_offset + file_data->cache_length;
+    } else if(file_data->cache_length) {
+        return file_data->cache_offset + file_data->cache_position;
+    } else {
+        return f_tell(&file_data->file);
+    }
+}
+
+static FSIZE_t storage_ext_file_cache_size(SDFileData* file_data) {
+    FSIZE_t size = f_size(&file_data->file);
+
+    if(file_data->cache_dirty) {
+        size = MAX(size, file_data->cache_offset + file_data->cache_length);
+    }
+
+    return size;
+}
+
+static uint16_t storage_ext_file_cache_take(SDFileData* file_data, uint8_t* buff, uint16_t size) {
+    uint16_t available = file_data->cache_length - file_data->cache_position;
+    uint16_t taken = MIN(available, size);
+
+    if(taken) {
+        memcpy(buff, &file_data->cache[file_data->cache_position], taken);
+        file_data->cache_position += taken;
+    }
+
+    return taken;
+}
+
+static SDError storage_ext_file_cache_fill(StorageData* storage, SDFileData* file_data) {
+    SDData* sd_data = storage->data;
+
+    if(!file_data->cache) {
+        file_data->cache = malloc(SD_FILE_CACHE_SIZE);
+    }
+
+    // End the buffer at a sector boundary, so that next refills are aligned multi-sector reads
+    FSIZE_t offset = f_tell(&file_data->file);
+    UINT bytes_to_read = SD_FILE_CACHE_SIZE - (offset % _MAX_SS);
+    UINT bytes_read = 0;
+
+    SDError result = f_read(&file_data->file, file_data->cache, bytes_to_read, &bytes_read);
+
+    file_data->cache_offset = offset;
+    file_data->cache_length = bytes_read;
+    file_data->cache_position = 0;
+    sd_data->cache_stats.read_prefetches++;
+
+    return result;
+}
+
 static bool storage_ext_file_open(
     void* ctx,
     File* file,
@@ -404,19 +517,26 @@ static bool storage_ext_file_open(
     if(open_mode & FSOM_CREATE_NEW) _mode |= FA_CREATE_NEW;
     if(open_mode & FSOM_CREATE_ALWAYS) _mode |= FA_CREATE_ALWAYS;
 
-    SDFile* file_data = malloc(sizeof(SDFile));
+    SDFileData* file_data = malloc(sizeof(SDFileData));
     storage_set_storage_file_data(file, file_data, storage);
 
-    file->internal_error_id = f_open(file_data, path, _mode);
+    file->internal_error_id = f_open(&file_data->file, path, _mode);
     file->error_id = storage_ext_parse_error(file->internal_error_id);
     return file->error_id == FSE_OK;
 }
 
 static bool storage_ext_file_close(void* ctx, File* file) {
     StorageData* storage = ctx;
-    SDFile* file_data = storage_get_storage_file_data(file, storage);
-    file->internal_error_id = f_close(file_data);
+    SDFileData* file_data = storage_get_storage_file_data(file, storage);
+
+    SDError cache_result = storage_ext_file_cache_flush(storage, file_data);
+    file->internal_error_id = f_close(&file_data->file);
+    if(file->internal_error_id == FR_OK) {
+        file->internal_error_id = cache_result;
+    }
     file->error_id = storage_ext_parse_error(file->internal_error_id);
+
+    free(file_data->cache);
     free(file_data);
     storage_set_storage_file_data(file, NULL, storage);
     return file->error_id == FSE_OK;
@@ -425,9 +545,50 @@ static bool storage_ext_file_close(void* ctx, File* file) {
 static uint16_t
     storage_ext_file_read(void* ctx, File* file, void* buff, uint16_t const bytes_to_read) {
     StorageData* storage = ctx;
-    SDFile* file_data = storage_get_storage_file_data(file, storage);
+    SDData* sd_data = storage->data;
+    SDFileData* file_data = storage_get_storage_file_data(file, storage);
+    uint8_t* data = buff;
     uint16_t bytes_read = 0;
-    file->internal_error_id = f_read(file_data, buff, bytes_to_read, &bytes_read);
+    SDError result = FR_OK;
+
+    sd_data->cache_stats.read_requests++;
+
+    if(file_data->cache_dirty) {
+        result = storage_ext_file_cache_flush(storage, file_data);
+    } else {
+        bytes_read = storage_ext_file_cache_take(file_data, data, bytes_to_read);
+        if(bytes_read == bytes_to_read) {
+            sd_data->cache_stats.read_hits++;
+        }
+    }
+
+    while(result == FR_OK && bytes_read < bytes_to_read) {
+        // Read-ahead data is consumed, file pointer is at the logical position
+        uint16_t bytes_left = bytes_to_read - bytes_read;
+
+        if(bytes_left >= SD_FILE_CACHE_BYPASS_SIZE ||
+           file_data->sequential_reads < SD_FILE_CACHE_SEQUENTIAL_READS) {
+            // Drop consumed read-ahead data, tell and seek must not take it for the position
+            file_data->cache_length = 0;
+            file_data->cache_position = 0;
+
+            UINT bytes_read_direct = 0;
+            result = f_read(&file_data->file, data + bytes_read, bytes_left, &bytes_read_direct);
+            bytes_read += bytes_read_direct;
+            break;
+        }
+
+        result = storage_ext_file_cache_fill(storage, file_data);
+        if(file_data->cache_length == 0) break;
+        bytes_read += storage_ext_file_cache_take(file_data, data + bytes_read, bytes_left);
+    }
+
+    if(bytes_to_read < SD_FILE_CACHE_BYPASS_SIZE &&
+       file_data->sequential_reads < SD_FILE_CACHE_SEQUENTIAL_READS) {
+        file_data->sequential_reads++;
+    }
+
+    file->internal_error_id = result;
     file->error_id = storage_ext_parse_error(file->internal_error_id);
     return bytes_read;
 }
@@ -442,9 +603,45 @@ static uint16_t
     return FSE_NOT_READY;
 #else
     StorageData* storage = ctx;
-    SDFile* file_data = storage_get_storage_file_data(file, storage);
+    SDData* sd_data = storage->data;
+    SDFileData* file_data = storage_get_storage_file_data(file, storage);
     uint16_t bytes_written = 0;
-    file->internal_error_id = f_write(file_data, buff, bytes_to_write, &bytes_written);
+    SDError result = FR_OK;
+
+    sd_data->cache_stats.write_requests++;
+
+    // Small writes are coalesced, unless the file is read-only and the error must be reported now
+    bool coalesce = (bytes_to_write < SD_FILE_CACHE_BYPASS_SIZE) &&
+                    (file_data->file.flag & FA_WRITE);
+
+    if(!file_data->cache_dirty ||
+       file_data->cache_length + bytes_to_write > SD_FILE_CACHE_SIZE || !coalesce) {
+        result = storage_ext_file_cache_flush(storage, file_data);
+    }
+
+    if(result == FR_OK) {
+        if(coalesce) {
+            if(!file_data->cache) {
+                file_data->cache = malloc(SD_FILE_CACHE_SIZE);
+            }
+
+            if(!file_data->cache_dirty) {
+                file_data->cache_offset = f_tell(&file_data->file);
+                file_data->cache_dirty = true;
+            }
+
+            memcpy(&file_data->cache[file_data->cache_length], buff, bytes_to_write);
+            file_data->cache_length += bytes_to_write;
+            bytes_written = bytes_to_write;
+            sd_data->cache_stats.write_coalesced++;
+        } else {
+            UINT bytes_written_direct = 0;
+            result = f_write(&file_data->file, buff, bytes_to_write, &bytes_written_direct);
+            bytes_written = bytes_written_direct;
+        }
+    }
+
+    file->internal_error_id = result;
     file->error_id = storage_ext_parse_error(file->internal_error_id);
     return bytes_written;
 #endif
@@ -453,14 +650,25 @@ static uint16_t
 static bool
     storage_ext_file_seek(void* ctx, File* file, const uint32_t offset, const bool from_start) {
     StorageData* storage = ctx;
-    SDFile* file_data = storage_get_storage_file_data(file, storage);
+    SDFileData* file_data = storage_get_storage_file_data(file, storage);
 
-    if(from_start) {
-        file->internal_error_id = f_lseek(file_data, offset);
+    FSIZE_t position = offset;
+    if(!from_start) {
+        position += storage_ext_file_cache_tell(file_data);
+    }
+
+    if(!file_data->cache_dirty && file_data->cache_length &&
+       position >= file_data->cache_offset &&
+       position <= file_data->cache_offset + file_data->cache_length) {
+        // Seek inside of the read-ahead data, typical for parsers stepping back a few bytes
+        file_data->cache_position = position - file_data->cache_offset;
+        file->internal_error_id = FR_OK;
     } else {
-        uint64_t position = f_tell(file_data);
-        position += offset;
-        file->internal_error_id = f_lseek(file_data, position);
+        file->internal_error_id = storage_ext_file_cache_flush(storage, file_data);
+        if(file->internal_error_id == FR_OK) {
+            file->internal_error_id = f_lseek(&file_data->file, position);
+        }
+        file_data->sequential_reads = 0;
     }
 
     file->error_id = storage_ext_parse_error(file->internal_error_id);
@@ -469,10 +677,10 @@ static bool
 
 static uint64_t storage_ext_file_tell(void* ctx, File* file) {
     StorageData* storage = ctx;
-    SDFile* file_data = storage_get_storage_file_data(file, storage);
+    SDFileData* file_data = storage_get_storage_file_data(file, storage);
 
     uint64_t position = 0;
-    position = f_tell(file_data);
+    position = storage_ext_file_cache_tell(file_data);
     file->error_id = FSE_OK;
     return position;
 }
@@ -484,9 +692,12 @@ static bool storage_ext_file_truncate(void* ctx, File* file) {
     return FSE_NOT_READY;
 #else
     StorageData* storage = ctx;
-    SDFile* file_data = storage_get_storage_file_data(file, storage);
+    SDFileData* file_data = storage_get_storage_file_data(file, storage);
 
-    file->internal_error_id = f_truncate(file_data);
+    file->internal_error_id = storage_ext_file_cache_flush(storage, file_data);
+    if(file->internal_error_id == FR_OK) {
+        file->internal_error_id = f_truncate(&file_data->file);
+    }
     file->error_id = storage_ext_parse_error(file->internal_error_id);
     return file->error_id == FSE_OK;
 #endif
@@ -499,9 +710,12 @@ static bool storage_ext_file_sync(void* ctx, File* file) {
     return FSE_NOT_READY;
 #else
     StorageData* storage = ctx;
-    SDFile* file_data = storage_get_storage_file_data(file, storage);
+    SDFileData* file_data = storage_get_storage_file_data(file, storage);
 
-    file->internal_error_id = f_sync(file_data);
+    file->internal_error_id = storage_ext_file_cache_flush(storage, file_data);
+    if(file->internal_error_id == FR_OK) {
+        file->internal_error_id = f_sync(&file_data->file);
+    }
     file->error_id = storage_ext_parse_error(file->internal_error_id);
     return file->error_id == FSE_OK;
 #endif
@@ -509,19 +723,19 @@ static bool storage_ext_file_sync(void* ctx, File* file) {
 
 static uint64_t storage_ext_file_size(void* ctx, File* file) {
     StorageData* storage = ctx;
-    SDFile* file_data = storage_get_storage_file_data(file, storage);
+    SDFileData* file_data = storage_get_storage_file_data(file, storage);
 
     uint64_t size = 0;
-    size = f_size(file_data);
+    size = storage_ext_file_cache_size(file_data);
     file->error_id = FSE_OK;
     return size;
 }
 
 static bool storage_ext_file_eof(void* ctx, File* file) {
     StorageData* storage = ctx;
-    SDFile* file_data = storage_get_storage_file_data(file, storage);
+    SDFileData* file_data = storage_get_storage_file_data(file, storage);
 
-    bool eof = f_eof(file_data);
+    bool eof = storage_ext_file_cache_tell(file_data) >= storage_ext_file_cache_size(file_data);
     file->internal_error_id = 0;
     file->error_id = FSE_OK;
     return eof;
@@ -529,6 +743,27 @@ static bool storage_ext_file_eof(void* ctx, File* file) {
 
 /******************* Dir Functions *******************/
 
+// FAT keeps local date and time with a two second resolution, same as the RTC timestamp
+static void storage_ext_fileinfo_set(FileInfo* fileinfo, const SDFileInfo* sd_fileinfo) {
+    fileinfo->size = sd_fileinfo->fsize;
+    fileinfo->flags = 0;
+    fileinfo->mtime = 0;
+
+    if(sd_fileinfo->fattrib & AM_DIR) fileinfo->flags |= FSF_DIRECTORY;
+
+    if(sd_fileinfo->fdate) {
+        DateTime datetime = {
+            .year = (sd_fileinfo->fdate >> 9) + 1980,
+            .month = (sd_fileinfo->fdate >> 5) & 0x0F,
+            .day = sd_fileinfo->fdate & 0x1F,
+            .hour = sd_fileinfo->ftime >> 11,
+            .minute = (sd_fileinfo->ftime >> 5) & 0x3F,
+            .second = (sd_fileinfo->ftime & 0x1F) * 2,
+        };
+        fileinfo->mtime = datetime_datetime_to_timestamp(&datetime);
+    }
+}
+
 static bool storage_ext_dir_open(void* ctx, File* file, const char* path) {
     StorageData* storage = ctx;
 
@@ -558,22 +793,21 @@ static bool storage_ext_dir_read(
     StorageData* storage = ctx;
     SDDir* file_data = storage_get_storage_file_data(file, storage);
 
-    SDFileInfo _fileinfo;
+    // f_readdir leaves the entry untouched on errors
+    SDFileInfo _fileinfo = {0};
     file->internal_error_id = f_readdir(file_data, &_fileinfo);
     file->error_id = storage_ext_parse_error(file->internal_error_id);
 
     if(fileinfo != NULL) {
-        fileinfo->size = _fileinfo.fsize;
-        fileinfo->flags = 0;
-
-        if(_fileinfo.fattrib & AM_DIR) fileinfo->flags |= FSF_DIRECTORY;
+        storage_ext_fileinfo_set(fileinfo, &_fileinfo);
     }
 
     if(name != NULL) {
         snprintf(name, name_length, "%s", _fileinfo.fname);
     }
 
-    if(_fileinfo.fname[0] == 0) {
+    // Empty name marks the end of the directory, not a failure
+    if(file->error_id == FSE_OK && _fileinfo.fname[0] == 0) {
         file->error_id = FSE_NOT_EXIST;
     }
 
@@ -596,10 +830,7 @@ static FS_Error storage_ext_common_stat(void* ctx, const char* path, FileInfo* f
     SDError result = f_stat(path, &_fileinfo);
 
     if(fileinfo != NULL) {
-        fileinfo->size = _fileinfo.fsize;
-        fileinfo->flags = 0;
-
-        if(_fileinfo.fattrib & AM_DIR) fileinfo->flags |= FSF_DIRECTORY;
+        storage_ext_fileinfo_set(fileinfo, &_fileinfo);
     }
 
     return storage_ext_parse_error(result);
@@ -717,6 +948,7 @@ void storage_ext_init(StorageData* storage) {
     sd_data->fs = &fatfs_object;
     sd_data->path = "0:/";
     sd_data->sd_was_present = true;
+    memset(&sd_data->cache_stats, 0, sizeof(SDCacheStats));
 
     storage->data = sd_data;
     storage->api.tick = storage_ext_tick;
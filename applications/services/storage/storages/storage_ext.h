@@ -12,6 +12,7 @@ FS_Error sd_mount_card(StorageData* storage, bool notify);
 FS_Error sd_unmount_card(StorageData* storage);
 FS_Error sd_format_card(StorageData* storage);
 FS_Error sd_card_info(StorageData* storage, SDInfo* sd_info);
+FS_Error sd_cache_stats(StorageData* storage, SDCacheStats* stats);
 #ifdef __cplusplus
 }
 #endif
@@ -314,11 +314,12 @@ static void badusb_print(struct mjs* mjs, bool ln) {
         return;
     }
     bool args_correct = false;
+    mjs_val_t obj_string = MJS_UNDEFINED;
     const char* text_str = NULL;
     size_t text_len = 0;
+    bool text_pinned = false;
     uint32_t delay_val = 0;
     do {
-        mjs_val_t obj_string = MJS_UNDEFINED;
         size_t num_args = mjs_nargs(mjs);
         if(num_args == 1) {
             obj_string = mjs_arg(mjs, 0);
@@ -334,10 +335,13 @@ static void badusb_print(struct mjs* mjs, bool ln) {
             }
         }
 
-        if(!mjs_is_string(obj_string)) {
-            break;
+        if(mjs_is_string(obj_string)) {
+            text_str = mjs_get_string(mjs, &obj_string, &text_len);
+        } else if(mjs_is_typed_array(obj_string)) {
+            // Type characters straight from the JS buffer
+            text_str = mjs_array_buf_pin(mjs, obj_string, &text_len);
+            text_pinned = (text_str != NULL);
         }
-        text_str = mjs_get_string(mjs, &obj_string, &text_len);
         if((text_str == NULL) || (text_len == 0)) {
             break;
         }
@@ -345,6 +349,9 @@ static void badusb_print(struct mjs* mjs, bool ln) {
     } while(0);
 
     if(!args_correct) {
+        if(text_pinned) {
+            mjs_array_buf_unpin(mjs, obj_string);
+        }
         mjs_prepend_errorf(mjs, MJS_BAD_ARGS_ERROR, "");
         mjs_return(mjs, MJS_UNDEFINED);
         return;
@@ -357,11 +364,17 @@ static void badusb_print(struct mjs* mjs, bool ln) {
         if(delay_val > 0) {
             bool need_exit = js_delay_with_flags(mjs, delay_val);
             if(need_exit) {
+                if(text_pinned) {
+                    mjs_array_buf_unpin(mjs, obj_string);
+                }
                 mjs_return(mjs, MJS_UNDEFINED);
                 return;
             }
         }
     }
+    if(text_pinned) {
+        mjs_array_buf_unpin(mjs, obj_string);
+    }
     if(ln) {
         furi_hal_hid_kb_press(HID_KEYBOARD_RETURN);
         furi_hal_hid_kb_release(HID_KEYBOARD_RETURN);
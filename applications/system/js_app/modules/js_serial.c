@@ -6,6 +6,7 @@
 #define TAG "JsSerial"
 
 #define RX_BUF_LEN 2048
+#define TX_BUF_LEN 64
 
 typedef struct {
     bool setup_done;
@@ -29,14 +30,32 @@ static const struct {
 
 ARRAY_DEF(PatternArray, PatternArrayItem, M_POD_OPLIST);
 
-static void
-    js_serial_on_async_rx(FuriHalSerialHandle* handle, FuriHalSerialRxEvent event, void* context) {
+static void js_serial_on_dma_rx(
+    FuriHalSerialHandle* handle,
+    FuriHalSerialRxEvent event,
+    size_t data_len,
+    void* context) {
     JsSerialInst* serial = context;
     furi_assert(serial);
 
-    if(event & FuriHalSerialRxEventData) {
-        uint8_t data = furi_hal_serial_async_rx(handle);
-        furi_stream_buffer_send(serial->rx_stream, &data, 1, 0);
+    if(event & (FuriHalSerialRxEventData | FuriHalSerialRxEventIdle)) {
+        // Copy from the DMA buffer straight into the stream buffer
+        while(data_len) {
+            size_t len = data_len;
+            uint8_t* region = furi_stream_buffer_send_reserve(serial->rx_stream, &len);
+            if(len == 0) {
+                // Stream buffer is full, drop the data
+                uint8_t data[16];
+                len = furi_hal_serial_dma_rx(handle, data, MIN(data_len, sizeof(data)));
+            } else {
+                len = furi_hal_serial_dma_rx(handle, region, len);
+                furi_stream_buffer_send_commit(serial->rx_stream, len);
+            }
+            if(len == 0) {
+                break;
+            }
+            data_len -= len;
+        }
         js_flags_set(serial->mjs, ThreadEventCustomDataRx);
     }
 }
@@ -93,8 +112,7 @@ static void js_serial_setup(struct mjs* mjs) {
     serial->serial_handle = furi_hal_serial_control_acquire(serial_id);
     if(serial->serial_handle) {
         furi_hal_serial_init(serial->serial_handle, baudrate);
-        furi_hal_serial_async_rx_start(
-            serial->serial_handle, js_serial_on_async_rx, serial, false);
+        furi_hal_serial_dma_rx_start(serial->serial_handle, js_serial_on_dma_rx, serial, false);
         serial->setup_done = true;
     }
 }
@@ -130,31 +148,37 @@ static void js_serial_write(struct mjs* mjs) {
             }
             furi_hal_serial_tx(serial->serial_handle, (uint8_t*)&byte_val, 1);
         } else if(mjs_is_array(arg)) {
+            // Check the whole array first, an invalid element must not leave it half sent
             size_t array_len = mjs_array_length(mjs, arg);
             for(size_t i = 0; i < array_len; i++) {
                 mjs_val_t array_arg = mjs_array_get(mjs, arg, i);
-                if(!mjs_is_number(array_arg)) {
-                    args_correct = false;
-                    break;
-                }
-                uint32_t byte_val = mjs_get_int32(mjs, array_arg);
-                if(byte_val > 0xFF) {
+                if(!mjs_is_number(array_arg) || (uint32_t)mjs_get_int32(mjs, array_arg) > 0xFF) {
                     args_correct = false;
                     break;
                 }
-                furi_hal_serial_tx(serial->serial_handle, (uint8_t*)&byte_val, 1);
             }
             if(!args_correct) {
                 break;
             }
-        } else if(mjs_is_typed_array(arg)) {
-            mjs_val_t array_buf = arg;
-            if(mjs_is_data_view(arg)) {
-                array_buf = mjs_dataview_get_buf(mjs, arg);
+
+            uint8_t tx_buf[TX_BUF_LEN];
+            size_t tx_len = 0;
+            for(size_t i = 0; i < array_len; i++) {
+                tx_buf[tx_len++] = mjs_get_int32(mjs, mjs_array_get(mjs, arg, i));
+                if((tx_len == TX_BUF_LEN) || (i == array_len - 1)) {
+                    furi_hal_serial_tx(serial->serial_handle, tx_buf, tx_len);
+                    tx_len = 0;
+                }
             }
+        } else if(mjs_is_typed_array(arg)) {
             size_t len = 0;
-            char* buf = mjs_array_buf_get_ptr(mjs, array_buf, &len);
+            char* buf = mjs_array_buf_pin(mjs, arg, &len);
+            if(buf == NULL) {
+                args_correct = false;
+                break;
+            }
             furi_hal_serial_tx(serial->serial_handle, (uint8_t*)buf, len);
+            mjs_array_buf_unpin(mjs, arg);
         } else {
             args_correct = false;
             break;
@@ -346,6 +370,61 @@ static void js_serial_read_bytes(struct mjs* mjs) {
     free(read_buf);
 }
 
+static void js_serial_read_into(struct mjs* mjs) {
+    mjs_val_t obj_inst = mjs_get(mjs, mjs_get_this(mjs), INST_PROP_NAME, ~0);
+    JsSerialInst* serial = mjs_get_ptr(mjs, obj_inst);
+    furi_assert(serial);
+    if(!serial->setup_done) {
+        mjs_prepend_errorf(mjs, MJS_INTERNAL_ERROR, "Serial is not configured");
+        mjs_return(mjs, MJS_UNDEFINED);
+        return;
+    }
+
+    mjs_val_t buf_arg = MJS_UNDEFINED;
+    uint32_t timeout = FuriWaitForever;
+    bool args_correct = false;
+
+    do {
+        size_t num_args = mjs_nargs(mjs);
+        if((num_args == 0) || (num_args > 2)) {
+            break;
+        }
+        buf_arg = mjs_arg(mjs, 0);
+        if(!mjs_is_typed_array(buf_arg)) {
+            break;
+        }
+        if(num_args == 2) {
+            mjs_val_t timeout_arg = mjs_arg(mjs, 1);
+            if(!mjs_is_number(timeout_arg)) {
+                break;
+            }
+            timeout = mjs_get_int32(mjs, timeout_arg);
+        }
+        args_correct = true;
+    } while(0);
+
+    size_t read_len = 0;
+    char* read_buf = NULL;
+    if(args_correct) {
+        read_buf = mjs_array_buf_pin(mjs, buf_arg, &read_len);
+    }
+
+    if((read_buf == NULL) || (read_len == 0)) {
+        if(read_buf) {
+            mjs_array_buf_unpin(mjs, buf_arg);
+        }
+        mjs_prepend_errorf(mjs, MJS_BAD_ARGS_ERROR, "");
+        mjs_return(mjs, MJS_UNDEFINED);
+        return;
+    }
+
+    // Receive straight into the JS buffer, it is pinned and does not move meanwhile
+    size_t bytes_read = js_serial_receive(serial, read_buf, read_len, timeout);
+    mjs_array_buf_unpin(mjs, buf_arg);
+
+    mjs_return(mjs, mjs_mk_number(mjs, bytes_read));
+}
+
 static bool
     js_serial_expect_parse_string(struct mjs* mjs, mjs_val_t arg, PatternArray_t patterns) {
     size_t str_len = 0;
@@ -583,6 +662,7 @@ static void* js_serial_create(struct mjs* mjs, mjs_val_t* object) {
     mjs_set(mjs, serial_obj, "read", ~0, MJS_MK_FN(js_serial_read));
     mjs_set(mjs, serial_obj, "readln", ~0, MJS_MK_FN(js_serial_readln));
     mjs_set(mjs, serial_obj, "readBytes", ~0, MJS_MK_FN(js_serial_read_bytes));
+    mjs_set(mjs, serial_obj, "readInto", ~0, MJS_MK_FN(js_serial_read_into));
     mjs_set(mjs, serial_obj, "expect", ~0, MJS_MK_FN(js_serial_expect));
     *object = serial_obj;
 
@@ -592,7 +672,7 @@ static void* js_serial_create(struct mjs* mjs, mjs_val_t* object) {
 static void js_serial_destroy(void* inst) {
     JsSerialInst* js_serial = inst;
     if(js_serial->setup_done) {
-        furi_hal_serial_async_rx_stop(js_serial->serial_handle);
+        furi_hal_serial_dma_rx_stop(js_serial->serial_handle);
         furi_hal_serial_deinit(js_serial->serial_handle);
         furi_hal_serial_control_release(js_serial->serial_handle);
         js_serial->serial_handle = NULL;
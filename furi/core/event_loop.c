@@ -66,7 +66,7 @@ FuriEventLoop* furi_event_loop_alloc(void) {
 
     FuriEventLoopTree_init(instance->tree);
     WaitingList_init(instance->waiting_list);
-    TimerList_init(instance->timer_list);
+    TimerHeap_init(instance->timer_heap);
     TimerQueue_init(instance->timer_queue);
     PendingQueue_init(instance->pending_queue);
 
@@ -84,10 +84,11 @@ void furi_event_loop_free(FuriEventLoop* instance) {
     furi_check(instance->state == FuriEventLoopStateStopped);
 
     furi_event_loop_process_timer_queue(instance);
-    furi_check(TimerList_empty_p(instance->timer_list));
+    furi_check(TimerHeap_empty_p(instance->timer_heap));
     furi_check(WaitingList_empty_p(instance->waiting_list));
 
     FuriEventLoopTree_clear(instance->tree);
+    TimerHeap_clear(instance->timer_heap);
     PendingQueue_clear(instance->pending_queue);
 
     uint32_t flags = 0;
@@ -87,8 +87,9 @@ struct FuriEventLoop {
     FuriEventLoopTree_t tree;
     WaitingList_t waiting_list;
 
-    // Active timer list
-    TimerList_t timer_list;
+    // Active timers, binary min-heap ordered by remaining time
+    TimerHeap_t timer_heap;
+    uint32_t timer_sequence;
     // Timer request queue
     TimerQueue_t timer_queue;
     // Pending callback queue
@@ -9,45 +9,125 @@
  * Private functions
  */
 
-static inline uint32_t furi_event_loop_timer_get_elapsed_time(const FuriEventLoopTimer* timer) {
-    return xTaskGetTickCount() - timer->start_time;
+static inline uint32_t
+    furi_event_loop_timer_get_remaining_time_at(const FuriEventLoopTimer* timer, uint32_t now) {
+    const uint32_t elapsed_time = now - timer->start_time;
+    return elapsed_time < timer->interval ? timer->interval - elapsed_time : 0;
 }
 
 static inline uint32_t
     furi_event_loop_timer_get_remaining_time_private(const FuriEventLoopTimer* timer) {
-    const uint32_t elapsed_time = furi_event_loop_timer_get_elapsed_time(timer);
-    return elapsed_time < timer->interval ? timer->interval - elapsed_time : 0;
+    return furi_event_loop_timer_get_remaining_time_at(timer, xTaskGetTickCount());
 }
 
-static inline bool furi_event_loop_timer_is_expired(const FuriEventLoopTimer* timer) {
-    return furi_event_loop_timer_get_elapsed_time(timer) >= timer->interval;
+/*
+ * Active timers are kept in a binary min-heap. Remaining times of all
+ * scheduled timers decrease at the same rate, so the heap order holds
+ * as time passes and comparing them at any single moment is enough.
+ * Timers expiring at the same time keep their scheduling order.
+ */
+
+static inline bool furi_event_loop_timer_heap_less(
+    const FuriEventLoopTimer* a,
+    const FuriEventLoopTimer* b,
+    uint32_t now) {
+    const uint32_t remaining_a = furi_event_loop_timer_get_remaining_time_at(a, now);
+    const uint32_t remaining_b = furi_event_loop_timer_get_remaining_time_at(b, now);
+
+    if(remaining_a != remaining_b) {
+        return remaining_a < remaining_b;
+    }
+
+    return (int32_t)(a->sequence - b->sequence) < 0;
 }
 
-static void furi_event_loop_schedule_timer(FuriEventLoop* instance, FuriEventLoopTimer* timer) {
-    FuriEventLoopTimer* timer_pos = NULL;
+static inline FuriEventLoopTimer*
+    furi_event_loop_timer_heap_get(FuriEventLoop* instance, size_t index) {
+    return *TimerHeap_get(instance->timer_heap, index);
+}
 
-    FURI_CRITICAL_ENTER();
+static inline void furi_event_loop_timer_heap_set(
+    FuriEventLoop* instance,
+    size_t index,
+    FuriEventLoopTimer* timer) {
+    TimerHeap_set_at(instance->timer_heap, index, timer);
+    timer->heap_index = index;
+}
 
-    const uint32_t remaining_time = furi_event_loop_timer_get_remaining_time_private(timer);
+static void
+    furi_event_loop_timer_heap_sift_up(FuriEventLoop* instance, size_t index, uint32_t now) {
+    FuriEventLoopTimer* timer = furi_event_loop_timer_heap_get(instance, index);
 
-    TimerList_it_t it;
-    for(TimerList_it_last(it, instance->timer_list); !TimerList_end_p(it);
-        TimerList_previous(it)) {
-        FuriEventLoopTimer* tmp = TimerList_ref(it);
-        if(remaining_time >= furi_event_loop_timer_get_remaining_time_private(tmp)) {
-            timer_pos = tmp;
-            break;
+    while(index > 0) {
+        const size_t parent_index = (index - 1) / 2;
+        FuriEventLoopTimer* parent = furi_event_loop_timer_heap_get(instance, parent_index);
+        if(!furi_event_loop_timer_heap_less(timer, parent, now)) break;
+
+        furi_event_loop_timer_heap_set(instance, index, parent);
+        index = parent_index;
+    }
+
+    furi_event_loop_timer_heap_set(instance, index, timer);
+}
+
+static void
+    furi_event_loop_timer_heap_sift_down(FuriEventLoop* instance, size_t index, uint32_t now) {
+    const size_t size = TimerHeap_size(instance->timer_heap);
+    FuriEventLoopTimer* timer = furi_event_loop_timer_heap_get(instance, index);
+
+    while(true) {
+        size_t child_index = 2 * index + 1;
+        if(child_index >= size) break;
+
+        FuriEventLoopTimer* child = furi_event_loop_timer_heap_get(instance, child_index);
+        if(child_index + 1 < size) {
+            FuriEventLoopTimer* sibling =
+                furi_event_loop_timer_heap_get(instance, child_index + 1);
+            if(furi_event_loop_timer_heap_less(sibling, child, now)) {
+                child = sibling;
+                child_index++;
+            }
         }
+
+        if(!furi_event_loop_timer_heap_less(child, timer, now)) break;
+
+        furi_event_loop_timer_heap_set(instance, index, child);
+        index = child_index;
     }
 
-    FURI_CRITICAL_EXIT();
+    furi_event_loop_timer_heap_set(instance, index, timer);
+}
 
-    if(timer_pos) {
-        TimerList_push_after(timer_pos, timer);
-    } else {
-        TimerList_push_front(instance->timer_list, timer);
+static void furi_event_loop_schedule_timer(FuriEventLoop* instance, FuriEventLoopTimer* timer) {
+    timer->sequence = instance->timer_sequence++;
+
+    TimerHeap_push_back(instance->timer_heap, timer);
+    furi_event_loop_timer_heap_sift_up(
+        instance, TimerHeap_size(instance->timer_heap) - 1, xTaskGetTickCount());
+    // At this point, the heap top points to the first timer to expire
+}
+
+static void furi_event_loop_unschedule_timer(FuriEventLoop* instance, FuriEventLoopTimer* timer) {
+    const size_t index = timer->heap_index;
+    furi_check(furi_event_loop_timer_heap_get(instance, index) == timer);
+
+    FuriEventLoopTimer* last;
+    TimerHeap_pop_back(&last, instance->timer_heap);
+
+    if(last != timer) {
+        // Move the last timer into the hole and restore the order in the direction it breaks
+        const uint32_t now = xTaskGetTickCount();
+        furi_event_loop_timer_heap_set(instance, index, last);
+
+        FuriEventLoopTimer* parent =
+            index > 0 ? furi_event_loop_timer_heap_get(instance, (index - 1) / 2) : NULL;
+
+        if(parent && furi_event_loop_timer_heap_less(last, parent, now)) {
+            furi_event_loop_timer_heap_sift_up(instance, index, now);
+        } else {
+            furi_event_loop_timer_heap_sift_down(instance, index, now);
+        }
     }
-    // At this point, TimerList_front() points to the first timer to expire
 }
 
 static void furi_event_loop_timer_enqueue_request(
@@ -78,8 +158,8 @@ static void furi_event_loop_timer_enqueue_request(
 uint32_t furi_event_loop_get_timer_wait_time(const FuriEventLoop* instance) {
     uint32_t wait_time = FuriWaitForever;
 
-    if(!TimerList_empty_p(instance->timer_list)) {
-        FuriEventLoopTimer* timer = TimerList_front(instance->timer_list);
+    if(!TimerHeap_empty_p(instance->timer_heap)) {
+        FuriEventLoopTimer* timer = *TimerHeap_front(instance->timer_heap);
         wait_time = furi_event_loop_timer_get_remaining_time_private(timer);
     }
 
@@ -91,7 +171,7 @@ void furi_event_loop_process_timer_queue(FuriEventLoop* instance) {
         FuriEventLoopTimer* timer = TimerQueue_pop_front(instance->timer_queue);
 
         if(timer->active) {
-            TimerList_unlink(timer);
+            furi_event_loop_unschedule_timer(instance, timer);
         }
 
         if(timer->request == FuriEventLoopTimerRequestStart) {
@@ -116,31 +196,42 @@ void furi_event_loop_process_timer_queue(FuriEventLoop* instance) {
 }
 
 bool furi_event_loop_process_expired_timers(FuriEventLoop* instance) {
-    if(TimerList_empty_p(instance->timer_list)) {
-        return false;
-    }
-    // The front() element contains the earliest-expiring timer
-    FuriEventLoopTimer* timer = TimerList_front(instance->timer_list);
+    const uint32_t now = xTaskGetTickCount();
+    bool processed = false;
 
-    if(!furi_event_loop_timer_is_expired(timer)) {
-        return false;
-    }
+    // Process everything that expired by now in one go, but visit each timer once:
+    // periodic timers with zero interval are rescheduled as already expired
+    size_t count = TimerHeap_size(instance->timer_heap);
 
-    TimerList_unlink(timer);
+    while(count--) {
+        // The heap top contains the earliest-expiring timer
+        FuriEventLoopTimer* timer = *TimerHeap_front(instance->timer_heap);
 
-    if(timer->periodic) {
-        const uint32_t num_events =
-            furi_event_loop_timer_get_elapsed_time(timer) / timer->interval;
+        if(furi_event_loop_timer_get_remaining_time_at(timer, now)) {
+            break;
+        }
+
+        furi_event_loop_unschedule_timer(instance, timer);
 
-        timer->start_time += timer->interval * num_events;
-        furi_event_loop_schedule_timer(instance, timer);
+        if(timer->periodic) {
+            const uint32_t num_events = (now - timer->start_time) / timer->interval;
 
-    } else {
-        timer->active = false;
+            timer->start_time += timer->interval * num_events;
+            furi_event_loop_schedule_timer(instance, timer);
+
+        } else {
+            timer->active = false;
+        }
+
+        processed = true;
+
+        // Callbacks earlier in this batch may have stopped, restarted or freed this timer
+        if(timer->request == FuriEventLoopTimerRequestNone) {
+            timer->callback(timer->context);
+        }
     }
 
-    timer->callback(timer->context);
-    return true;
+    return processed;
 }
 
 /*
@@ -164,7 +255,6 @@ FuriEventLoopTimer* furi_event_loop_timer_alloc(
     timer->context = context;
     timer->periodic = (type == FuriEventLoopTimerTypePeriodic);
 
-    TimerList_init_field(timer);
     TimerQueue_init_field(timer);
 
     return timer;
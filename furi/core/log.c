@@ -1,17 +1,81 @@
 #include "log.h"
 #include "check.h"
 #include "mutex.h"
+#include "thread.h"
 #include <furi_hal.h>
 #include <m-list.h>
+#include <stm32wb55_linker.h>
 
 LIST_DEF(FuriLogHandlersList, FuriLogHandler, M_POD_OPLIST)
 
 #define FURI_LOG_LEVEL_DEFAULT FuriLogLevelInfo
 
+#define FURI_LOG_RING_SIZE          4096 /**< Deferred record ring size, power of 2 */
+#define FURI_LOG_RECORD_SIZE_MAX    128
+#define FURI_LOG_RECORD_STRING_PTR  0xFFFF /**< String length marking a stored address */
+#define FURI_LOG_FRAME_MAGIC        0xFB /**< Never appears in ASCII or UTF-8 text */
+#define FURI_LOG_FRAME_VERSION      1
+#define FURI_LOG_SPEC_SIZE_MAX      32
+#define FURI_LOG_THREAD_STACK_SIZE  2048
+#define FURI_LOG_THREAD_POLL_PERIOD 10
+#define FURI_LOG_THREAD_FLAG_WAKE   (1UL << 0)
+
+typedef enum {
+    FuriLogRecordFlagCommitted = (1 << 0),
+    FuriLogRecordFlagPadding = (1 << 1),
+    FuriLogRecordFlagRaw = (1 << 2),
+} FuriLogRecordFlag;
+
+/** Deferred log record
+ *
+ * Followed by the tag and format strings and the raw arguments. Each string
+ * is a 16-bit length and the bytes, or FURI_LOG_RECORD_STRING_PTR and a
+ * 32-bit address. Integers narrower than 64 bits are stored as 32 bits,
+ * floating point values as doubles. All fields are little-endian and packed.
+ */
+typedef struct {
+    uint16_t size; /**< Record size including header, multiple of 4 */
+    uint8_t level;
+    uint8_t flags;
+    uint32_t tick;
+    uint8_t data[];
+} FuriLogRecord;
+
+typedef struct {
+    uint8_t* data;
+    size_t size;
+    size_t max_size;
+} FuriLogRecordBuffer;
+
+typedef enum {
+    FuriLogArgNone, /**< Escaped percent sign */
+    FuriLogArgInt32,
+    FuriLogArgInt64,
+    FuriLogArgDouble,
+    FuriLogArgString,
+    FuriLogArgPointer,
+    FuriLogArgInvalid,
+} FuriLogArg;
+
+typedef struct {
+    FuriLogArg arg;
+    uint8_t stars; /**< Width and precision given as arguments */
+    bool precision_star; /**< Last of the stars is the precision */
+    int32_t precision; /**< Numeric precision, negative if not given */
+    bool long_double;
+    size_t length; /**< Specification length, including percent sign */
+} FuriLogSpec;
+
 typedef struct {
     FuriLogLevel log_level;
     FuriMutex* mutex;
     FuriLogHandlersList_t tx_handlers;
+    volatile FuriLogMode mode;
+    FuriThread* thread;
+    uint8_t* ring;
+    uint32_t ring_head;
+    uint32_t ring_tail;
+    uint32_t dropped;
 } FuriLogParams;
 
 static FuriLogParams furi_log = {0};
@@ -107,42 +171,568 @@ void furi_log_puts(const char* data) {
     furi_log_tx((const uint8_t*)data, strlen(data));
 }
 
-void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
-    if(level <= furi_log.log_level &&
-       furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
-        FuriString* string;
-        string = furi_string_alloc();
+static void furi_log_format_prefix(
+    FuriString* string,
+    uint32_t tick,
+    FuriLogLevel level,
+    const char* tag,
+    int tag_length) {
+    const char* color = _FURI_LOG_CLR_RESET;
+    const char* log_letter = " ";
+    switch(level) {
+    case FuriLogLevelError:
+        color = _FURI_LOG_CLR_E;
+        log_letter = "E";
+        break;
+    case FuriLogLevelWarn:
+        color = _FURI_LOG_CLR_W;
+        log_letter = "W";
+        break;
+    case FuriLogLevelInfo:
+        color = _FURI_LOG_CLR_I;
+        log_letter = "I";
+        break;
+    case FuriLogLevelDebug:
+        color = _FURI_LOG_CLR_D;
+        log_letter = "D";
+        break;
+    case FuriLogLevelTrace:
+        color = _FURI_LOG_CLR_T;
+        log_letter = "T";
+        break;
+    default:
+        break;
+    }
+
+    // Timestamp
+    furi_string_printf(
+        string,
+        "%lu %s[%s][%.*s] " _FURI_LOG_CLR_RESET,
+        tick,
+        color,
+        log_letter,
+        tag_length,
+        tag);
+}
+
+static void furi_log_spec_parse(const char* spec, FuriLogSpec* result) {
+    const char* cursor = spec + 1;
+    size_t int_size = sizeof(int);
+
+    result->stars = 0;
+    result->precision_star = false;
+    result->precision = -1;
+    result->long_double = false;
+
+    while(*cursor && strchr("-+ #0'", *cursor)) {
+        cursor++;
+    }
+
+    for(size_t i = 0; i < 2; i++) {
+        if(i == 1) {
+            if(*cursor != '.') break;
+            cursor++;
+        }
+        if(*cursor == '*') {
+            result->stars++;
+            result->precision_star = (i == 1);
+            cursor++;
+        } else {
+            int32_t value = 0;
+            while(*cursor >= '0' && *cursor <= '9') {
+                if(value < INT16_MAX) value = value * 10 + (*cursor - '0');
+                cursor++;
+            }
+            if(i == 1) result->precision = value;
+        }
+    }
+
+    switch(*cursor) {
+    case 'h':
+        cursor++;
+        if(*cursor == 'h') cursor++;
+        break;
+    case 'l':
+        cursor++;
+        if(*cursor == 'l') {
+            int_size = sizeof(long long);
+            cursor++;
+        } else {
+            int_size = sizeof(long);
+        }
+        break;
+    case 'q':
+        int_size = sizeof(long long);
+        cursor++;
+        break;
+    case 'j':
+        int_size = sizeof(intmax_t);
+        cursor++;
+        break;
+    case 'z':
+        int_size = sizeof(size_t);
+        cursor++;
+        break;
+    case 't':
+        int_size = sizeof(ptrdiff_t);
+        cursor++;
+        break;
+    case 'L':
+        result->long_double = true;
+        cursor++;
+        break;
+    default:
+        break;
+    }
+
+    switch(*cursor) {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+    case 'c':
+        result->arg = int_size > sizeof(uint32_t) ? FuriLogArgInt64 : FuriLogArgInt32;
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        result->arg = FuriLogArgDouble;
+        break;
+    case 's':
+        result->arg = FuriLogArgString;
+        break;
+    case 'p':
+        result->arg = FuriLogArgPointer;
+        break;
+    case '%':
+        result->arg = FuriLogArgNone;
+        break;
+    default:
+        result->arg = FuriLogArgInvalid;
+        break;
+    }
+
+    if(*cursor) cursor++;
+    result->length = cursor - spec;
+}
 
-        const char* color = _FURI_LOG_CLR_RESET;
-        const char* log_letter = " ";
-        switch(level) {
-        case FuriLogLevelError:
-            color = _FURI_LOG_CLR_E;
-            log_letter = "E";
+static inline bool furi_log_is_static(const void* pointer) {
+    // Code and constants of the firmware image precede the initialized data load image
+    return pointer && (uintptr_t)pointer < (uintptr_t)&_sidata;
+}
+
+static bool furi_log_record_put(FuriLogRecordBuffer* buffer, const void* data, size_t size) {
+    if(buffer->max_size - buffer->size < size) return false;
+    memcpy(buffer->data + buffer->size, data, size);
+    buffer->size += size;
+    return true;
+}
+
+/** Put string, only up to precision characters if it is not negative */
+static bool furi_log_record_put_string(
+    FuriLogRecordBuffer* buffer,
+    const char* string,
+    int32_t precision) {
+    if(!string) string = "(null)";
+
+    // String with precision doesn't have to be terminated, so it is never referenced
+    if(furi_log_is_static(string) && precision < 0) {
+        const uint16_t marker = FURI_LOG_RECORD_STRING_PTR;
+        const uint32_t address = (uint32_t)(uintptr_t)string;
+        return furi_log_record_put(buffer, &marker, sizeof(marker)) &&
+               furi_log_record_put(buffer, &address, sizeof(address));
+    }
+
+    if(buffer->max_size - buffer->size < sizeof(uint16_t)) return false;
+    // Strings that don't fit are truncated, the arguments after them are dropped
+    size_t max_length = buffer->max_size - buffer->size - sizeof(uint16_t);
+    if(precision >= 0) max_length = MIN(max_length, (size_t)precision);
+    const uint16_t length = strnlen(string, max_length);
+    return furi_log_record_put(buffer, &length, sizeof(length)) &&
+           furi_log_record_put(buffer, string, length);
+}
+
+static bool furi_log_record_get(FuriLogRecordBuffer* buffer, void* data, size_t size) {
+    if(buffer->max_size - buffer->size < size) return false;
+    memcpy(data, buffer->data + buffer->size, size);
+    buffer->size += size;
+    return true;
+}
+
+static bool
+    furi_log_record_get_string(FuriLogRecordBuffer* buffer, const char** string, size_t* length) {
+    uint16_t marker;
+    if(!furi_log_record_get(buffer, &marker, sizeof(marker))) return false;
+
+    if(marker == FURI_LOG_RECORD_STRING_PTR) {
+        uint32_t address;
+        if(!furi_log_record_get(buffer, &address, sizeof(address))) return false;
+        *string = (const char*)(uintptr_t)address;
+        *length = strlen(*string);
+    } else {
+        if(buffer->max_size - buffer->size < marker) return false;
+        *string = (const char*)buffer->data + buffer->size;
+        *length = marker;
+        buffer->size += marker;
+    }
+
+    return true;
+}
+
+/** Get record string as a C-string, copying it into text if it was stored inline */
+static const char* furi_log_record_get_cstr(FuriLogRecordBuffer* buffer, char* text) {
+    const char* string;
+    size_t length;
+    if(!furi_log_record_get_string(buffer, &string, &length)) return NULL;
+    if(furi_log_is_static(string)) return string;
+
+    memcpy(text, string, length);
+    text[length] = '\0';
+    return text;
+}
+
+static size_t furi_log_record_encode(
+    uint8_t* data,
+    FuriLogLevel level,
+    uint8_t flags,
+    const char* tag,
+    const char* format,
+    va_list args) {
+    FuriLogRecord* record = (FuriLogRecord*)data;
+    record->level = level;
+    record->flags = flags;
+    record->tick = furi_get_tick();
+
+    FuriLogRecordBuffer buffer = {
+        .data = record->data,
+        .size = 0,
+        .max_size = FURI_LOG_RECORD_SIZE_MAX - sizeof(FuriLogRecord),
+    };
+
+    bool encoding = furi_log_record_put_string(&buffer, tag, -1) &&
+                    furi_log_record_put_string(&buffer, format, -1);
+
+    const char* cursor = format;
+    while(encoding && (cursor = strchr(cursor, '%'))) {
+        FuriLogSpec spec;
+        furi_log_spec_parse(cursor, &spec);
+        cursor += spec.length;
+
+        int32_t precision = spec.precision;
+        for(size_t i = 0; encoding && i < spec.stars; i++) {
+            const int32_t value = va_arg(args, int);
+            encoding = furi_log_record_put(&buffer, &value, sizeof(value));
+            if(spec.precision_star && i == spec.stars - 1u) precision = value;
+        }
+        if(!encoding) break;
+
+        switch(spec.arg) {
+        case FuriLogArgNone:
+            break;
+        case FuriLogArgInt32: {
+            const uint32_t value = va_arg(args, unsigned int);
+            encoding = furi_log_record_put(&buffer, &value, sizeof(value));
+            break;
+        }
+        case FuriLogArgInt64: {
+            const uint64_t value = va_arg(args, unsigned long long);
+            encoding = furi_log_record_put(&buffer, &value, sizeof(value));
+            break;
+        }
+        case FuriLogArgDouble: {
+            const double value = spec.long_double ? (double)va_arg(args, long double) :
+                                                    va_arg(args, double);
+            encoding = furi_log_record_put(&buffer, &value, sizeof(value));
+            break;
+        }
+        case FuriLogArgString:
+            encoding = furi_log_record_put_string(&buffer, va_arg(args, const char*), precision);
             break;
-        case FuriLogLevelWarn:
-            color = _FURI_LOG_CLR_W;
-            log_letter = "W";
+        case FuriLogArgPointer: {
+            const uint32_t value = (uint32_t)(uintptr_t)va_arg(args, void*);
+            encoding = furi_log_record_put(&buffer, &value, sizeof(value));
+            break;
+        }
+        default:
+            encoding = false;
+            break;
+        }
+    }
+
+    size_t size = (sizeof(FuriLogRecord) + buffer.size + 3) & ~3U;
+    memset(record->data + buffer.size, 0, size - sizeof(FuriLogRecord) - buffer.size);
+    record->size = size;
+
+    return size;
+}
+
+static size_t furi_log_record_encode_format(
+    uint8_t* data,
+    FuriLogLevel level,
+    const char* tag,
+    const char* format,
+    ...) {
+    va_list args;
+    va_start(args, format);
+    size_t size = furi_log_record_encode(data, level, 0, tag, format, args);
+    va_end(args);
+    return size;
+}
+
+static void furi_log_record_format(
+    FuriString* string,
+    FuriLogRecordBuffer* buffer,
+    const char* format,
+    char* text) {
+    const char* cursor = format;
+
+    const char* percent;
+    while((percent = strchr(cursor, '%'))) {
+        FuriLogSpec spec;
+        furi_log_spec_parse(percent, &spec);
+        if(spec.arg == FuriLogArgInvalid || spec.length > FURI_LOG_SPEC_SIZE_MAX) break;
+
+        // Substitute argument provided width and precision into the specification
+        char spec_string[FURI_LOG_SPEC_SIZE_MAX + 2 * 11 + 1];
+        size_t spec_size = 0;
+        bool decoding = true;
+        for(size_t i = 0; decoding && i < spec.length; i++) {
+            if(percent[i] == '*') {
+                int32_t value = 0;
+                decoding = furi_log_record_get(buffer, &value, sizeof(value));
+                spec_size += snprintf(&spec_string[spec_size], 12, "%ld", value);
+            } else {
+                spec_string[spec_size++] = percent[i];
+            }
+        }
+        spec_string[spec_size] = '\0';
+
+        furi_string_cat_printf(string, "%.*s", (int)(percent - cursor), cursor);
+
+        switch(spec.arg) {
+        case FuriLogArgNone:
+            furi_string_push_back(string, '%');
+            break;
+        case FuriLogArgInt32: {
+            uint32_t value;
+            if((decoding = decoding && furi_log_record_get(buffer, &value, sizeof(value)))) {
+                furi_string_cat_printf(string, spec_string, value);
+            }
+            break;
+        }
+        case FuriLogArgInt64: {
+            uint64_t value;
+            if((decoding = decoding && furi_log_record_get(buffer, &value, sizeof(value)))) {
+                furi_string_cat_printf(string, spec_string, value);
+            }
             break;
-        case FuriLogLevelInfo:
-            color = _FURI_LOG_CLR_I;
-            log_letter = "I";
+        }
+        case FuriLogArgDouble: {
+            double value;
+            if((decoding = decoding && furi_log_record_get(buffer, &value, sizeof(value)))) {
+                if(spec.long_double) {
+                    furi_string_cat_printf(string, spec_string, (long double)value);
+                } else {
+                    furi_string_cat_printf(string, spec_string, value);
+                }
+            }
             break;
-        case FuriLogLevelDebug:
-            color = _FURI_LOG_CLR_D;
-            log_letter = "D";
+        }
+        case FuriLogArgString: {
+            const char* value = decoding ? furi_log_record_get_cstr(buffer, text) : NULL;
+            if((decoding = (value != NULL))) {
+                furi_string_cat_printf(string, spec_string, value);
+            }
             break;
-        case FuriLogLevelTrace:
-            color = _FURI_LOG_CLR_T;
-            log_letter = "T";
+        }
+        case FuriLogArgPointer: {
+            uint32_t value;
+            if((decoding = decoding && furi_log_record_get(buffer, &value, sizeof(value)))) {
+                furi_string_cat_printf(string, spec_string, (void*)(uintptr_t)value);
+            }
             break;
+        }
         default:
             break;
         }
 
-        // Timestamp
-        furi_string_printf(
-            string, "%lu %s[%s][%s] " _FURI_LOG_CLR_RESET, furi_get_tick(), color, log_letter, tag);
+        // Arguments were truncated, output the rest of the format as is
+        if(!decoding) {
+            cursor = percent;
+            break;
+        }
+
+        cursor = percent + spec.length;
+    }
+
+    furi_string_cat_str(string, cursor);
+}
+
+static void furi_log_record_output(const FuriLogRecord* record, FuriString* string) {
+    if(furi_log.mode == FuriLogModeBinary) {
+        uint8_t frame[2 + FURI_LOG_RECORD_SIZE_MAX];
+        frame[0] = FURI_LOG_FRAME_MAGIC;
+        frame[1] = FURI_LOG_FRAME_VERSION;
+        memcpy(&frame[2], record, record->size);
+        furi_log_tx(frame, record->size + 2);
+        return;
+    }
+
+    FuriLogRecordBuffer buffer = {
+        .data = (uint8_t*)record->data,
+        .size = 0,
+        .max_size = record->size - sizeof(FuriLogRecord),
+    };
+
+    char format_text[FURI_LOG_RECORD_SIZE_MAX];
+    char text[FURI_LOG_RECORD_SIZE_MAX];
+    const char* tag;
+    size_t tag_length;
+    if(!furi_log_record_get_string(&buffer, &tag, &tag_length)) return;
+    const char* format = furi_log_record_get_cstr(&buffer, format_text);
+    if(!format) return;
+
+    if(record->flags & FuriLogRecordFlagRaw) {
+        furi_string_reset(string);
+    } else {
+        furi_log_format_prefix(string, record->tick, record->level, tag, tag_length);
+    }
+    furi_log_record_format(string, &buffer, format, text);
+    if(!(record->flags & FuriLogRecordFlagRaw)) {
+        furi_string_cat_str(string, "\r\n");
+    }
+
+    furi_log_puts(furi_string_get_cstr(string));
+}
+
+static uint8_t* furi_log_ring_reserve(size_t size) {
+    uint32_t head = __atomic_load_n(&furi_log.ring_head, __ATOMIC_RELAXED);
+    uint32_t offset, padding;
+
+    do {
+        offset = head & (FURI_LOG_RING_SIZE - 1);
+        // Records are contiguous, skip the end of the ring if it is too short
+        padding = offset + size > FURI_LOG_RING_SIZE ? FURI_LOG_RING_SIZE - offset : 0;
+
+        const uint32_t tail = __atomic_load_n(&furi_log.ring_tail, __ATOMIC_ACQUIRE);
+        if(head + padding + size - tail > FURI_LOG_RING_SIZE) {
+            __atomic_fetch_add(&furi_log.dropped, 1, __ATOMIC_RELAXED);
+            return NULL;
+        }
+    } while(!__atomic_compare_exchange_n(
+        &furi_log.ring_head,
+        &head,
+        head + padding + size,
+        true,
+        __ATOMIC_RELAXED,
+        __ATOMIC_RELAXED));
+
+    if(padding) {
+        FuriLogRecord* record = (FuriLogRecord*)&furi_log.ring[offset];
+        record->size = padding;
+        __atomic_store_n(
+            &record->flags,
+            FuriLogRecordFlagCommitted | FuriLogRecordFlagPadding,
+            __ATOMIC_RELEASE);
+        offset = 0;
+    }
+
+    return &furi_log.ring[offset];
+}
+
+static void furi_log_ring_push(
+    FuriLogLevel level,
+    uint8_t flags,
+    const char* tag,
+    const char* format,
+    va_list args) {
+    uint32_t data[FURI_LOG_RECORD_SIZE_MAX / sizeof(uint32_t)];
+    size_t size = furi_log_record_encode((uint8_t*)data, level, flags, tag, format, args);
+
+    uint8_t* slot = furi_log_ring_reserve(size);
+    if(slot) {
+        memcpy(slot, data, size);
+        __atomic_store_n(
+            &((FuriLogRecord*)slot)->flags, flags | FuriLogRecordFlagCommitted, __ATOMIC_RELEASE);
+    }
+}
+
+static bool furi_log_ring_process(FuriString* string) {
+    const uint32_t tail = furi_log.ring_tail;
+    if(tail == __atomic_load_n(&furi_log.ring_head, __ATOMIC_ACQUIRE)) return false;
+
+    FuriLogRecord* record = (FuriLogRecord*)&furi_log.ring[tail & (FURI_LOG_RING_SIZE - 1)];
+    const uint8_t flags = __atomic_load_n(&record->flags, __ATOMIC_ACQUIRE);
+    // Reserved, but the writer was preempted before completing it
+    if(!(flags & FuriLogRecordFlagCommitted)) return false;
+
+    const uint16_t size = record->size;
+    if(!(flags & FuriLogRecordFlagPadding)) {
+        furi_check(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk);
+        furi_log_record_output(record, string);
+        furi_mutex_release(furi_log.mutex);
+    }
+
+    // Free space must read as uncommitted wherever the next record header lands
+    memset(record, 0, size);
+    __atomic_store_n(&furi_log.ring_tail, tail + size, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+static int32_t furi_log_thread(void* context) {
+    UNUSED(context);
+
+    FuriString* string = furi_string_alloc();
+
+    while(true) {
+        const uint32_t dropped = __atomic_exchange_n(&furi_log.dropped, 0, __ATOMIC_RELAXED);
+        if(dropped) {
+            uint32_t data[FURI_LOG_RECORD_SIZE_MAX / sizeof(uint32_t)];
+            furi_log_record_encode_format(
+                (uint8_t*)data, FuriLogLevelWarn, "Log", "%lu records dropped", dropped);
+            furi_check(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk);
+            furi_log_record_output((FuriLogRecord*)data, string);
+            furi_mutex_release(furi_log.mutex);
+        }
+
+        while(furi_log_ring_process(string)) {
+            // Drain everything committed so far
+        }
+
+        // Polling keeps call sites free of scheduler calls
+        furi_thread_flags_wait(
+            FURI_LOG_THREAD_FLAG_WAKE,
+            FuriFlagWaitAny,
+            furi_log.mode == FuriLogModeImmediate ? FuriWaitForever :
+                                                    FURI_LOG_THREAD_POLL_PERIOD);
+    }
+
+    furi_string_free(string);
+
+    return 0;
+}
+
+void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
+    if(level > furi_log.log_level) return;
+
+    if(furi_log.mode != FuriLogModeImmediate) {
+        va_list args;
+        va_start(args, format);
+        furi_log_ring_push(level, 0, tag, format, args);
+        va_end(args);
+    } else if(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
+        FuriString* string;
+        string = furi_string_alloc();
+
+        furi_log_format_prefix(string, furi_get_tick(), level, tag, -1);
         furi_log_puts(furi_string_get_cstr(string));
         furi_string_reset(string);
 
@@ -161,8 +751,14 @@ void furi_log_print_format(FuriLogLevel level, const char* tag, const char* form
 }
 
 void furi_log_print_raw_format(FuriLogLevel level, const char* format, ...) {
-    if(level <= furi_log.log_level &&
-       furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
+    if(level > furi_log.log_level) return;
+
+    if(furi_log.mode != FuriLogModeImmediate) {
+        va_list args;
+        va_start(args, format);
+        furi_log_ring_push(level, FuriLogRecordFlagRaw, "", format, args);
+        va_end(args);
+    } else if(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
         FuriString* string;
         string = furi_string_alloc();
         va_list args;
@@ -177,6 +773,34 @@ void furi_log_print_raw_format(FuriLogLevel level, const char* format, ...) {
     }
 }
 
+void furi_log_set_mode(FuriLogMode mode) {
+    furi_check(!FURI_IS_ISR());
+    furi_check(mode <= FuriLogModeBinary);
+
+    furi_check(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk);
+
+    if(mode != FuriLogModeImmediate && !furi_log.thread) {
+        furi_log.ring = malloc(FURI_LOG_RING_SIZE);
+        furi_log.thread = furi_thread_alloc_service(
+            "LogWorker", FURI_LOG_THREAD_STACK_SIZE, furi_log_thread, NULL);
+        furi_thread_set_priority(furi_log.thread, FuriThreadPriorityLowest);
+        furi_thread_start(furi_log.thread);
+    }
+
+    furi_log.mode = mode;
+
+    // Records queued before switching back to immediate mode are still delivered
+    if(furi_log.thread) {
+        furi_thread_flags_set(furi_thread_get_id(furi_log.thread), FURI_LOG_THREAD_FLAG_WAKE);
+    }
+
+    furi_mutex_release(furi_log.mutex);
+}
+
+FuriLogMode furi_log_get_mode(void) {
+    return furi_log.mode;
+}
+
 void furi_log_set_level(FuriLogLevel level) {
     furi_check(level <= FuriLogLevelTrace);
 
@@ -39,6 +39,12 @@ typedef enum {
 #define _FURI_LOG_CLR_D _FURI_LOG_CLR(_FURI_LOG_CLR_BLUE)
 #define _FURI_LOG_CLR_T _FURI_LOG_CLR(_FURI_LOG_CLR_PURPLE)
 
+typedef enum {
+    FuriLogModeImmediate, /**< Records are formatted and sent on the calling thread */
+    FuriLogModeDeferred, /**< Records are queued and formatted by the log thread */
+    FuriLogModeBinary, /**< Records are queued and sent by the log thread as binary frames */
+} FuriLogMode;
+
 typedef void (*FuriLogHandlerCallback)(const uint8_t* data, size_t size, void* context);
 
 typedef struct {
@@ -109,6 +115,28 @@ void furi_log_set_level(FuriLogLevel level);
  */
 FuriLogLevel furi_log_get_level(void);
 
+/** Set log mode
+ *
+ * In deferred modes call sites only copy a compact record (tick, level, tag,
+ * format and raw arguments) into a lock-free ring, which is safe and cheap
+ * to do from time critical threads and interrupts. Strings located in the
+ * firmware image are stored by address, others are copied into the record.
+ *
+ * Binary mode frames are decoded on the host by `scripts/log_decode.py`
+ * using the firmware ELF.
+ *
+ * @warning    Do not call from ISR
+ *
+ * @param[in]  mode  The mode
+ */
+void furi_log_set_mode(FuriLogMode mode);
+
+/** Get log mode
+ *
+ * @return     The furi log mode.
+ */
+FuriLogMode furi_log_get_mode(void);
+
 /** Log level to string
  *
  * @param[in]  level  The level
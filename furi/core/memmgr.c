@@ -3,13 +3,14 @@
 #include <furi_hal_memory.h>
 
 extern void* pvPortMalloc(size_t xSize);
+extern void* memmgr_heap_malloc(size_t size, void* caller);
 extern void vPortFree(void* pv);
 extern size_t xPortGetFreeHeapSize(void);
 extern size_t xPortGetTotalHeapSize(void);
 extern size_t xPortGetMinimumEverFreeHeapSize(void);
 
 void* malloc(size_t size) {
-    return pvPortMalloc(size);
+    return memmgr_heap_malloc(size, __builtin_return_address(0));
 }
 
 void free(void* ptr) {
@@ -22,7 +23,7 @@ void* realloc(void* ptr, size_t size) {
         return NULL;
     }
 
-    void* p = pvPortMalloc(size);
+    void* p = memmgr_heap_malloc(size, __builtin_return_address(0));
     if(ptr != NULL) {
         memcpy(p, ptr, size);
         vPortFree(ptr);
@@ -32,7 +33,7 @@ void* realloc(void* ptr, size_t size) {
 }
 
 void* calloc(size_t count, size_t size) {
-    return pvPortMalloc(count * size);
+    return memmgr_heap_malloc(count * size, __builtin_return_address(0));
 }
 
 char* strdup(const char* s) {
@@ -40,7 +41,7 @@ char* strdup(const char* s) {
     furi_check(((uint32_t)s << 2) != 0);
 
     size_t siz = strlen(s) + 1;
-    char* y = pvPortMalloc(siz);
+    char* y = memmgr_heap_malloc(siz, __builtin_return_address(0));
     memcpy(y, s, siz);
 
     return y;
@@ -60,7 +61,7 @@ size_t memmgr_get_minimum_free_heap(void) {
 
 void* __wrap__malloc_r(struct _reent* r, size_t size) {
     UNUSED(r);
-    return pvPortMalloc(size);
+    return memmgr_heap_malloc(size, __builtin_return_address(0));
 }
 
 void __wrap__free_r(struct _reent* r, void* ptr) {
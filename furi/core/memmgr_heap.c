@@ -89,6 +89,24 @@ static void prvInsertBlockIntoFreeList(BlockLink_t* pxBlockToInsert);
  */
 static void prvHeapInit(void);
 
+/*
+ * Takes a block of the requested size from the list of free blocks, must be
+ * called with the scheduler suspended. The memory is neither wiped nor traced.
+ */
+static void* prvHeapAllocate(size_t xWantedSize);
+
+/*
+ * Returns a block taken by prvHeapAllocate() to the list of free blocks, must
+ * be called with the scheduler suspended.
+ */
+static void prvHeapRelease(BlockLink_t* pxLink);
+
+/*
+ * Allocates memory on behalf of the caller. malloc() and friends pass their
+ * return address, so that the allocation profiler sees application call sites.
+ */
+void* memmgr_heap_malloc(size_t xWantedSize, void* pvCaller);
+
 /*-----------------------------------------------------------*/
 
 /* The size of the structure placed at the beginning of each allocated memory
@@ -127,6 +145,89 @@ DICT_DEF2( //-V1048
 static MemmgrHeapThreadDict_t memmgr_heap_thread_dict = {0};
 static volatile uint32_t memmgr_heap_thread_trace_depth = 0;
 
+/* Size-class pools
+ *
+ * Small allocations are served from slabs carved from the heap on demand. Every
+ * slot starts with a BlockLink_t, just like a heap block: xBlockSize holds the
+ * allocated bit, the pool bit and the slot size, pxNextFreeBlock points to the
+ * owning slab while the slot is allocated and to the next free slot otherwise.
+ */
+#define MEMMGR_HEAP_POOL_SLAB_SIZE (1024U)
+
+typedef struct MemmgrHeapPoolSlab {
+    struct MemmgrHeapPoolSlab* prev;
+    struct MemmgrHeapPoolSlab* next;
+    BlockLink_t* free_slots;
+    uint16_t used;
+    uint16_t pool;
+} MemmgrHeapPoolSlab;
+
+typedef struct {
+    /* Slabs with free slots go first */
+    MemmgrHeapPoolSlab* head;
+    MemmgrHeapPoolSlab* tail;
+    size_t empty;
+    MemmgrHeapPoolStats stats;
+} MemmgrHeapPool;
+
+static const size_t memmgr_heap_pool_sizes[] = {16, 32, 64, 128};
+
+/* Slots follow the aligned slab header */
+static const size_t memmgr_heap_pool_slab_header_size =
+    (sizeof(MemmgrHeapPoolSlab) + portBYTE_ALIGNMENT_MASK) & ~((size_t)portBYTE_ALIGNMENT_MASK);
+
+#define MEMMGR_HEAP_POOL_COUNT COUNT_OF(memmgr_heap_pool_sizes)
+
+#ifdef FURI_MEMMGR_POOLS
+static const bool memmgr_heap_pools_enabled = true;
+#else
+static const bool memmgr_heap_pools_enabled = false;
+#endif
+
+static MemmgrHeapPool memmgr_heap_pools[MEMMGR_HEAP_POOL_COUNT] = {0};
+
+/* Bytes in free pool slots, reported as free heap */
+static size_t memmgr_heap_pool_free_bytes = 0;
+
+/* Set in the size of allocated pool slots, next to xBlockAllocatedBit */
+static size_t memmgr_heap_pool_bit = 0;
+
+/* First block of the heap, blocks follow each other up to pxEnd */
+static uint8_t* memmgr_heap_start = NULL;
+
+/* Allocation profiler
+ *
+ * Every interval-th allocation is sampled: it is accounted to its call site and
+ * remembered in an open addressing table, so that freeing it is accounted too.
+ * Profiler storage is taken from the heap directly and never shows up in it.
+ */
+#define MEMMGR_HEAP_PROFILE_LIVE_SIZE (256U)
+#define MEMMGR_HEAP_PROFILE_LIVE_MASK (MEMMGR_HEAP_PROFILE_LIVE_SIZE - 1)
+
+typedef struct {
+    void* pointer;
+    size_t site;
+} MemmgrHeapProfileLive;
+
+typedef struct {
+    MemmgrHeapProfileInfo info;
+    uint32_t countdown;
+    size_t live_count;
+    size_t site_count;
+    MemmgrHeapProfileSite sites[MEMMGR_HEAP_PROFILE_SITES];
+    MemmgrHeapProfileLive live[MEMMGR_HEAP_PROFILE_LIVE_SIZE];
+} MemmgrHeapProfile;
+
+static MemmgrHeapProfile* memmgr_heap_profile = NULL;
+
+static inline bool memmgr_heap_block_is_allocated(BlockLink_t* pxLink) {
+    if((pxLink->xBlockSize & xBlockAllocatedBit) == 0) {
+        return false;
+    }
+
+    return (pxLink->xBlockSize & memmgr_heap_pool_bit) || pxLink->pxNextFreeBlock == NULL;
+}
+
 /* Initialize tracing storage on start */
 void memmgr_heap_init(void) {
     MemmgrHeapThreadDict_init(memmgr_heap_thread_dict);
@@ -175,8 +276,7 @@ size_t memmgr_heap_get_thread_memory(FuriThreadId thread_id) {
                     puc -= xHeapStructSize;
                     BlockLink_t* pxLink = (void*)puc;
 
-                    if((pxLink->xBlockSize & xBlockAllocatedBit) != 0 &&
-                       pxLink->pxNextFreeBlock == NULL) {
+                    if(memmgr_heap_block_is_allocated(pxLink)) {
                         leftovers += data->value;
                     }
                 }
@@ -219,6 +319,464 @@ static inline void traceFREE(void* pointer, size_t size) {
     }
 }
 
+static inline size_t memmgr_heap_pool_slot_size(size_t pool) {
+    return xHeapStructSize + memmgr_heap_pool_sizes[pool];
+}
+
+static inline uint8_t* memmgr_heap_pool_slots(MemmgrHeapPoolSlab* slab) {
+    return (uint8_t*)slab + memmgr_heap_pool_slab_header_size;
+}
+
+static inline size_t memmgr_heap_pool_slot_count(size_t pool) {
+    return (MEMMGR_HEAP_POOL_SLAB_SIZE - memmgr_heap_pool_slab_header_size) /
+           memmgr_heap_pool_slot_size(pool);
+}
+
+static void memmgr_heap_update_minimum(void) {
+    size_t free_bytes = xFreeBytesRemaining + memmgr_heap_pool_free_bytes;
+    if(free_bytes < xMinimumEverFreeBytesRemaining) {
+        xMinimumEverFreeBytesRemaining = free_bytes;
+    }
+}
+
+static void memmgr_heap_pool_unlink(MemmgrHeapPool* pool, MemmgrHeapPoolSlab* slab) {
+    if(slab->prev) {
+        slab->prev->next = slab->next;
+    } else {
+        pool->head = slab->next;
+    }
+
+    if(slab->next) {
+        slab->next->prev = slab->prev;
+    } else {
+        pool->tail = slab->prev;
+    }
+
+    slab->prev = NULL;
+    slab->next = NULL;
+}
+
+static void memmgr_heap_pool_push_front(MemmgrHeapPool* pool, MemmgrHeapPoolSlab* slab) {
+    slab->next = pool->head;
+    if(pool->head) {
+        pool->head->prev = slab;
+    } else {
+        pool->tail = slab;
+    }
+    pool->head = slab;
+}
+
+static void memmgr_heap_pool_push_back(MemmgrHeapPool* pool, MemmgrHeapPoolSlab* slab) {
+    slab->prev = pool->tail;
+    if(pool->tail) {
+        pool->tail->next = slab;
+    } else {
+        pool->head = slab;
+    }
+    pool->tail = slab;
+}
+
+static MemmgrHeapPoolSlab* memmgr_heap_pool_carve_slab(size_t pool_index) {
+    MemmgrHeapPoolSlab* slab = prvHeapAllocate(MEMMGR_HEAP_POOL_SLAB_SIZE);
+    if(!slab) {
+        return NULL;
+    }
+
+    const size_t slot_size = memmgr_heap_pool_slot_size(pool_index);
+    const size_t slot_count = memmgr_heap_pool_slot_count(pool_index);
+
+    memset(slab, 0, sizeof(MemmgrHeapPoolSlab));
+    slab->pool = pool_index;
+
+    // Slots are linked in address order
+    uint8_t* slots = memmgr_heap_pool_slots(slab);
+    for(size_t i = slot_count; i > 0; i--) {
+        BlockLink_t* slot = (BlockLink_t*)(slots + (i - 1) * slot_size);
+        slot->xBlockSize = slot_size;
+        slot->pxNextFreeBlock = slab->free_slots;
+        slab->free_slots = slot;
+    }
+
+    MemmgrHeapPool* pool = &memmgr_heap_pools[pool_index];
+    pool->empty++;
+    pool->stats.slabs++;
+    pool->stats.blocks_free += slot_count;
+    memmgr_heap_pool_free_bytes += slot_count * slot_size;
+
+    return slab;
+}
+
+static void memmgr_heap_pool_release_slab(MemmgrHeapPoolSlab* slab) {
+    MemmgrHeapPool* pool = &memmgr_heap_pools[slab->pool];
+    const size_t slot_size = memmgr_heap_pool_slot_size(slab->pool);
+
+    size_t slot_count = 0;
+    for(BlockLink_t* slot = slab->free_slots; slot; slot = slot->pxNextFreeBlock) {
+        slot_count++;
+    }
+
+    memmgr_heap_pool_unlink(pool, slab);
+    pool->empty--;
+    pool->stats.slabs--;
+    pool->stats.blocks_free -= slot_count;
+    memmgr_heap_pool_free_bytes -= slot_count * slot_size;
+
+    BlockLink_t* pxLink = (BlockLink_t*)((uint8_t*)slab - xHeapStructSize);
+    memset(slab, 0, (pxLink->xBlockSize & ~xBlockAllocatedBit) - xHeapStructSize);
+    prvHeapRelease(pxLink);
+}
+
+/* Allocate from the smallest fitting pool, must be called with the scheduler suspended.
+ * Returns NULL if the size is not served by pools or no slab can be carved. */
+static void* memmgr_heap_pool_alloc(size_t size) {
+    if(!memmgr_heap_pools_enabled) {
+        return NULL;
+    }
+
+    size_t pool_index = 0;
+    while(pool_index < MEMMGR_HEAP_POOL_COUNT && size > memmgr_heap_pool_sizes[pool_index]) {
+        pool_index++;
+    }
+
+    if(size == 0 || pool_index == MEMMGR_HEAP_POOL_COUNT) {
+        return NULL;
+    }
+
+    MemmgrHeapPool* pool = &memmgr_heap_pools[pool_index];
+    MemmgrHeapPoolSlab* slab = pool->head;
+
+    if(!slab || !slab->free_slots) {
+        slab = memmgr_heap_pool_carve_slab(pool_index);
+        if(!slab) {
+            pool->stats.fallbacks++;
+            return NULL;
+        }
+        memmgr_heap_pool_push_front(pool, slab);
+    }
+
+    BlockLink_t* slot = slab->free_slots;
+    slab->free_slots = slot->pxNextFreeBlock;
+    if(slab->used++ == 0) {
+        pool->empty--;
+    }
+
+    if(!slab->free_slots) {
+        // Full slabs go to the back, so the head always has free slots if any slab has
+        memmgr_heap_pool_unlink(pool, slab);
+        memmgr_heap_pool_push_back(pool, slab);
+    }
+
+    slot->xBlockSize |= xBlockAllocatedBit | memmgr_heap_pool_bit;
+    slot->pxNextFreeBlock = (BlockLink_t*)slab;
+
+    pool->stats.allocations++;
+    pool->stats.blocks_free--;
+    pool->stats.blocks_used++;
+    if(pool->stats.blocks_used > pool->stats.blocks_peak) {
+        pool->stats.blocks_peak = pool->stats.blocks_used;
+    }
+
+    memmgr_heap_pool_free_bytes -= memmgr_heap_pool_slot_size(pool_index);
+
+    return (uint8_t*)slot + xHeapStructSize;
+}
+
+/* Return a pool slot, must be called with the scheduler suspended */
+static void memmgr_heap_pool_free(BlockLink_t* slot) {
+    MemmgrHeapPoolSlab* slab = (MemmgrHeapPoolSlab*)slot->pxNextFreeBlock;
+    furi_check(slab->pool < MEMMGR_HEAP_POOL_COUNT);
+
+    MemmgrHeapPool* pool = &memmgr_heap_pools[slab->pool];
+    const bool was_full = (slab->free_slots == NULL);
+
+    slot->xBlockSize &= ~(xBlockAllocatedBit | memmgr_heap_pool_bit);
+    furi_check(slot->xBlockSize == memmgr_heap_pool_slot_size(slab->pool));
+    slot->pxNextFreeBlock = slab->free_slots;
+    slab->free_slots = slot;
+
+    pool->stats.blocks_free++;
+    pool->stats.blocks_used--;
+    memmgr_heap_pool_free_bytes += memmgr_heap_pool_slot_size(slab->pool);
+
+    if(was_full) {
+        memmgr_heap_pool_unlink(pool, slab);
+        memmgr_heap_pool_push_front(pool, slab);
+    }
+
+    if(--slab->used == 0) {
+        pool->empty++;
+        // Keep one empty slab per pool to avoid carving on every alloc/free pair
+        if(pool->empty > 1) {
+            memmgr_heap_pool_release_slab(slab);
+        }
+    }
+}
+
+size_t memmgr_heap_get_pool_count(void) {
+    return memmgr_heap_pools_enabled ? MEMMGR_HEAP_POOL_COUNT : 0;
+}
+
+void memmgr_heap_get_pool_stats(size_t index, MemmgrHeapPoolStats* stats) {
+    furi_check(index < memmgr_heap_get_pool_count());
+    furi_check(stats);
+
+    vTaskSuspendAll();
+    {
+        *stats = memmgr_heap_pools[index].stats;
+        stats->block_size = memmgr_heap_pool_sizes[index];
+    }
+    (void)xTaskResumeAll();
+}
+
+static inline size_t memmgr_heap_profile_hash(void* pointer) {
+    return (((uint32_t)pointer >> 3) * 2654435761UL) >> 24 & MEMMGR_HEAP_PROFILE_LIVE_MASK;
+}
+
+static size_t memmgr_heap_profile_get_site(MemmgrHeapProfile* profile, void* caller) {
+    for(size_t i = 0; i < profile->site_count; i++) {
+        if(profile->sites[i].caller == caller) {
+            return i;
+        }
+    }
+
+    // Last site is reserved for call sites that didn't fit
+    if(profile->site_count < MEMMGR_HEAP_PROFILE_SITES - 1) {
+        profile->sites[profile->site_count].caller = caller;
+        return profile->site_count++;
+    }
+
+    profile->site_count = MEMMGR_HEAP_PROFILE_SITES;
+    return MEMMGR_HEAP_PROFILE_SITES - 1;
+}
+
+/* Account an allocation, must be called with the scheduler suspended */
+static void memmgr_heap_profile_malloc(void* pointer, size_t size, void* caller) {
+    MemmgrHeapProfile* profile = memmgr_heap_profile;
+    if(--profile->countdown) {
+        return;
+    }
+    profile->countdown = profile->info.interval;
+    profile->info.samples++;
+
+    const size_t site_index = memmgr_heap_profile_get_site(profile, caller);
+    MemmgrHeapProfileSite* site = &profile->sites[site_index];
+    site->allocations++;
+    site->bytes += size;
+
+    // Keep the table sparse enough for short probe sequences
+    if(profile->live_count >= MEMMGR_HEAP_PROFILE_LIVE_SIZE * 3 / 4) {
+        profile->info.untracked++;
+        return;
+    }
+
+    size_t index = memmgr_heap_profile_hash(pointer);
+    while(profile->live[index].pointer) {
+        index = (index + 1) & MEMMGR_HEAP_PROFILE_LIVE_MASK;
+    }
+    profile->live[index].pointer = pointer;
+    profile->live[index].site = site_index;
+    profile->live_count++;
+
+    site->live_count++;
+    site->live_bytes += size;
+}
+
+/* Account a free, must be called with the scheduler suspended */
+static void memmgr_heap_profile_free(void* pointer, size_t size) {
+    MemmgrHeapProfile* profile = memmgr_heap_profile;
+    if(!profile->live_count) {
+        return;
+    }
+
+    size_t index = memmgr_heap_profile_hash(pointer);
+    while(profile->live[index].pointer != pointer) {
+        if(!profile->live[index].pointer) {
+            // Allocation was not sampled
+            return;
+        }
+        index = (index + 1) & MEMMGR_HEAP_PROFILE_LIVE_MASK;
+    }
+
+    MemmgrHeapProfileSite* site = &profile->sites[profile->live[index].site];
+    site->live_count--;
+    site->live_bytes -= size;
+    profile->live_count--;
+
+    // Shift following entries back, so that no probe sequence is broken
+    size_t next = index;
+    while(true) {
+        next = (next + 1) & MEMMGR_HEAP_PROFILE_LIVE_MASK;
+        if(!profile->live[next].pointer) {
+            break;
+        }
+
+        size_t home = memmgr_heap_profile_hash(profile->live[next].pointer);
+        if(((next - home) & MEMMGR_HEAP_PROFILE_LIVE_MASK) >=
+           ((next - index) & MEMMGR_HEAP_PROFILE_LIVE_MASK)) {
+            profile->live[index] = profile->live[next];
+            index = next;
+        }
+    }
+    profile->live[index].pointer = NULL;
+}
+
+bool memmgr_heap_profile_start(uint32_t interval) {
+    furi_check(interval);
+
+    bool result = false;
+    vTaskSuspendAll();
+    {
+        if(!memmgr_heap_profile) {
+            memmgr_heap_profile = prvHeapAllocate(sizeof(MemmgrHeapProfile));
+        }
+
+        if(memmgr_heap_profile) {
+            memset(memmgr_heap_profile, 0, sizeof(MemmgrHeapProfile));
+            memmgr_heap_profile->info.interval = interval;
+            memmgr_heap_profile->countdown = interval;
+            result = true;
+        }
+    }
+    (void)xTaskResumeAll();
+
+    return result;
+}
+
+void memmgr_heap_profile_stop(void) {
+    vTaskSuspendAll();
+    {
+        if(memmgr_heap_profile) {
+            memset(memmgr_heap_profile, 0, sizeof(MemmgrHeapProfile));
+            prvHeapRelease((BlockLink_t*)((uint8_t*)memmgr_heap_profile - xHeapStructSize));
+            memmgr_heap_profile = NULL;
+        }
+    }
+    (void)xTaskResumeAll();
+}
+
+bool memmgr_heap_profile_get_info(MemmgrHeapProfileInfo* info) {
+    furi_check(info);
+
+    bool result = false;
+    vTaskSuspendAll();
+    {
+        if(memmgr_heap_profile) {
+            *info = memmgr_heap_profile->info;
+            result = true;
+        }
+    }
+    (void)xTaskResumeAll();
+
+    return result;
+}
+
+size_t memmgr_heap_profile_get_sites(MemmgrHeapProfileSite* sites, size_t count) {
+    furi_check(sites);
+
+    size_t site_count = 0;
+    vTaskSuspendAll();
+    {
+        if(memmgr_heap_profile) {
+            site_count = MIN(count, memmgr_heap_profile->site_count);
+            memcpy(sites, memmgr_heap_profile->sites, site_count * sizeof(MemmgrHeapProfileSite));
+        }
+    }
+    (void)xTaskResumeAll();
+
+    // Biggest live consumers first, insertion sort is fine for a few dozen sites
+    for(size_t i = 1; i < site_count; i++) {
+        MemmgrHeapProfileSite site = sites[i];
+        size_t j = i;
+        for(; j > 0 && sites[j - 1].live_bytes < site.live_bytes; j--) {
+            sites[j] = sites[j - 1];
+        }
+        sites[j] = site;
+    }
+
+    return site_count;
+}
+
+static inline size_t memmgr_heap_histogram_index(size_t size) {
+    size_t index = 0;
+    while(index < MEMMGR_HEAP_HISTOGRAM_SIZE - 1 && size >= (32U << index)) {
+        index++;
+    }
+    return index;
+}
+
+void memmgr_heap_get_layout(MemmgrHeapLayout* layout) {
+    furi_check(layout);
+    memset(layout, 0, sizeof(MemmgrHeapLayout));
+
+    size_t map_free[MEMMGR_HEAP_MAP_SIZE] = {0};
+    size_t map_cell = 0;
+
+    vTaskSuspendAll();
+    if(pxEnd) {
+        const size_t heap_size = (uint8_t*)pxEnd - memmgr_heap_start;
+        map_cell = (heap_size + MEMMGR_HEAP_MAP_SIZE - 1) / MEMMGR_HEAP_MAP_SIZE;
+
+        // Blocks are adjacent, so the whole heap can be walked by their sizes
+        uint8_t* puc = memmgr_heap_start;
+        while(puc < (uint8_t*)pxEnd) {
+            BlockLink_t* pxLink = (void*)puc;
+            const size_t xBlockSize = pxLink->xBlockSize & ~xBlockAllocatedBit;
+            furi_check(xBlockSize >= xHeapStructSize);
+
+            if(pxLink->xBlockSize & xBlockAllocatedBit) {
+                layout->used_blocks++;
+                layout->used_bytes += xBlockSize;
+                layout->used_histogram[memmgr_heap_histogram_index(xBlockSize)]++;
+            } else {
+                layout->free_blocks++;
+                layout->free_bytes += xBlockSize;
+                layout->free_histogram[memmgr_heap_histogram_index(xBlockSize)]++;
+                layout->max_free_block = MAX(layout->max_free_block, xBlockSize);
+
+                // Free block may span several map cells
+                size_t start = puc - memmgr_heap_start;
+                const size_t end = start + xBlockSize;
+                while(start < end) {
+                    const size_t cell_end = (start / map_cell + 1) * map_cell;
+                    map_free[start / map_cell] += MIN(end, cell_end) - start;
+                    start = MIN(end, cell_end);
+                }
+            }
+
+            puc += xBlockSize;
+        }
+
+        // Slabs are accounted as the objects they hold
+        for(size_t i = 0; i < MEMMGR_HEAP_POOL_COUNT; i++) {
+            const size_t slot_size = memmgr_heap_pool_slot_size(i);
+            const size_t slot_count = memmgr_heap_pool_slot_count(i);
+
+            for(MemmgrHeapPoolSlab* slab = memmgr_heap_pools[i].head; slab; slab = slab->next) {
+                BlockLink_t* pxLink = (BlockLink_t*)((uint8_t*)slab - xHeapStructSize);
+                const size_t xBlockSize = pxLink->xBlockSize & ~xBlockAllocatedBit;
+                layout->used_blocks--;
+                layout->used_bytes -= xBlockSize;
+                layout->used_histogram[memmgr_heap_histogram_index(xBlockSize)]--;
+
+                uint8_t* slots = memmgr_heap_pool_slots(slab);
+                for(size_t j = 0; j < slot_count; j++) {
+                    BlockLink_t* slot = (BlockLink_t*)(slots + j * slot_size);
+                    if(slot->xBlockSize & xBlockAllocatedBit) {
+                        layout->used_blocks++;
+                        layout->used_bytes += slot_size;
+                        layout->used_histogram[memmgr_heap_histogram_index(slot_size)]++;
+                    }
+                }
+            }
+        }
+    }
+    (void)xTaskResumeAll();
+
+    for(size_t i = 0; i < MEMMGR_HEAP_MAP_SIZE; i++) {
+        layout->map[i] = map_cell ? map_free[i] * 100 / map_cell : 0;
+    }
+}
+
 size_t memmgr_heap_get_max_free_block(void) {
     size_t max_free_size = 0;
     BlockLink_t* pxBlock;
@@ -337,7 +895,11 @@ static void print_heap_free(void* ptr) {
 /*-----------------------------------------------------------*/
 
 void* pvPortMalloc(size_t xWantedSize) {
-    BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
+    return memmgr_heap_malloc(xWantedSize, __builtin_return_address(0));
+}
+/*-----------------------------------------------------------*/
+
+void* memmgr_heap_malloc(size_t xWantedSize, void* pvCaller) {
     void* pvReturn = NULL;
     size_t to_wipe = xWantedSize;
 
@@ -345,10 +907,6 @@ void* pvPortMalloc(size_t xWantedSize) {
         furi_crash("memmgt in ISR");
     }
 
-#ifdef HEAP_PRINT_DEBUG
-    BlockLink_t* print_heap_block = NULL;
-#endif
-
     /* If this is the first call to malloc then the heap will require
         initialisation to setup the list of free blocks. */
     if(pxEnd == NULL) {
@@ -368,104 +926,30 @@ void* pvPortMalloc(size_t xWantedSize) {
 
     vTaskSuspendAll();
     {
-        /* Check the requested block size is not so large that the top bit is
-        set.  The top bit of the block size member of the BlockLink_t structure
-        is used to determine who owns the block - the application or the
-        kernel, so it must be free. */
-        if((xWantedSize & xBlockAllocatedBit) == 0) {
-            /* The wanted size is increased so it can contain a BlockLink_t
-            structure in addition to the requested amount of bytes. */
-            if(xWantedSize > 0) {
-                xWantedSize += xHeapStructSize;
-
-                /* Ensure that blocks are always aligned to the required number
-                of bytes. */
-                if((xWantedSize & portBYTE_ALIGNMENT_MASK) != 0x00) {
-                    /* Byte alignment required. */
-                    xWantedSize += (portBYTE_ALIGNMENT - (xWantedSize & portBYTE_ALIGNMENT_MASK));
-                    configASSERT((xWantedSize & portBYTE_ALIGNMENT_MASK) == 0);
-                } else {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            } else {
-                mtCOVERAGE_TEST_MARKER();
-            }
-
-            if((xWantedSize > 0) && (xWantedSize <= xFreeBytesRemaining)) {
-                /* Traverse the list from the start (lowest address) block until
-                one of adequate size is found. */
-                pxPreviousBlock = &xStart;
-                pxBlock = xStart.pxNextFreeBlock;
-                while((pxBlock->xBlockSize < xWantedSize) && (pxBlock->pxNextFreeBlock != NULL)) {
-                    pxPreviousBlock = pxBlock;
-                    pxBlock = pxBlock->pxNextFreeBlock;
-                }
-
-                /* If the end marker was reached then a block of adequate size
-                was not found. */
-                if(pxBlock != pxEnd) {
-                    /* Return the memory space pointed to - jumping over the
-                    BlockLink_t structure at its start. */
-                    pvReturn =
-                        (void*)(((uint8_t*)pxPreviousBlock->pxNextFreeBlock) + xHeapStructSize);
-
-                    /* This block is being returned for use so must be taken out
-                    of the list of free blocks. */
-                    pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
-
-                    /* If the block is larger than required it can be split into
-                    two. */
-                    if((pxBlock->xBlockSize - xWantedSize) > heapMINIMUM_BLOCK_SIZE) {
-                        /* This block is to be split into two.  Create a new
-                        block following the number of bytes requested. The void
-                        cast is used to prevent byte alignment warnings from the
-                        compiler. */
-                        pxNewBlockLink = (void*)(((uint8_t*)pxBlock) + xWantedSize);
-                        configASSERT((((size_t)pxNewBlockLink) & portBYTE_ALIGNMENT_MASK) == 0);
-
-                        /* Calculate the sizes of two blocks split from the
-                        single block. */
-                        pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
-                        pxBlock->xBlockSize = xWantedSize;
-
-                        /* Insert the new block into the list of free blocks. */
-                        prvInsertBlockIntoFreeList(pxNewBlockLink);
-                    } else {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-
-                    xFreeBytesRemaining -= pxBlock->xBlockSize;
+        /* Small blocks are served by size-class pools, falling back to the
+        heap if there is no memory left for a new slab. */
+        pvReturn = memmgr_heap_pool_alloc(xWantedSize);
+        if(pvReturn == NULL) {
+            pvReturn = prvHeapAllocate(xWantedSize);
+        }
 
-                    if(xFreeBytesRemaining < xMinimumEverFreeBytesRemaining) {
-                        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
-                    } else {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+        if(pvReturn != NULL) {
+            memmgr_heap_update_minimum();
 
-                    /* The block is being returned - it is allocated and owned
-                    by the application and has no "next" block. */
-                    pxBlock->xBlockSize |= xBlockAllocatedBit;
-                    pxBlock->pxNextFreeBlock = NULL;
+            BlockLink_t* pxLink = (void*)(((uint8_t*)pvReturn) - xHeapStructSize);
+            const size_t xBlockSize =
+                pxLink->xBlockSize & ~(xBlockAllocatedBit | memmgr_heap_pool_bit);
+            traceMALLOC(pvReturn, xBlockSize);
 
-#ifdef HEAP_PRINT_DEBUG
-                    print_heap_block = pxBlock;
-#endif
-                } else {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            } else {
-                mtCOVERAGE_TEST_MARKER();
+            if(memmgr_heap_profile) {
+                memmgr_heap_profile_malloc(pvReturn, xBlockSize, pvCaller);
             }
-        } else {
-            mtCOVERAGE_TEST_MARKER();
         }
-
-        traceMALLOC(pvReturn, xWantedSize);
     }
     (void)xTaskResumeAll();
 
 #ifdef HEAP_PRINT_DEBUG
-    print_heap_malloc(print_heap_block, print_heap_block->xBlockSize & ~xBlockAllocatedBit);
+    print_heap_malloc(pvReturn, to_wipe);
 #endif
 
 #if(configUSE_MALLOC_FAILED_HOOK == 1)
@@ -487,6 +971,95 @@ void* pvPortMalloc(size_t xWantedSize) {
 }
 /*-----------------------------------------------------------*/
 
+static void* prvHeapAllocate(size_t xWantedSize) {
+    BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
+    void* pvReturn = NULL;
+
+    /* Check the requested block size is not so large that the top bit is
+    set.  The top bit of the block size member of the BlockLink_t structure
+    is used to determine who owns the block - the application or the
+    kernel, so it must be free. */
+    if((xWantedSize & xBlockAllocatedBit) == 0) {
+        /* The wanted size is increased so it can contain a BlockLink_t
+        structure in addition to the requested amount of bytes. */
+        if(xWantedSize > 0) {
+            xWantedSize += xHeapStructSize;
+
+            /* Ensure that blocks are always aligned to the required number
+            of bytes. */
+            if((xWantedSize & portBYTE_ALIGNMENT_MASK) != 0x00) {
+                /* Byte alignment required. */
+                xWantedSize += (portBYTE_ALIGNMENT - (xWantedSize & portBYTE_ALIGNMENT_MASK));
+                configASSERT((xWantedSize & portBYTE_ALIGNMENT_MASK) == 0);
+            } else {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        } else {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if((xWantedSize > 0) && (xWantedSize <= xFreeBytesRemaining)) {
+            /* Traverse the list from the start (lowest address) block until
+            one of adequate size is found. */
+            pxPreviousBlock = &xStart;
+            pxBlock = xStart.pxNextFreeBlock;
+            while((pxBlock->xBlockSize < xWantedSize) && (pxBlock->pxNextFreeBlock != NULL)) {
+                pxPreviousBlock = pxBlock;
+                pxBlock = pxBlock->pxNextFreeBlock;
+            }
+
+            /* If the end marker was reached then a block of adequate size
+            was not found. */
+            if(pxBlock != pxEnd) {
+                /* Return the memory space pointed to - jumping over the
+                BlockLink_t structure at its start. */
+                pvReturn = (void*)(((uint8_t*)pxPreviousBlock->pxNextFreeBlock) + xHeapStructSize);
+
+                /* This block is being returned for use so must be taken out
+                of the list of free blocks. */
+                pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+
+                /* If the block is larger than required it can be split into
+                two. */
+                if((pxBlock->xBlockSize - xWantedSize) > heapMINIMUM_BLOCK_SIZE) {
+                    /* This block is to be split into two.  Create a new
+                    block following the number of bytes requested. The void
+                    cast is used to prevent byte alignment warnings from the
+                    compiler. */
+                    pxNewBlockLink = (void*)(((uint8_t*)pxBlock) + xWantedSize);
+                    configASSERT((((size_t)pxNewBlockLink) & portBYTE_ALIGNMENT_MASK) == 0);
+
+                    /* Calculate the sizes of two blocks split from the
+                    single block. */
+                    pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+                    pxBlock->xBlockSize = xWantedSize;
+
+                    /* Insert the new block into the list of free blocks. */
+                    prvInsertBlockIntoFreeList(pxNewBlockLink);
+                } else {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+                /* The block is being returned - it is allocated and owned
+                by the application and has no "next" block. */
+                pxBlock->xBlockSize |= xBlockAllocatedBit;
+                pxBlock->pxNextFreeBlock = NULL;
+            } else {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        } else {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    } else {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
 void vPortFree(void* pv) {
     uint8_t* puc = (uint8_t*)pv;
     BlockLink_t* pxLink;
@@ -504,36 +1077,38 @@ void vPortFree(void* pv) {
         pxLink = (void*)puc;
 
         /* Check the block is actually allocated. */
-        configASSERT((pxLink->xBlockSize & xBlockAllocatedBit) != 0);
-        configASSERT(pxLink->pxNextFreeBlock == NULL);
-
-        if((pxLink->xBlockSize & xBlockAllocatedBit) != 0) {
-            if(pxLink->pxNextFreeBlock == NULL) {
-                /* The block is being returned to the heap - it is no longer
-                allocated. */
-                pxLink->xBlockSize &= ~xBlockAllocatedBit;
+        configASSERT(memmgr_heap_block_is_allocated(pxLink));
 
+        if(memmgr_heap_block_is_allocated(pxLink)) {
 #ifdef HEAP_PRINT_DEBUG
-                print_heap_free(pxLink);
+            print_heap_free(pxLink);
 #endif
 
-                vTaskSuspendAll();
-                {
-                    furi_assert((size_t)pv >= SRAM_BASE);
-                    furi_assert((size_t)pv < SRAM_BASE + 1024 * 256);
-                    furi_assert(pxLink->xBlockSize >= xHeapStructSize);
-                    furi_assert((pxLink->xBlockSize - xHeapStructSize) < 1024 * 256);
-
-                    /* Add this block to the list of free blocks. */
-                    xFreeBytesRemaining += pxLink->xBlockSize;
-                    traceFREE(pv, pxLink->xBlockSize);
-                    memset(pv, 0, pxLink->xBlockSize - xHeapStructSize);
-                    prvInsertBlockIntoFreeList((BlockLink_t*)pxLink);
+            vTaskSuspendAll();
+            {
+                furi_assert((size_t)pv >= SRAM_BASE);
+                furi_assert((size_t)pv < SRAM_BASE + 1024 * 256);
+
+                if(memmgr_heap_profile) {
+                    memmgr_heap_profile_free(
+                        pv, pxLink->xBlockSize & ~(xBlockAllocatedBit | memmgr_heap_pool_bit));
+                }
+
+                if(pxLink->xBlockSize & memmgr_heap_pool_bit) {
+                    traceFREE(
+                        pv, pxLink->xBlockSize & ~(xBlockAllocatedBit | memmgr_heap_pool_bit));
+                    memmgr_heap_pool_free(pxLink);
+                } else {
+                    const size_t xBlockSize = pxLink->xBlockSize & ~xBlockAllocatedBit;
+                    furi_assert(xBlockSize >= xHeapStructSize);
+                    furi_assert((xBlockSize - xHeapStructSize) < 1024 * 256);
+
+                    traceFREE(pv, xBlockSize);
+                    memset(pv, 0, xBlockSize - xHeapStructSize);
+                    prvHeapRelease(pxLink);
                 }
-                (void)xTaskResumeAll();
-            } else {
-                mtCOVERAGE_TEST_MARKER();
             }
+            (void)xTaskResumeAll();
         } else {
             mtCOVERAGE_TEST_MARKER();
         }
@@ -545,13 +1120,24 @@ void vPortFree(void* pv) {
 }
 /*-----------------------------------------------------------*/
 
+static void prvHeapRelease(BlockLink_t* pxLink) {
+    /* The block is being returned to the heap - it is no longer allocated. */
+    pxLink->xBlockSize &= ~xBlockAllocatedBit;
+
+    /* Add this block to the list of free blocks. */
+    xFreeBytesRemaining += pxLink->xBlockSize;
+    prvInsertBlockIntoFreeList(pxLink);
+}
+/*-----------------------------------------------------------*/
+
 size_t xPortGetTotalHeapSize(void) {
     return (size_t)&__heap_end__ - (size_t)&__heap_start__;
 }
 /*-----------------------------------------------------------*/
 
 size_t xPortGetFreeHeapSize(void) {
-    return xFreeBytesRemaining;
+    /* Free pool slots are as good as free heap for the application */
+    return xFreeBytesRemaining + memmgr_heap_pool_free_bytes;
 }
 /*-----------------------------------------------------------*/
 
@@ -581,6 +1167,7 @@ static void prvHeapInit(void) {
     }
 
     pucAlignedHeap = (uint8_t*)uxAddress;
+    memmgr_heap_start = pucAlignedHeap;
 
     /* xStart is used to hold a pointer to the first item in the list of free
     blocks.  The void cast is used to prevent compiler warnings. */
@@ -608,6 +1195,7 @@ static void prvHeapInit(void) {
 
     /* Work out the position of the top bit in a size_t variable. */
     xBlockAllocatedBit = ((size_t)1) << ((sizeof(size_t) * heapBITS_PER_BYTE) - 1);
+    memmgr_heap_pool_bit = xBlockAllocatedBit >> 1;
 }
 /*-----------------------------------------------------------*/
 
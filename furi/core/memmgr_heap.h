@@ -14,6 +14,59 @@ extern "C" {
 
 #define MEMMGR_HEAP_UNKNOWN 0xFFFFFFFF
 
+/** Size-class pool statistics */
+typedef struct {
+    size_t block_size; /**< Largest allocation served by the pool */
+    size_t slabs; /**< Slabs carved from the heap */
+    size_t blocks_used; /**< Blocks allocated right now */
+    size_t blocks_free; /**< Free blocks in carved slabs */
+    size_t blocks_peak; /**< Maximum of allocated blocks */
+    size_t allocations; /**< Allocations served by the pool */
+    size_t fallbacks; /**< Allocations passed to the heap as no slab could be carved */
+} MemmgrHeapPoolStats;
+
+/** Number of call sites tracked by the allocation profiler */
+#define MEMMGR_HEAP_PROFILE_SITES 64
+
+/** Allocation profiler call site statistics, only sampled allocations are accounted */
+typedef struct {
+    void* caller; /**< Return address of the allocation call, NULL for sites that didn't fit */
+    size_t allocations; /**< Sampled allocations */
+    size_t bytes; /**< Sampled bytes, including block headers */
+    size_t live_count; /**< Sampled allocations not freed yet */
+    size_t live_bytes; /**< Sampled bytes not freed yet */
+} MemmgrHeapProfileSite;
+
+/** Allocation profiler state */
+typedef struct {
+    uint32_t interval; /**< Every interval-th allocation is sampled */
+    uint32_t samples; /**< Sampled allocations */
+    uint32_t untracked; /**< Sampled allocations whose free is not accounted, table was full */
+} MemmgrHeapProfileInfo;
+
+/** Number of size buckets in heap layout histograms */
+#define MEMMGR_HEAP_HISTOGRAM_SIZE 12
+
+/** Number of heap segments in heap layout map */
+#define MEMMGR_HEAP_MAP_SIZE 64
+
+/** Heap layout
+ *
+ * Histogram bucket 0 counts blocks smaller than 32 bytes, bucket i counts blocks
+ * of 16 << i up to 32 << i bytes, the last bucket counts all larger blocks.
+ * Pool slots are accounted as used blocks instead of their slabs.
+ */
+typedef struct {
+    size_t free_blocks;
+    size_t free_bytes;
+    size_t max_free_block;
+    size_t used_blocks;
+    size_t used_bytes;
+    size_t free_histogram[MEMMGR_HEAP_HISTOGRAM_SIZE];
+    size_t used_histogram[MEMMGR_HEAP_HISTOGRAM_SIZE];
+    uint8_t map[MEMMGR_HEAP_MAP_SIZE]; /**< Free space of each heap segment, in percent */
+} MemmgrHeapLayout;
+
 /** Memmgr heap enable thread allocation tracking
  *
  * @param      thread_id  - thread id to track
@@ -44,6 +97,62 @@ size_t memmgr_heap_get_max_free_block(void);
  */
 void memmgr_heap_printf_free_blocks(void);
 
+/** Memmgr heap get the number of size-class pools
+ *
+ * Allocations of up to 128 bytes are served from pools when the firmware is
+ * built with FURI_MEMMGR_POOLS.
+ *
+ * @return     number of pools, 0 if pools are disabled
+ */
+size_t memmgr_heap_get_pool_count(void);
+
+/** Memmgr heap get size-class pool statistics
+ *
+ * @param      index  pool index, less than memmgr_heap_get_pool_count()
+ * @param      stats  pointer to the statistics to fill
+ */
+void memmgr_heap_get_pool_stats(size_t index, MemmgrHeapPoolStats* stats);
+
+/** Memmgr heap start the allocation profiler
+ *
+ * Restarts the profiler with cleared statistics if it is running already.
+ * Profiler storage (about 3 KiB) is taken from the heap.
+ *
+ * @param      interval  sample every interval-th allocation, 1 to sample all
+ *
+ * @return     true on success, false if there is not enough memory
+ */
+bool memmgr_heap_profile_start(uint32_t interval);
+
+/** Memmgr heap stop the allocation profiler and drop collected statistics
+ */
+void memmgr_heap_profile_stop(void);
+
+/** Memmgr heap get the allocation profiler state
+ *
+ * @param      info  pointer to the state to fill
+ *
+ * @return     true if the profiler is running
+ */
+bool memmgr_heap_profile_get_info(MemmgrHeapProfileInfo* info);
+
+/** Memmgr heap get allocation profiler call sites, biggest live consumers first
+ *
+ * @param      sites  array to fill
+ * @param      count  array size, MEMMGR_HEAP_PROFILE_SITES to get all sites
+ *
+ * @return     number of sites filled
+ */
+size_t memmgr_heap_profile_get_sites(MemmgrHeapProfileSite* sites, size_t count);
+
+/** Memmgr heap get the heap layout: block size distributions and free space map
+ *
+ * Walks the whole heap with the scheduler suspended.
+ *
+ * @param      layout  pointer to the layout to fill
+ */
+void memmgr_heap_get_layout(MemmgrHeapLayout* layout);
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,6 +2,7 @@
 
 #include <FreeRTOS.h>
 #include <queue.h>
+#include <task.h>
 
 #include "kernel.h"
 #include "check.h"
@@ -140,6 +141,103 @@ FuriStatus furi_message_queue_get(FuriMessageQueue* instance, void* msg_ptr, uin
     return stat;
 }
 
+uint32_t furi_message_queue_put_batch(
+    FuriMessageQueue* instance,
+    const void* msg_ptr,
+    uint32_t msg_count,
+    uint32_t timeout) {
+    furi_check(instance);
+    furi_check(msg_ptr || !msg_count);
+
+    QueueHandle_t hQueue = (QueueHandle_t)instance;
+    const uint8_t* msg = msg_ptr;
+    const uint32_t msg_size = instance->container.uxItemSize;
+    uint32_t count = 0;
+
+    if(furi_kernel_is_irq_or_masked() != 0U) {
+        furi_check(timeout == 0U);
+
+        BaseType_t yield = pdFALSE;
+        while(count < msg_count &&
+              xQueueSendToBackFromISR(hQueue, &msg[count * msg_size], &yield) == pdTRUE) {
+            count++;
+        }
+        portYIELD_FROM_ISR(yield);
+
+    } else {
+        // Suspend the scheduler so that a waiting receiver is woken up once per batch
+        vTaskSuspendAll();
+        while(count < msg_count && xQueueSendToBack(hQueue, &msg[count * msg_size], 0) == pdPASS) {
+            count++;
+        }
+        (void)xTaskResumeAll();
+
+        // Queue is full, wait for the first message only
+        if(count == 0 && msg_count > 0 && timeout != 0U &&
+           xQueueSendToBack(hQueue, msg, (TickType_t)timeout) == pdPASS) {
+            count++;
+
+            vTaskSuspendAll();
+            while(count < msg_count &&
+                  xQueueSendToBack(hQueue, &msg[count * msg_size], 0) == pdPASS) {
+                count++;
+            }
+            (void)xTaskResumeAll();
+        }
+    }
+
+    if(count > 0) {
+        furi_event_loop_link_notify(&instance->event_loop_link, FuriEventLoopEventIn);
+    }
+
+    return count;
+}
+
+uint32_t furi_message_queue_get_batch(
+    FuriMessageQueue* instance,
+    void* msg_ptr,
+    uint32_t msg_count,
+    uint32_t timeout) {
+    furi_check(instance);
+    furi_check(msg_ptr || !msg_count);
+
+    QueueHandle_t hQueue = (QueueHandle_t)instance;
+    uint8_t* msg = msg_ptr;
+    const uint32_t msg_size = instance->container.uxItemSize;
+    uint32_t count = 0;
+
+    if(furi_kernel_is_irq_or_masked() != 0U) {
+        furi_check(timeout == 0U);
+
+        BaseType_t yield = pdFALSE;
+        while(count < msg_count &&
+              xQueueReceiveFromISR(hQueue, &msg[count * msg_size], &yield) == pdPASS) {
+            count++;
+        }
+        portYIELD_FROM_ISR(yield);
+
+    } else {
+        // Queue is empty, wait for the first message only
+        if(msg_count > 0 && timeout != 0U && uxQueueMessagesWaiting(hQueue) == 0 &&
+           xQueueReceive(hQueue, msg, (TickType_t)timeout) == pdPASS) {
+            count++;
+        }
+
+        // Suspend the scheduler so that a waiting sender is woken up once per batch
+        vTaskSuspendAll();
+        while(count < msg_count && xQueueReceive(hQueue, &msg[count * msg_size], 0) == pdPASS) {
+            count++;
+        }
+        (void)xTaskResumeAll();
+    }
+
+    if(count > 0) {
+        furi_event_loop_link_notify(&instance->event_loop_link, FuriEventLoopEventOut);
+    }
+
+    return count;
+}
+
 uint32_t furi_message_queue_get_capacity(FuriMessageQueue* instance) {
     furi_check(instance);
 
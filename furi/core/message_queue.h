@@ -48,6 +48,44 @@ FuriStatus
  */
 FuriStatus furi_message_queue_get(FuriMessageQueue* instance, void* msg_ptr, uint32_t timeout);
 
+/** Put several messages into queue
+ *
+ * Puts as many messages as there is space for. If the queue is full, waits
+ * for space for the first one. Tasks waiting for messages are woken up once
+ * per batch instead of once per message. Can be used from ISR with zero
+ * timeout.
+ *
+ * @param      instance   pointer to FuriMessageQueue instance
+ * @param[in]  msg_ptr    pointer to msg_count consecutive messages
+ * @param[in]  msg_count  number of messages to put
+ * @param[in]  timeout    The timeout
+ *
+ * @return     number of messages put
+ */
+uint32_t furi_message_queue_put_batch(
+    FuriMessageQueue* instance,
+    const void* msg_ptr,
+    uint32_t msg_count,
+    uint32_t timeout);
+
+/** Get several messages from queue
+ *
+ * Gets up to msg_count messages that are in the queue. If the queue is empty,
+ * waits for the first one. Can be used from ISR with zero timeout.
+ *
+ * @param      instance   pointer to FuriMessageQueue instance
+ * @param      msg_ptr    buffer for msg_count consecutive messages
+ * @param[in]  msg_count  maximum number of messages to get
+ * @param[in]  timeout    The timeout
+ *
+ * @return     number of messages received
+ */
+uint32_t furi_message_queue_get_batch(
+    FuriMessageQueue* instance,
+    void* msg_ptr,
+    uint32_t msg_count,
+    uint32_t timeout);
+
 /** Get queue capacity
  *
  * @param      instance  pointer to FuriMessageQueue instance
@@ -1,27 +1,106 @@
 #include "pubsub.h"
 #include "check.h"
+#include "common_defines.h"
+#include "kernel.h"
+#include "message_queue.h"
 #include "mutex.h"
 
-#include <m-list.h>
+#include <string.h>
 
 struct FuriPubSubSubscription {
     FuriPubSubCallback callback;
     void* callback_context;
+    uint32_t event_mask;
+
+    // Deferred delivery, NULL for synchronous subscriptions
+    FuriEventLoop* event_loop;
+    FuriMessageQueue* queue;
+    uint8_t message[];
 };
 
-LIST_DEF(FuriPubSubSubscriptionList, FuriPubSubSubscription, M_POD_OPLIST);
+/** Immutable snapshot of subscribers, replaced as a whole on every change */
+typedef struct {
+    volatile uint32_t readers;
+    size_t count;
+    FuriPubSubSubscription* items[];
+} FuriPubSubSubscriberArray;
 
 struct FuriPubSub {
-    FuriPubSubSubscriptionList_t items;
-    FuriMutex* mutex;
+    FuriPubSubSubscriberArray* volatile subscribers;
+    FuriMutex* mutex; /**< Serializes subscribers array updates, publish does not take it */
 };
 
+static FuriPubSubSubscriberArray* furi_pubsub_subscriber_array_alloc(size_t count) {
+    FuriPubSubSubscriberArray* array =
+        malloc(sizeof(FuriPubSubSubscriberArray) + sizeof(FuriPubSubSubscription*) * count);
+    array->count = count;
+    return array;
+}
+
+static FuriPubSubSubscriberArray* furi_pubsub_read_lock(FuriPubSub* pubsub) {
+    // Only the pointer load and the counter increment need to be atomic
+    FURI_CRITICAL_ENTER();
+    FuriPubSubSubscriberArray* array = pubsub->subscribers;
+    array->readers++;
+    FURI_CRITICAL_EXIT();
+
+    return array;
+}
+
+static void furi_pubsub_read_unlock(FuriPubSubSubscriberArray* array) {
+    FURI_CRITICAL_ENTER();
+    array->readers--;
+    FURI_CRITICAL_EXIT();
+}
+
+// Must be called with the mutex held
+static void furi_pubsub_replace(FuriPubSub* pubsub, FuriPubSubSubscriberArray* array) {
+    FURI_CRITICAL_ENTER();
+    FuriPubSubSubscriberArray* old_array = pubsub->subscribers;
+    pubsub->subscribers = array;
+    FURI_CRITICAL_EXIT();
+
+    // Publishers that got the old array have registered by now, wait for them
+    while(true) {
+        FURI_CRITICAL_ENTER();
+        const uint32_t readers = old_array->readers;
+        FURI_CRITICAL_EXIT();
+
+        if(!readers) break;
+        furi_delay_tick(1);
+    }
+
+    free(old_array);
+}
+
+static void furi_pubsub_add(FuriPubSub* pubsub, FuriPubSubSubscription* subscription) {
+    furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
+
+    FuriPubSubSubscriberArray* old_array = pubsub->subscribers;
+    FuriPubSubSubscriberArray* array = furi_pubsub_subscriber_array_alloc(old_array->count + 1);
+
+    memcpy(array->items, old_array->items, sizeof(FuriPubSubSubscription*) * old_array->count);
+    array->items[old_array->count] = subscription;
+
+    furi_pubsub_replace(pubsub, array);
+
+    furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
+}
+
+static bool furi_pubsub_deferred_callback(FuriEventLoopObject* object, void* context) {
+    FuriPubSubSubscription* subscription = context;
+
+    furi_check(furi_message_queue_get(object, subscription->message, 0) == FuriStatusOk);
+    subscription->callback(subscription->message, subscription->callback_context);
+
+    return true;
+}
+
 FuriPubSub* furi_pubsub_alloc(void) {
     FuriPubSub* pubsub = malloc(sizeof(FuriPubSub));
 
     pubsub->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
-
-    FuriPubSubSubscriptionList_init(pubsub->items);
+    pubsub->subscribers = furi_pubsub_subscriber_array_alloc(0);
 
     return pubsub;
 }
@@ -29,9 +108,9 @@ FuriPubSub* furi_pubsub_alloc(void) {
 void furi_pubsub_free(FuriPubSub* pubsub) {
     furi_assert(pubsub);
 
-    furi_check(FuriPubSubSubscriptionList_size(pubsub->items) == 0);
+    furi_check(pubsub->subscribers->count == 0);
 
-    FuriPubSubSubscriptionList_clear(pubsub->items);
+    free(pubsub->subscribers);
 
     furi_mutex_free(pubsub->mutex);
 
@@ -40,20 +119,61 @@ void furi_pubsub_free(FuriPubSub* pubsub) {
 
 FuriPubSubSubscription*
     furi_pubsub_subscribe(FuriPubSub* pubsub, FuriPubSubCallback callback, void* callback_context) {
+    return furi_pubsub_subscribe_mask(pubsub, FURI_PUBSUB_EVENT_ALL, callback, callback_context);
+}
+
+FuriPubSubSubscription* furi_pubsub_subscribe_mask(
+    FuriPubSub* pubsub,
+    uint32_t event_mask,
+    FuriPubSubCallback callback,
+    void* callback_context) {
     furi_check(pubsub);
     furi_check(callback);
 
-    furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
-    // put uninitialized item to the list
-    FuriPubSubSubscription* item = FuriPubSubSubscriptionList_push_raw(pubsub->items);
+    FuriPubSubSubscription* subscription = malloc(sizeof(FuriPubSubSubscription));
 
-    // initialize item
-    item->callback = callback;
-    item->callback_context = callback_context;
+    subscription->callback = callback;
+    subscription->callback_context = callback_context;
+    subscription->event_mask = event_mask;
 
-    furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
+    furi_pubsub_add(pubsub, subscription);
 
-    return item;
+    return subscription;
+}
+
+FuriPubSubSubscription* furi_pubsub_subscribe_event_loop(
+    FuriPubSub* pubsub,
+    FuriEventLoop* event_loop,
+    uint32_t event_mask,
+    size_t message_size,
+    size_t queue_size,
+    FuriPubSubCallback callback,
+    void* callback_context) {
+    furi_check(pubsub);
+    furi_check(event_loop);
+    furi_check(message_size);
+    furi_check(queue_size);
+    furi_check(callback);
+
+    FuriPubSubSubscription* subscription =
+        malloc(sizeof(FuriPubSubSubscription) + message_size);
+
+    subscription->callback = callback;
+    subscription->callback_context = callback_context;
+    subscription->event_mask = event_mask;
+    subscription->event_loop = event_loop;
+    subscription->queue = furi_message_queue_alloc(queue_size, message_size);
+
+    furi_event_loop_subscribe_message_queue(
+        event_loop,
+        subscription->queue,
+        FuriEventLoopEventIn,
+        furi_pubsub_deferred_callback,
+        subscription);
+
+    furi_pubsub_add(pubsub, subscription);
+
+    return subscription;
 }
 
 void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_subscription) {
@@ -63,15 +183,22 @@ void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_
     furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
     bool result = false;
 
-    // iterate over items
-    FuriPubSubSubscriptionList_it_t it;
-    for(FuriPubSubSubscriptionList_it(it, pubsub->items); !FuriPubSubSubscriptionList_end_p(it);
-        FuriPubSubSubscriptionList_next(it)) {
-        const FuriPubSubSubscription* item = FuriPubSubSubscriptionList_cref(it);
+    FuriPubSubSubscriberArray* old_array = pubsub->subscribers;
+
+    // find our element
+    for(size_t i = 0; i < old_array->count; i++) {
+        if(old_array->items[i] == pubsub_subscription) {
+            FuriPubSubSubscriberArray* array =
+                furi_pubsub_subscriber_array_alloc(old_array->count - 1);
 
-        // if the iterator is equal to our element
-        if(item == pubsub_subscription) {
-            FuriPubSubSubscriptionList_remove(pubsub->items, it);
+            memcpy(array->items, old_array->items, sizeof(FuriPubSubSubscription*) * i);
+            memcpy(
+                &array->items[i],
+                &old_array->items[i + 1],
+                sizeof(FuriPubSubSubscription*) * (old_array->count - i - 1));
+
+            // No publisher refers to the subscription once the old array is released
+            furi_pubsub_replace(pubsub, array);
             result = true;
             break;
         }
@@ -79,20 +206,39 @@ void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_
 
     furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
     furi_check(result);
+
+    if(pubsub_subscription->event_loop) {
+        furi_event_loop_unsubscribe(pubsub_subscription->event_loop, pubsub_subscription->queue);
+        furi_message_queue_free(pubsub_subscription->queue);
+    }
+
+    free(pubsub_subscription);
 }
 
 void furi_pubsub_publish(FuriPubSub* pubsub, void* message) {
+    furi_pubsub_publish_event(pubsub, message, FURI_PUBSUB_EVENT_ALL);
+}
+
+void furi_pubsub_publish_event(FuriPubSub* pubsub, void* message, uint32_t event) {
     furi_check(pubsub);
 
-    furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
+    FuriPubSubSubscriberArray* array = furi_pubsub_read_lock(pubsub);
 
     // iterate over subscribers
-    FuriPubSubSubscriptionList_it_t it;
-    for(FuriPubSubSubscriptionList_it(it, pubsub->items); !FuriPubSubSubscriptionList_end_p(it);
-        FuriPubSubSubscriptionList_next(it)) {
-        const FuriPubSubSubscription* item = FuriPubSubSubscriptionList_cref(it);
-        item->callback(message, item->callback_context);
+    for(size_t i = 0; i < array->count; i++) {
+        FuriPubSubSubscription* item = array->items[i];
+
+        if(!(item->event_mask & event)) {
+            continue;
+        }
+
+        if(item->queue) {
+            // Deferred subscribers get a copy, it is dropped if their queue is full
+            furi_message_queue_put(item->queue, message, 0);
+        } else {
+            item->callback(message, item->callback_context);
+        }
     }
 
-    furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
+    furi_pubsub_read_unlock(array);
 }
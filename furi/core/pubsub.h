@@ -4,10 +4,15 @@
  */
 #pragma once
 
+#include "event_loop.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** Event mask matching all events */
+#define FURI_PUBSUB_EVENT_ALL (UINT32_MAX)
+
 /** FuriPubSub Callback type */
 typedef void (*FuriPubSubCallback)(const void* message, void* context);
 
@@ -33,7 +38,8 @@ void furi_pubsub_free(FuriPubSub* pubsub);
 
 /** Subscribe to FuriPubSub
  * 
- * Threadsafe, Reentrable
+ * Threadsafe, Reentrable. Callback is called on the publisher's thread for
+ * every published message, possibly from several threads at once.
  * 
  * @param      pubsub            pointer to FuriPubSub instance
  * @param[in]  callback          The callback
@@ -44,10 +50,55 @@ void furi_pubsub_free(FuriPubSub* pubsub);
 FuriPubSubSubscription*
     furi_pubsub_subscribe(FuriPubSub* pubsub, FuriPubSubCallback callback, void* callback_context);
 
+/** Subscribe to a subset of FuriPubSub events
+ *
+ * Threadsafe, Reentrable. Callback is called on the publisher's thread only
+ * for messages published with an event that matches the mask.
+ *
+ * @param      pubsub            pointer to FuriPubSub instance
+ * @param[in]  event_mask        events to receive, see furi_pubsub_publish_event
+ * @param[in]  callback          The callback
+ * @param      callback_context  The callback context
+ *
+ * @return     pointer to FuriPubSubSubscription instance
+ */
+FuriPubSubSubscription* furi_pubsub_subscribe_mask(
+    FuriPubSub* pubsub,
+    uint32_t event_mask,
+    FuriPubSubCallback callback,
+    void* callback_context);
+
+/** Subscribe to FuriPubSub with delivery on an event loop
+ *
+ * Messages are copied into a queue and the callback is called by the event
+ * loop, so slow subscribers do not hold back the publisher. Messages are
+ * dropped when the queue is full. Must be called from the event loop thread,
+ * so must be furi_pubsub_unsubscribe.
+ *
+ * @param      pubsub            pointer to FuriPubSub instance
+ * @param      event_loop        event loop to deliver messages on
+ * @param[in]  event_mask        events to receive, see furi_pubsub_publish_event
+ * @param[in]  message_size      size of published messages
+ * @param[in]  queue_size        maximum number of undelivered messages
+ * @param[in]  callback          The callback
+ * @param      callback_context  The callback context
+ *
+ * @return     pointer to FuriPubSubSubscription instance
+ */
+FuriPubSubSubscription* furi_pubsub_subscribe_event_loop(
+    FuriPubSub* pubsub,
+    FuriEventLoop* event_loop,
+    uint32_t event_mask,
+    size_t message_size,
+    size_t queue_size,
+    FuriPubSubCallback callback,
+    void* callback_context);
+
 /** Unsubscribe from FuriPubSub
  * 
- * No use of `pubsub_subscription` allowed after call of this method
- * Threadsafe, Reentrable.
+ * No use of `pubsub_subscription` allowed after call of this method, the
+ * callback is not running and will not be called once it returns.
+ * Threadsafe, Reentrable, must not be called from the subscription callback.
  *
  * @param      pubsub               pointer to FuriPubSub instance
  * @param      pubsub_subscription  pointer to FuriPubSubSubscription instance
@@ -56,13 +107,23 @@ void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_
 
 /** Publish message to FuriPubSub
  *
- * Threadsafe, Reentrable.
+ * Threadsafe, Reentrable, does not block on other publishers.
  * 
  * @param      pubsub   pointer to FuriPubSub instance
  * @param      message  message pointer to publish
  */
 void furi_pubsub_publish(FuriPubSub* pubsub, void* message);
 
+/** Publish message to FuriPubSub subscribers of the event
+ *
+ * Threadsafe, Reentrable, does not block on other publishers.
+ *
+ * @param      pubsub   pointer to FuriPubSub instance
+ * @param      message  message pointer to publish
+ * @param[in]  event    publisher defined event bits, matched against subscription masks
+ */
+void furi_pubsub_publish_event(FuriPubSub* pubsub, void* message, uint32_t event);
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,6 +2,7 @@
 
 #include <FreeRTOS.h>
 #include <FreeRTOS-Kernel/include/stream_buffer.h>
+#include <task.h>
 
 #include "check.h"
 #include "common_defines.h"
@@ -9,7 +10,12 @@
 #include "event_loop_link_i.h"
 
 // Internal FreeRTOS member names
-#define xTriggerLevelBytes uxDummy1[3]
+#define xTail                 uxDummy1[0]
+#define xHead                 uxDummy1[1]
+#define xLength               uxDummy1[2]
+#define xTriggerLevelBytes    uxDummy1[3]
+#define xTaskWaitingToReceive pvDummy2[0]
+#define xTaskWaitingToSend    pvDummy2[1]
 
 struct FuriStreamBuffer {
     StaticStreamBuffer_t container;
@@ -109,6 +115,115 @@ size_t furi_stream_buffer_receive(
     return ret;
 }
 
+static inline size_t furi_stream_buffer_get_used(const StaticStreamBuffer_t* container) {
+    size_t used = container->xLength + container->xHead - container->xTail;
+    if(used >= container->xLength) used -= container->xLength;
+    return used;
+}
+
+// Same wake up as FreeRTOS does on send and receive completion
+static void furi_stream_buffer_notify_task(TaskHandle_t task) {
+    if(FURI_IS_IRQ_MODE()) {
+        BaseType_t yield = pdFALSE;
+        xTaskNotifyFromISR(task, 0, eNoAction, &yield);
+        portYIELD_FROM_ISR(yield);
+    } else {
+        xTaskNotify(task, 0, eNoAction);
+    }
+}
+
+void* furi_stream_buffer_send_reserve(FuriStreamBuffer* stream_buffer, size_t* length) {
+    furi_check(stream_buffer);
+    furi_check(length);
+
+    StaticStreamBuffer_t* container = &stream_buffer->container;
+
+    FURI_CRITICAL_ENTER();
+    const size_t head = container->xHead;
+    // One byte is always kept free to tell a full buffer from an empty one
+    const size_t space = container->xLength - furi_stream_buffer_get_used(container) - 1;
+    FURI_CRITICAL_EXIT();
+
+    *length = MIN(*length, MIN(space, container->xLength - head));
+
+    return &stream_buffer->buffer[head];
+}
+
+void furi_stream_buffer_send_commit(FuriStreamBuffer* stream_buffer, size_t length) {
+    furi_check(stream_buffer);
+
+    if(length == 0) return;
+
+    StaticStreamBuffer_t* container = &stream_buffer->container;
+    TaskHandle_t receiver = NULL;
+
+    FURI_CRITICAL_ENTER();
+    furi_check(length < container->xLength - furi_stream_buffer_get_used(container));
+    furi_check(length <= container->xLength - container->xHead);
+
+    size_t head = container->xHead + length;
+    if(head == container->xLength) head = 0;
+    container->xHead = head;
+
+    const bool triggered =
+        furi_stream_buffer_get_used(container) >= container->xTriggerLevelBytes;
+    if(triggered) {
+        receiver = container->xTaskWaitingToReceive;
+        container->xTaskWaitingToReceive = NULL;
+    }
+    FURI_CRITICAL_EXIT();
+
+    if(receiver) {
+        furi_stream_buffer_notify_task(receiver);
+    }
+
+    if(triggered) {
+        furi_event_loop_link_notify(&stream_buffer->event_loop_link, FuriEventLoopEventIn);
+    }
+}
+
+const void* furi_stream_buffer_receive_acquire(FuriStreamBuffer* stream_buffer, size_t* length) {
+    furi_check(stream_buffer);
+    furi_check(length);
+
+    StaticStreamBuffer_t* container = &stream_buffer->container;
+
+    FURI_CRITICAL_ENTER();
+    const size_t tail = container->xTail;
+    const size_t used = furi_stream_buffer_get_used(container);
+    FURI_CRITICAL_EXIT();
+
+    *length = MIN(*length, MIN(used, container->xLength - tail));
+
+    return &stream_buffer->buffer[tail];
+}
+
+void furi_stream_buffer_receive_release(FuriStreamBuffer* stream_buffer, size_t length) {
+    furi_check(stream_buffer);
+
+    if(length == 0) return;
+
+    StaticStreamBuffer_t* container = &stream_buffer->container;
+
+    FURI_CRITICAL_ENTER();
+    furi_check(length <= furi_stream_buffer_get_used(container));
+    furi_check(length <= container->xLength - container->xTail);
+
+    size_t tail = container->xTail + length;
+    if(tail == container->xLength) tail = 0;
+    container->xTail = tail;
+
+    TaskHandle_t sender = container->xTaskWaitingToSend;
+    container->xTaskWaitingToSend = NULL;
+    FURI_CRITICAL_EXIT();
+
+    if(sender) {
+        furi_stream_buffer_notify_task(sender);
+    }
+
+    furi_event_loop_link_notify(&stream_buffer->event_loop_link, FuriEventLoopEventOut);
+}
+
 size_t furi_stream_buffer_bytes_available(FuriStreamBuffer* stream_buffer) {
     furi_check(stream_buffer);
 
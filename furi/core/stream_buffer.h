@@ -95,6 +95,52 @@ size_t furi_stream_buffer_receive(
     size_t length,
     uint32_t timeout);
 
+/**
+ * @brief Gets a region of the stream buffer to write bytes into without copying.
+ * Bytes become available to the receiver after furi_stream_buffer_send_commit().
+ * The region is contiguous, so it may be shorter than the free space when the
+ * free space wraps around the end of the buffer. Can be used from ISR.
+ * 
+ * @param stream_buffer The stream buffer instance.
+ * @param length Maximum number of bytes to reserve, set to the number of bytes
+ * that can be written to the region, may be zero.
+ * @return Pointer to the region.
+ */
+void* furi_stream_buffer_send_reserve(FuriStreamBuffer* stream_buffer, size_t* length);
+
+/**
+ * @brief Makes bytes written to the region from furi_stream_buffer_send_reserve()
+ * available to the receiver and wakes it up as furi_stream_buffer_send() would.
+ * Can be used from ISR.
+ * 
+ * @param stream_buffer The stream buffer instance.
+ * @param length Number of bytes written, at most the reserved length.
+ */
+void furi_stream_buffer_send_commit(FuriStreamBuffer* stream_buffer, size_t length);
+
+/**
+ * @brief Gets a region of the stream buffer to read bytes from without copying.
+ * Bytes stay in the stream buffer until furi_stream_buffer_receive_release().
+ * The region is contiguous, so it may be shorter than the available data when
+ * the data wraps around the end of the buffer. Can be used from ISR.
+ * 
+ * @param stream_buffer The stream buffer instance.
+ * @param length Maximum number of bytes to acquire, set to the number of bytes
+ * that can be read from the region, may be zero.
+ * @return Pointer to the region.
+ */
+const void* furi_stream_buffer_receive_acquire(FuriStreamBuffer* stream_buffer, size_t* length);
+
+/**
+ * @brief Removes bytes read from the region from furi_stream_buffer_receive_acquire()
+ * and wakes up the sender waiting for space as furi_stream_buffer_receive() would.
+ * Can be used from ISR.
+ * 
+ * @param stream_buffer The stream buffer instance.
+ * @param length Number of bytes read, at most the acquired length.
+ */
+void furi_stream_buffer_receive_release(FuriStreamBuffer* stream_buffer, size_t length);
+
 /**
  * @brief Queries a stream buffer to see how much data it contains, which is equal to
  * the number of bytes that can be read from the stream buffer before the stream
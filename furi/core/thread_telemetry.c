@@ -0,0 +1,345 @@
+#include "thread_telemetry.h"
+#include "check.h"
+#include "common_defines.h"
+#include "kernel.h"
+#include "memmgr.h"
+#include "memmgr_heap.h"
+#include "mutex.h"
+
+#include <furi_hal_cortex.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include <task_control_block.h>
+
+#include <string.h>
+
+#define FURI_THREAD_TELEMETRY_STACK_SIZE (1024U)
+#define FURI_THREAD_TELEMETRY_FLAG_WAKE  (1UL << 0)
+
+/* Threads remember their slot in the TCB field reserved for trace code:
+ * generation in the upper bits, slot index + 1 in the lower ones, 0 if no
+ * slot was free. Slots assigned before the last start never match.
+ */
+#define FURI_THREAD_TELEMETRY_SLOT_BITS       (8U)
+#define FURI_THREAD_TELEMETRY_SLOT_MASK       ((1U << FURI_THREAD_TELEMETRY_SLOT_BITS) - 1)
+#define FURI_THREAD_TELEMETRY_GENERATION_MASK (UINT32_MAX >> FURI_THREAD_TELEMETRY_SLOT_BITS)
+
+static_assert(FURI_THREAD_TELEMETRY_THREADS < FURI_THREAD_TELEMETRY_SLOT_MASK);
+static_assert(!(FURI_THREAD_TELEMETRY_HISTORY & (FURI_THREAD_TELEMETRY_HISTORY - 1)));
+
+typedef struct {
+    TaskControlBlock* task; /**< NULL for a free slot */
+    char name[FURI_THREAD_TELEMETRY_NAME_SIZE];
+    uint32_t first; /**< Number of the first sample taken for the thread */
+    uint32_t run_time; /**< Run-time counter of the thread at the previous sample */
+    uint32_t switches;
+    uint32_t ready_time; /**< Run-time counter when the thread became ready */
+    uint32_t latency_max; /**< In run-time counter cycles */
+    bool ready;
+    FuriThreadTelemetrySample history[FURI_THREAD_TELEMETRY_HISTORY];
+} FuriThreadTelemetrySlot;
+
+typedef struct {
+    FuriThreadTelemetryInfo info;
+    uint32_t run_time; /**< Total run-time counter at the previous sample */
+    FuriThreadTelemetrySlot slots[FURI_THREAD_TELEMETRY_THREADS];
+} FuriThreadTelemetry;
+
+/* Trace hooks are never called with the scheduler suspended, which is what
+ * protects the state from them and from the worker.
+ */
+static FuriThreadTelemetry* furi_thread_telemetry = NULL;
+static uint32_t furi_thread_telemetry_generation = 0;
+static FuriMutex* furi_thread_telemetry_mutex = NULL; /**< Serializes start and stop */
+static FuriThread* furi_thread_telemetry_worker_thread = NULL;
+
+static FuriThreadTelemetrySlot*
+    furi_thread_telemetry_get_slot(FuriThreadTelemetry* telemetry, TaskControlBlock* tcb) {
+    const uint32_t number = tcb->uxTaskNumber;
+
+    if((number >> FURI_THREAD_TELEMETRY_SLOT_BITS) == furi_thread_telemetry_generation) {
+        const uint32_t index = number & FURI_THREAD_TELEMETRY_SLOT_MASK;
+        if(!index) {
+            return NULL;
+        }
+        // Restarted threads reuse their TCB, the slot may be taken by another thread by now
+        if(telemetry->slots[index - 1].task == tcb) {
+            return &telemetry->slots[index - 1];
+        }
+    }
+
+    FuriThreadTelemetrySlot* slot = NULL;
+    uint32_t index = 0;
+    for(size_t i = 0; i < FURI_THREAD_TELEMETRY_THREADS; i++) {
+        if(!telemetry->slots[i].task) {
+            slot = &telemetry->slots[i];
+            index = i + 1;
+            break;
+        }
+    }
+
+    if(slot) {
+        slot->task = tcb;
+        memcpy(slot->name, tcb->pcTaskName, FURI_THREAD_TELEMETRY_NAME_SIZE - 1);
+        slot->name[FURI_THREAD_TELEMETRY_NAME_SIZE - 1] = '\0';
+        slot->first = telemetry->info.samples;
+        slot->run_time = tcb->ulRunTimeCounter;
+        slot->switches = 0;
+        slot->latency_max = 0;
+        slot->ready = false;
+    } else {
+        telemetry->info.untracked++;
+    }
+
+    tcb->uxTaskNumber = (furi_thread_telemetry_generation << FURI_THREAD_TELEMETRY_SLOT_BITS) |
+                        index;
+
+    return slot;
+}
+
+// Called by the kernel with interrupts masked, right after the thread became current
+void furi_thread_telemetry_task_switched_in(TaskHandle_t task) {
+    FuriThreadTelemetry* telemetry = furi_thread_telemetry;
+    if(!telemetry) return;
+
+    FuriThreadTelemetrySlot* slot =
+        furi_thread_telemetry_get_slot(telemetry, (TaskControlBlock*)task);
+    if(!slot) return;
+
+    slot->switches++;
+    if(slot->ready) {
+        slot->ready = false;
+        const uint32_t latency = portGET_RUN_TIME_COUNTER_VALUE() - slot->ready_time;
+        if(latency > slot->latency_max) {
+            slot->latency_max = latency;
+        }
+    }
+}
+
+// Called by the kernel with interrupts masked, from threads and interrupts
+void furi_thread_telemetry_task_ready(TaskHandle_t task) {
+    FuriThreadTelemetry* telemetry = furi_thread_telemetry;
+    if(!telemetry) return;
+
+    // Priority changes put the running thread back to the ready list too
+    if(task == xTaskGetCurrentTaskHandle()) return;
+
+    FuriThreadTelemetrySlot* slot =
+        furi_thread_telemetry_get_slot(telemetry, (TaskControlBlock*)task);
+    if(slot && !slot->ready) {
+        slot->ready = true;
+        slot->ready_time = portGET_RUN_TIME_COUNTER_VALUE();
+    }
+}
+
+// Called by the kernel with interrupts masked, before the thread is removed
+void furi_thread_telemetry_task_delete(TaskHandle_t task) {
+    FuriThreadTelemetry* telemetry = furi_thread_telemetry;
+    if(!telemetry) return;
+
+    TaskControlBlock* tcb = (TaskControlBlock*)task;
+    const uint32_t number = tcb->uxTaskNumber;
+    const uint32_t index = number & FURI_THREAD_TELEMETRY_SLOT_MASK;
+
+    if((number >> FURI_THREAD_TELEMETRY_SLOT_BITS) == furi_thread_telemetry_generation && index &&
+       telemetry->slots[index - 1].task == tcb) {
+        telemetry->slots[index - 1].task = NULL;
+    }
+}
+
+static inline uint16_t furi_thread_telemetry_saturate(uint64_t value) {
+    return value > UINT16_MAX ? UINT16_MAX : value;
+}
+
+// Returns the time to the next sample, FuriWaitForever if telemetry is stopped
+static uint32_t furi_thread_telemetry_sample(bool take) {
+    uint32_t timeout = FuriWaitForever;
+
+    vTaskSuspendAll();
+    do {
+        FuriThreadTelemetry* telemetry = furi_thread_telemetry;
+        if(!telemetry) break;
+
+        timeout = furi_ms_to_ticks(telemetry->info.period);
+        if(!take) break;
+
+        uint32_t count = uxTaskGetNumberOfTasks();
+        TaskStatus_t* task = pvPortMalloc(count * sizeof(TaskStatus_t));
+        if(!task) break;
+
+        configRUN_TIME_COUNTER_TYPE total_run_time;
+        count = uxTaskGetSystemState(task, count, &total_run_time);
+
+        const uint32_t elapsed = total_run_time - telemetry->run_time;
+        const uint32_t cycles_per_us = furi_hal_cortex_instructions_per_microsecond();
+        const size_t index = telemetry->info.samples % FURI_THREAD_TELEMETRY_HISTORY;
+        telemetry->run_time = total_run_time;
+
+        for(uint32_t i = 0; i < count; i++) {
+            // Deleted threads are gone from telemetry already, their TCB is yet to be freed
+            if(task[i].eCurrentState == eDeleted) continue;
+
+            FuriThreadTelemetrySlot* slot =
+                furi_thread_telemetry_get_slot(telemetry, (TaskControlBlock*)task[i].xHandle);
+            if(!slot) continue;
+
+            const uint32_t run_time = task[i].ulRunTimeCounter - slot->run_time;
+            const uint64_t cpu = elapsed ? (uint64_t)run_time * 10000U / elapsed : 0;
+            const size_t stack_min_free = task[i].usStackHighWaterMark * sizeof(StackType_t);
+
+            FuriThreadTelemetrySample* sample = &slot->history[index];
+            sample->cpu = furi_thread_telemetry_saturate(cpu);
+            sample->switches = furi_thread_telemetry_saturate(slot->switches);
+            sample->latency_max =
+                furi_thread_telemetry_saturate(slot->latency_max / cycles_per_us);
+            sample->stack_min_free = furi_thread_telemetry_saturate(stack_min_free);
+
+            slot->run_time = task[i].ulRunTimeCounter;
+            slot->switches = 0;
+            slot->latency_max = 0;
+        }
+
+        telemetry->info.samples++;
+        vPortFree(task);
+    } while(false);
+    (void)xTaskResumeAll();
+
+    return timeout;
+}
+
+static int32_t furi_thread_telemetry_worker(void* context) {
+    UNUSED(context);
+
+    uint32_t timeout = FuriWaitForever;
+    while(true) {
+        // Start and stop wake the worker up to restart the period
+        const uint32_t flags = furi_thread_flags_wait(
+            FURI_THREAD_TELEMETRY_FLAG_WAKE, FuriFlagWaitAny, timeout);
+        timeout = furi_thread_telemetry_sample(flags == (uint32_t)FuriFlagErrorTimeout);
+    }
+
+    return 0;
+}
+
+void furi_thread_telemetry_init(void) {
+    furi_thread_telemetry_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+}
+
+bool furi_thread_telemetry_start(uint32_t period) {
+    furi_check(period && period <= FURI_THREAD_TELEMETRY_PERIOD_MAX);
+
+    // Don't hold two copies of storage at a time
+    furi_thread_telemetry_stop();
+
+    furi_check(furi_mutex_acquire(furi_thread_telemetry_mutex, FuriWaitForever) == FuriStatusOk);
+
+    bool result = false;
+    if(memmgr_heap_get_max_free_block() >= sizeof(FuriThreadTelemetry)) {
+        FuriThreadTelemetry* telemetry = malloc(sizeof(FuriThreadTelemetry));
+        telemetry->info.period = period;
+
+        if(!furi_thread_telemetry_worker_thread) {
+            furi_thread_telemetry_worker_thread = furi_thread_alloc_service(
+                "TelemetryWorker",
+                FURI_THREAD_TELEMETRY_STACK_SIZE,
+                furi_thread_telemetry_worker,
+                NULL);
+            // Sample on time even when the threads being watched are starving the system
+            furi_thread_set_priority(
+                furi_thread_telemetry_worker_thread, FuriThreadPriorityHighest);
+            furi_thread_start(furi_thread_telemetry_worker_thread);
+        }
+
+        vTaskSuspendAll();
+        {
+            furi_thread_telemetry_generation =
+                (furi_thread_telemetry_generation + 1) & FURI_THREAD_TELEMETRY_GENERATION_MASK;
+            // Fresh TCBs hold zero, never match them
+            if(!furi_thread_telemetry_generation) {
+                furi_thread_telemetry_generation = 1;
+            }
+
+            telemetry->run_time = portGET_RUN_TIME_COUNTER_VALUE();
+            furi_thread_telemetry = telemetry;
+        }
+        (void)xTaskResumeAll();
+
+        furi_thread_flags_set(
+            furi_thread_get_id(furi_thread_telemetry_worker_thread),
+            FURI_THREAD_TELEMETRY_FLAG_WAKE);
+        result = true;
+    }
+
+    furi_mutex_release(furi_thread_telemetry_mutex);
+
+    return result;
+}
+
+void furi_thread_telemetry_stop(void) {
+    furi_check(furi_mutex_acquire(furi_thread_telemetry_mutex, FuriWaitForever) == FuriStatusOk);
+
+    FuriThreadTelemetry* telemetry;
+    vTaskSuspendAll();
+    {
+        telemetry = furi_thread_telemetry;
+        furi_thread_telemetry = NULL;
+    }
+    (void)xTaskResumeAll();
+
+    if(telemetry) {
+        furi_thread_flags_set(
+            furi_thread_get_id(furi_thread_telemetry_worker_thread),
+            FURI_THREAD_TELEMETRY_FLAG_WAKE);
+        free(telemetry);
+    }
+
+    furi_mutex_release(furi_thread_telemetry_mutex);
+}
+
+bool furi_thread_telemetry_get_info(FuriThreadTelemetryInfo* info) {
+    furi_check(info);
+
+    bool result = false;
+    vTaskSuspendAll();
+    {
+        if(furi_thread_telemetry) {
+            *info = furi_thread_telemetry->info;
+            result = true;
+        }
+    }
+    (void)xTaskResumeAll();
+
+    return result;
+}
+
+bool furi_thread_telemetry_get_thread(size_t slot, FuriThreadTelemetryThread* thread) {
+    furi_check(slot < FURI_THREAD_TELEMETRY_THREADS);
+    furi_check(thread);
+
+    bool result = false;
+    vTaskSuspendAll();
+    do {
+        if(!furi_thread_telemetry) break;
+
+        const FuriThreadTelemetrySlot* item = &furi_thread_telemetry->slots[slot];
+        if(!item->task) break;
+
+        const uint32_t samples = furi_thread_telemetry->info.samples;
+        thread->thread_id = (FuriThreadId)item->task;
+        memcpy(thread->name, item->name, FURI_THREAD_TELEMETRY_NAME_SIZE);
+        thread->count = MIN(samples - item->first, (uint32_t)FURI_THREAD_TELEMETRY_HISTORY);
+        thread->first = samples - thread->count;
+
+        for(size_t i = 0; i < thread->count; i++) {
+            thread->history[i] =
+                item->history[(thread->first + i) % FURI_THREAD_TELEMETRY_HISTORY];
+        }
+
+        result = true;
+    } while(false);
+    (void)xTaskResumeAll();
+
+    return result;
+}
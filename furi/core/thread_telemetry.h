@@ -0,0 +1,99 @@
+/**
+ * @file thread_telemetry.h
+ * Furi: per-thread scheduling telemetry
+ *
+ * Scheduler trace hooks count context switches and measure how long threads
+ * stay ready before they run. A worker thread samples them together with
+ * run-time stats into fixed-size per-thread history.
+ */
+#pragma once
+
+#include "base.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of threads tracked at the same time */
+#define FURI_THREAD_TELEMETRY_THREADS 40
+
+/** Number of samples kept per thread */
+#define FURI_THREAD_TELEMETRY_HISTORY 16
+
+/** Thread name size, longer names are truncated */
+#define FURI_THREAD_TELEMETRY_NAME_SIZE 24
+
+/** Default sampling period in milliseconds */
+#define FURI_THREAD_TELEMETRY_PERIOD_DEFAULT 1000
+
+/** Maximum sampling period in milliseconds, the run-time counter wraps in about a minute */
+#define FURI_THREAD_TELEMETRY_PERIOD_MAX 60000
+
+/** Telemetry sample, values saturate at UINT16_MAX */
+typedef struct {
+    uint16_t cpu; /**< CPU time in hundredths of percent, including interrupts */
+    uint16_t switches; /**< Times the thread was switched in */
+    uint16_t latency_max; /**< Longest time from ready to running in microseconds */
+    uint16_t stack_min_free; /**< Minimum of the free stack space ever reached, in bytes */
+} FuriThreadTelemetrySample;
+
+/** Telemetry state */
+typedef struct {
+    uint32_t period; /**< Sampling period in milliseconds */
+    uint32_t samples; /**< Samples taken since start, number of the next sample */
+    uint32_t untracked; /**< Threads seen while all slots were taken */
+} FuriThreadTelemetryInfo;
+
+/** Thread telemetry */
+typedef struct {
+    FuriThreadId thread_id;
+    char name[FURI_THREAD_TELEMETRY_NAME_SIZE];
+    uint32_t first; /**< Number of the oldest sample in history */
+    size_t count; /**< Samples in history */
+    FuriThreadTelemetrySample history[FURI_THREAD_TELEMETRY_HISTORY]; /**< Oldest first */
+} FuriThreadTelemetryThread;
+
+/** Initialize thread telemetry, called by furi_init
+ */
+void furi_thread_telemetry_init(void);
+
+/** Start sampling thread telemetry
+ *
+ * Restarts with cleared history if it is running already. Storage (about
+ * 7 KiB) is taken from the heap, the worker thread is created on first start.
+ *
+ * @param      period  sampling period in milliseconds, up to FURI_THREAD_TELEMETRY_PERIOD_MAX
+ *
+ * @return     true on success, false if there is not enough memory
+ */
+bool furi_thread_telemetry_start(uint32_t period);
+
+/** Stop sampling thread telemetry and drop collected history
+ */
+void furi_thread_telemetry_stop(void);
+
+/** Get thread telemetry state
+ *
+ * @param      info  pointer to the state to fill
+ *
+ * @return     true if telemetry is running
+ */
+bool furi_thread_telemetry_get_info(FuriThreadTelemetryInfo* info);
+
+/** Get telemetry of a tracked thread
+ *
+ * Threads keep their slot from the first time they are scheduled after start
+ * until they exit. Sample numbers are shared by all threads, so that a client
+ * polling faster than history wraps can pick up new samples only.
+ *
+ * @param      slot    slot index, less than FURI_THREAD_TELEMETRY_THREADS
+ * @param      thread  pointer to the thread telemetry to fill
+ *
+ * @return     true if the slot holds a thread
+ */
+bool furi_thread_telemetry_get_thread(size_t slot, FuriThreadTelemetryThread* thread);
+
+#ifdef __cplusplus
+}
+#endif
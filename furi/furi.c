@@ -9,6 +9,7 @@ void furi_init(void) {
 
     furi_log_init();
     furi_record_init();
+    furi_thread_telemetry_init();
 }
 
 void furi_run(void) {
@@ -18,6 +18,7 @@
 #include "core/semaphore.h"
 #include "core/thread.h"
 #include "core/thread_list.h"
+#include "core/thread_telemetry.h"
 #include "core/timer.h"
 #include "core/string.h"
 #include "core/stream_buffer.h"
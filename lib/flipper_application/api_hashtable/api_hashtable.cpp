@@ -1,4 +1,5 @@
 #include "api_hashtable.h"
+#include "compilesort.hpp"
 
 #include <furi.h>
 #include <algorithm>
@@ -36,6 +37,31 @@ bool elf_resolve_from_hashtable(
     return result;
 }
 
+bool elf_resolve_from_perfect_hash(
+    const ElfApiInterface* interface,
+    uint32_t hash,
+    Elf32_Addr* address) {
+    furi_check(interface);
+    furi_check(address);
+
+    const PerfectHashApiInterface* perfect_hash_interface =
+        reinterpret_cast<const PerfectHashApiInterface*>(interface);
+
+    const sym_entry* entry = &perfect_hash_interface->table[perfect_hash_slot(
+        hash,
+        perfect_hash_interface->displacements,
+        perfect_hash_interface->bucket_count,
+        perfect_hash_interface->table_size)];
+
+    if(entry->hash != hash) {
+        FURI_LOG_T(TAG, "Can't find symbol with hash %lx @ %p!", hash, perfect_hash_interface);
+        return false;
+    }
+
+    *address = entry->address;
+    return true;
+}
+
 uint32_t elf_symbolname_hash(const char* s) {
     furi_check(s);
     return elf_gnu_hash(s);
@@ -28,6 +28,30 @@ bool elf_resolve_from_hashtable(
     uint32_t hash,
     Elf32_Addr* address);
 
+/**
+ * @brief Implementation of ElfApiInterface that resolves symbols with a minimal perfect hash.
+ * Tables are generated at compile time by perfect_hash_table from compilesort.hpp
+ */
+typedef struct {
+    ElfApiInterface base;
+    const struct sym_entry* table;
+    const int16_t* displacements;
+    uint16_t table_size;
+    uint16_t bucket_count;
+} PerfectHashApiInterface;
+
+/**
+ * @brief Resolver for API entries using a minimal perfect hash, one probe per lookup
+ * @param interface pointer to PerfectHashApiInterface
+ * @param hash gnu hash of function name
+ * @param address output for function address
+ * @return true if the table contains a function
+ */
+bool elf_resolve_from_perfect_hash(
+    const ElfApiInterface* interface,
+    uint32_t hash,
+    Elf32_Addr* address);
+
 uint32_t elf_symbolname_hash(const char* s);
 
 #ifdef __cplusplus
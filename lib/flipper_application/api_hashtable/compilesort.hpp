@@ -8,6 +8,7 @@
 
 #include <iterator>
 #include <array>
+#include <cstdint>
 
 namespace cstd {
 
@@ -73,6 +74,128 @@ constexpr auto sort(Range&& range) {
     return range;
 }
 
+/**
+ * Minimal perfect hash of entries with distinct 32-bit `hash` members.
+ *
+ * Keys are split into buckets by perfect_hash_mix(hash, 0). Buckets of several keys, largest
+ * first, get the smallest seed that sends all their keys to free slots with
+ * perfect_hash_mix(hash, seed). Single key buckets take the remaining slots directly,
+ * stored as -(slot + 1). Empty buckets keep seed 0.
+ */
+constexpr uint32_t perfect_hash_mix(uint32_t hash, uint32_t seed) {
+    hash ^= seed * 0x9E3779B9u;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+constexpr uint32_t perfect_hash_slot(
+    uint32_t hash,
+    const int16_t* displacements,
+    std::size_t bucket_count,
+    std::size_t table_size) {
+    const int16_t displacement = displacements[perfect_hash_mix(hash, 0) % bucket_count];
+    return displacement < 0 ? -displacement - 1 :
+                              perfect_hash_mix(hash, displacement) % table_size;
+}
+
+template <typename T, std::size_t N>
+struct PerfectHashTable {
+    static constexpr std::size_t bucket_count = N / 2 + 1;
+
+    std::array<T, N> table;
+    std::array<int16_t, bucket_count> displacements;
+};
+
+template <typename T, std::size_t N>
+constexpr auto perfect_hash_table(const std::array<T, N>& entries) {
+    static_assert(N > 0 && N < INT16_MAX, "table size must fit displacements");
+    constexpr std::size_t B = PerfectHashTable<T, N>::bucket_count;
+
+    PerfectHashTable<T, N> result{};
+
+    // Group entry indexes by bucket
+    std::array<uint16_t, B + 1> bucket_start{};
+    std::array<uint16_t, N> bucket_entries{};
+    std::size_t max_bucket_size = 0;
+
+    for(std::size_t i = 0; i < N; i++) {
+        bucket_start[perfect_hash_mix(entries[i].hash, 0) % B + 1]++;
+    }
+    for(std::size_t b = 0; b < B; b++) {
+        if(bucket_start[b + 1] > max_bucket_size) max_bucket_size = bucket_start[b + 1];
+        bucket_start[b + 1] += bucket_start[b];
+    }
+    {
+        std::array<uint16_t, B> bucket_fill{};
+        for(std::size_t i = 0; i < N; i++) {
+            const std::size_t b = perfect_hash_mix(entries[i].hash, 0) % B;
+            bucket_entries[bucket_start[b] + bucket_fill[b]++] = i;
+        }
+    }
+
+    std::array<bool, N> taken{};
+    std::array<uint16_t, N> slots{};
+
+    for(std::size_t size = max_bucket_size; size > 1; size--) {
+        for(std::size_t b = 0; b < B; b++) {
+            if(bucket_start[b + 1] - bucket_start[b] != size) continue;
+
+            for(uint32_t seed = 1; seed < INT16_MAX; seed++) {
+                bool fits = true;
+                for(std::size_t k = 0; k < size && fits; k++) {
+                    const uint32_t hash = entries[bucket_entries[bucket_start[b] + k]].hash;
+                    slots[k] = perfect_hash_mix(hash, seed) % N;
+                    fits = !taken[slots[k]];
+                    for(std::size_t j = 0; j < k && fits; j++) {
+                        fits = slots[j] != slots[k];
+                    }
+                }
+
+                if(fits) {
+                    for(std::size_t k = 0; k < size; k++) {
+                        taken[slots[k]] = true;
+                        result.table[slots[k]] = entries[bucket_entries[bucket_start[b] + k]];
+                    }
+                    result.displacements[b] = seed;
+                    break;
+                }
+            }
+        }
+    }
+
+    std::size_t free_slot = 0;
+    for(std::size_t b = 0; b < B; b++) {
+        if(bucket_start[b + 1] - bucket_start[b] != 1) continue;
+
+        while(taken[free_slot]) free_slot++;
+        taken[free_slot] = true;
+        result.table[free_slot] = entries[bucket_entries[bucket_start[b]]];
+        result.displacements[b] = -(int16_t)(free_slot + 1);
+    }
+
+    return result;
+}
+
+/* Compile-time check that every entry is found, usage:
+ * static_assert(perfect_hash_is_complete(table, entries), "Perfect hash is incomplete");
+ */
+template <typename T, std::size_t N>
+constexpr bool
+    perfect_hash_is_complete(const PerfectHashTable<T, N>& table, const std::array<T, N>& entries) {
+    for(const auto& entry : entries) {
+        const uint32_t slot = perfect_hash_slot(
+            entry.hash, table.displacements.data(), table.bucket_count, table.table.size());
+        if(table.table[slot].hash != entry.hash) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template <typename V, typename... T>
 constexpr auto array_of(T&&... t) -> std::array<V, sizeof...(T)> {
     return {{std::forward<T>(t)...}};
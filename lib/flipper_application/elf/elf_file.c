@@ -2,6 +2,8 @@
 #include "elf_file_i.h"
 
 #include <storage/storage.h>
+#include <toolbox/crc32_calc.h>
+#include <toolbox/path.h>
 #include <elf.h>
 #include "elf_api_interface.h"
 #include "../api_hashtable/api_hashtable.h"
@@ -13,6 +15,10 @@
 #define IS_FLAGS_SET(v, m) (((v) & (m)) == (m))
 #define RESOLVER_THREAD_YIELD_STEP 30
 #define FAST_RELOCATION_VERSION 1
+#define FAST_RELOCATION_RESOLVED_VERSION 0x81
+
+#define IMAGE_CACHE_MAGIC 0x49504146
+#define IMAGE_CACHE_VERSION 3
 
 // #define ELF_DEBUG_LOG 1
 
@@ -37,6 +43,32 @@ typedef struct {
     uint32_t addr;
 } FURI_PACKED JMPTrampoline;
 
+/**
+ * Relocated image cache layout: header, debug link, then sections one after another.
+ * Each section is its header, name, data and resolved relocations that depend on load address.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint16_t api_version_major;
+    uint16_t api_version_minor;
+    uint32_t api_key;
+    uint32_t elf_crc;
+    uint32_t elf_size;
+    uint32_t elf_mtime;
+    uint32_t sections_count;
+    uint32_t debug_link_size;
+} FURI_PACKED ELFImageCacheHeader;
+
+typedef struct {
+    uint16_t sec_idx;
+    uint16_t name_size;
+    uint32_t type;
+    uint32_t alignment;
+    uint32_t size;
+    uint32_t fixups_size;
+} FURI_PACKED ELFImageCacheSection;
+
 /**************************************************************************************************/
 /********************************************* Caches *********************************************/
 /**************************************************************************************************/
@@ -80,6 +112,8 @@ static ELFSection* elf_file_get_or_put_section(ELFFile* elf, const char* name) {
                 .data = NULL,
                 .sec_idx = 0,
                 .size = 0,
+                .type = SHT_NULL,
+                .alignment = 0,
                 .rel_count = 0,
                 .rel_offset = 0,
                 .fast_rel = NULL,
@@ -468,14 +502,12 @@ typedef struct {
     ELFLoadSectionResult result;
 } SectionTypeInfo;
 
-static ELFLoadSectionResult
-    elf_load_section_data(ELFFile* elf, ELFSection* section, Elf32_Shdr* section_header) {
-    if(section_header->sh_size == 0) {
-        FURI_LOG_D(TAG, "No data for section");
-        return ELFLoadSectionResultSuccess;
-    }
-
-    size_t safe_size = section_header->sh_size + 1024;
+static ELFLoadSectionResult elf_allocate_section_data(
+    ELFSection* section,
+    Elf32_Word size,
+    Elf32_Word alignment,
+    Elf32_Word type) {
+    size_t safe_size = size + 1024;
 
     furi_kernel_lock();
 
@@ -485,11 +517,29 @@ static ELFLoadSectionResult
         return ELFLoadSectionResultNoMemory;
     }
 
-    section->data = aligned_malloc(section_header->sh_size, section_header->sh_addralign);
-    section->size = section_header->sh_size;
+    section->data = aligned_malloc(size, alignment);
+    section->size = size;
+    section->type = type;
+    section->alignment = alignment;
 
     furi_kernel_unlock();
 
+    return ELFLoadSectionResultSuccess;
+}
+
+static ELFLoadSectionResult
+    elf_load_section_data(ELFFile* elf, ELFSection* section, Elf32_Shdr* section_header) {
+    if(section_header->sh_size == 0) {
+        FURI_LOG_D(TAG, "No data for section");
+        return ELFLoadSectionResultSuccess;
+    }
+
+    ELFLoadSectionResult result = elf_allocate_section_data(
+        section, section_header->sh_size, section_header->sh_addralign, section_header->sh_type);
+    if(result != ELFLoadSectionResultSuccess) {
+        return result;
+    }
+
     if(section_header->sh_type == SHT_NOBITS) {
         // BSS section, no data to load
         return ELFLoadSectionResultSuccess;
@@ -685,9 +735,18 @@ static bool elf_file_find_string_by_hash(ELFFile* elf, uint32_t hash, FuriString
     return result;
 }
 
+static bool elf_relocate_is_absolute(int type) {
+    return type == R_ARM_TARGET1 || type == R_ARM_ABS32 || type == R_ARM_THM_MOVW_ABS_NC ||
+           type == R_ARM_THM_MOVT_ABS;
+}
+
+/**
+ * Resolve symbol hashes of fast relocation records in place. Absolute references to API
+ * symbols are applied right away, the rest are kept with resolved addresses, so that the
+ * section data and the remaining records can be stored in the image cache as they are.
+ */
 static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
-    UNUSED(elf);
-    const uint8_t* start = s->fast_rel->data;
+    uint8_t* start = s->fast_rel->data;
     const uint8_t version = *start;
     bool no_errors = true;
 
@@ -697,25 +756,29 @@ static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
     }
     start += 1;
 
-    const uint32_t records_count = *((uint32_t*)start);
+    uint32_t* records_count = (uint32_t*)start;
     start += 4;
-    FURI_LOG_D(TAG, "Fast relocation records count: %ld", records_count);
+    FURI_LOG_D(TAG, "Fast relocation records count: %ld", *records_count);
 
-    for(uint32_t i = 0; i < records_count; i++) {
+    uint8_t* kept = start;
+    uint32_t kept_count = 0;
+
+    for(uint32_t i = 0; i < *records_count; i++) {
+        uint8_t* record = start;
         bool is_section = (*start & (0x1 << 7)) ? true : false;
         uint8_t type = *start & 0x7F;
         start += 1;
         uint32_t hash_or_section_index = *((uint32_t*)start);
         start += 4;
 
-        uint32_t section_value = ELF_INVALID_ADDRESS;
         if(is_section) {
-            section_value = *((uint32_t*)start);
             start += 4;
         }
 
         const uint32_t offsets_count = *((uint32_t*)start);
         start += 4;
+        const uint8_t* offsets = start;
+        start += 3 * offsets_count;
 
         FURI_LOG_D(
             TAG,
@@ -726,53 +789,107 @@ static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
             hash_or_section_index,
             offsets_count);
 
-        Elf32_Addr address = 0;
+        // Section addresses are known once all sections are loaded, keep the record as is
+        if(!is_section) {
+            Elf32_Addr address = elf_address_of_by_hash(elf, hash_or_section_index);
+
+            if(address == ELF_INVALID_ADDRESS) {
+                FuriString* symbol_name = furi_string_alloc();
+                if(elf_file_find_string_by_hash(elf, hash_or_section_index, symbol_name)) {
+                    FURI_LOG_E(
+                        TAG,
+                        "Failed to resolve address for symbol %s (hash %lX)",
+                        furi_string_get_cstr(symbol_name),
+                        hash_or_section_index);
+                } else {
+                    FURI_LOG_E(
+                        TAG,
+                        "Failed to resolve address for hash %lX (string not found)",
+                        hash_or_section_index);
+                }
+                furi_string_free(symbol_name);
+
+                no_errors = false;
+                continue;
+            }
+
+            if(elf_relocate_is_absolute(type)) {
+                for(uint32_t j = 0; j < offsets_count; j++) {
+                    uint32_t offset = *((uint32_t*)&offsets[3 * j]) & 0x00FFFFFF;
+                    Elf32_Addr relAddr = ((Elf32_Addr)s->data) + offset;
+                    elf_relocate_symbol(elf, relAddr, type, address);
+                }
+                continue;
+            }
+
+            *((uint32_t*)(record + 1)) = address;
+        }
+
+        memmove(kept, record, start - record);
+        kept += start - record;
+        kept_count++;
+    }
+
+    *records_count = kept_count;
+    *((uint8_t*)s->fast_rel->data) = FAST_RELOCATION_RESOLVED_VERSION;
+    s->fast_rel->size = kept - (uint8_t*)s->fast_rel->data;
+
+    return no_errors;
+}
+
+/**
+ * Apply resolved relocation records, either left by elf_relocate_fast or loaded from the image
+ * cache, and release them.
+ */
+static void elf_relocate_resolved(ELFFile* elf, ELFSection* s) {
+    const uint8_t* start = s->fast_rel->data;
+    furi_check(*start == FAST_RELOCATION_RESOLVED_VERSION);
+    start += 1;
+
+    const uint32_t records_count = *((uint32_t*)start);
+    start += 4;
+
+    for(uint32_t i = 0; i < records_count; i++) {
+        bool is_section = (*start & (0x1 << 7)) ? true : false;
+        uint8_t type = *start & 0x7F;
+        start += 1;
+        uint32_t address_or_section_index = *((uint32_t*)start);
+        start += 4;
+
+        Elf32_Addr address = address_or_section_index;
         if(is_section) {
-            ELFSection* symSec = elf_section_of(elf, hash_or_section_index);
+            uint32_t section_value = *((uint32_t*)start);
+            start += 4;
+
+            address = 0;
+            ELFSection* symSec = elf_section_of(elf, address_or_section_index);
             if(symSec) {
                 address = ((Elf32_Addr)symSec->data) + section_value;
             }
-        } else {
-            address = elf_address_of_by_hash(elf, hash_or_section_index);
         }
 
-        if(address == ELF_INVALID_ADDRESS) {
-            FuriString* symbol_name = furi_string_alloc();
-            if(elf_file_find_string_by_hash(elf, hash_or_section_index, symbol_name)) {
-                FURI_LOG_E(
-                    TAG,
-                    "Failed to resolve address for symbol %s (hash %lX)",
-                    furi_string_get_cstr(symbol_name),
-                    hash_or_section_index);
-            } else {
-                FURI_LOG_E(
-                    TAG,
-                    "Failed to resolve address for hash %lX (string not found)",
-                    hash_or_section_index);
-            }
-            furi_string_free(symbol_name);
+        const uint32_t offsets_count = *((uint32_t*)start);
+        start += 4;
 
-            no_errors = false;
-            start += 3 * offsets_count;
-        } else {
-            for(uint32_t j = 0; j < offsets_count; j++) {
-                uint32_t offset = *((uint32_t*)start) & 0x00FFFFFF;
-                start += 3;
-                Elf32_Addr relAddr = ((Elf32_Addr)s->data) + offset;
-                elf_relocate_symbol(elf, relAddr, type, address);
-            }
+        for(uint32_t j = 0; j < offsets_count; j++) {
+            uint32_t offset = *((uint32_t*)start) & 0x00FFFFFF;
+            start += 3;
+            Elf32_Addr relAddr = ((Elf32_Addr)s->data) + offset;
+            elf_relocate_symbol(elf, relAddr, type, address);
         }
     }
 
     aligned_free(s->fast_rel->data);
     free(s->fast_rel);
     s->fast_rel = NULL;
-
-    return no_errors;
 }
 
 static bool elf_relocate_section(ELFFile* elf, ELFSection* section) {
     if(section->fast_rel) {
+        if(*((uint8_t*)section->fast_rel->data) == FAST_RELOCATION_RESOLVED_VERSION) {
+            FURI_LOG_D(TAG, "Section relocations are resolved already");
+            return true;
+        }
         FURI_LOG_D(TAG, "Fast relocating section");
         return elf_relocate_fast(elf, section);
     } else if(section->rel_count) {
@@ -784,6 +901,246 @@ static bool elf_relocate_section(ELFFile* elf, ELFSection* section) {
     return true;
 }
 
+static void elf_file_release_sections(ELFFile* elf) {
+    ELFSectionDict_it_t it;
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        const ELFSectionDict_itref_t* itref = ELFSectionDict_cref(it);
+        if(itref->value.data) {
+            aligned_free(itref->value.data);
+        }
+        if(itref->value.fast_rel) {
+            if(itref->value.fast_rel->data) {
+                aligned_free(itref->value.fast_rel->data);
+            }
+            free(itref->value.fast_rel);
+        }
+        free((void*)itref->key);
+    }
+
+    ELFSectionDict_reset(elf->sections);
+
+    elf->preinit_array = NULL;
+    elf->init_array = NULL;
+    elf->fini_array = NULL;
+
+    if(elf->debug_link_info.debug_link) {
+        free(elf->debug_link_info.debug_link);
+        elf->debug_link_info.debug_link = NULL;
+        elf->debug_link_info.debug_link_size = 0;
+    }
+}
+
+/**************************************************************************************************/
+/****************************************** Image cache *******************************************/
+/**************************************************************************************************/
+
+static bool elf_image_cache_save_section(File* file, const char* name, ELFSection* section) {
+    ELFImageCacheSection header = {
+        .sec_idx = section->sec_idx,
+        .name_size = strlen(name) + 1,
+        .type = section->type,
+        .alignment = section->alignment,
+        .size = section->size,
+        .fixups_size = section->fast_rel ? section->fast_rel->size : 0,
+    };
+
+    if(storage_file_write(file, &header, sizeof(header)) != sizeof(header) ||
+       storage_file_write(file, name, header.name_size) != header.name_size) {
+        return false;
+    }
+
+    if(header.type != SHT_NOBITS &&
+       storage_file_write(file, section->data, header.size) != header.size) {
+        return false;
+    }
+
+    if(header.fixups_size &&
+       storage_file_write(file, section->fast_rel->data, header.fixups_size) !=
+           header.fixups_size) {
+        return false;
+    }
+
+    return true;
+}
+
+/* Called between resolving and applying relocations, with absolute API references applied only */
+static void elf_image_cache_save(ELFFile* elf) {
+    const char* path = furi_string_get_cstr(elf->image_cache_path);
+    File* file = storage_file_alloc(elf->storage);
+    bool success = false;
+
+    ELFImageCacheHeader header = {
+        .magic = 0, // written last, an interrupted save leaves an invalid cache
+        .version = IMAGE_CACHE_VERSION,
+        .api_version_major = elf->api_interface->api_version_major,
+        .api_version_minor = elf->api_interface->api_version_minor,
+        .api_key = elf->image_cache_api_key,
+        .elf_crc = elf->image_crc,
+        .elf_size = storage_file_size(elf->fd),
+        .elf_mtime = elf->image_mtime,
+        .sections_count = 0,
+        .debug_link_size = elf->debug_link_info.debug_link_size,
+    };
+
+    ELFSectionDict_it_t it;
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        if(ELFSectionDict_cref(it)->value.data) {
+            header.sections_count++;
+        }
+    }
+
+    do {
+        FuriString* dir_path = furi_string_alloc();
+        path_extract_dirname(path, dir_path);
+        storage_simply_mkdir(elf->storage, furi_string_get_cstr(dir_path));
+        furi_string_free(dir_path);
+
+        if(!storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS) ||
+           storage_file_write(file, &header, sizeof(header)) != sizeof(header) ||
+           (header.debug_link_size &&
+            storage_file_write(file, elf->debug_link_info.debug_link, header.debug_link_size) !=
+                header.debug_link_size)) {
+            break;
+        }
+
+        bool sections_saved = true;
+        for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it);
+            ELFSectionDict_next(it)) {
+            ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
+            if(itref->value.data &&
+               !elf_image_cache_save_section(file, itref->key, &itref->value)) {
+                sections_saved = false;
+                break;
+            }
+        }
+
+        if(!sections_saved) break;
+
+        header.magic = IMAGE_CACHE_MAGIC;
+        if(!storage_file_seek(file, 0, true) ||
+           storage_file_write(file, &header, sizeof(header)) != sizeof(header)) {
+            break;
+        }
+
+        success = true;
+    } while(false);
+
+    storage_file_close(file);
+    storage_file_free(file);
+
+    if(success) {
+        FURI_LOG_I(TAG, "Saved image cache %s", path);
+    } else {
+        FURI_LOG_W(TAG, "Failed to save image cache %s", path);
+        storage_simply_remove(elf->storage, path);
+    }
+}
+
+static ELFLoadSectionResult elf_image_cache_load_section(ELFFile* elf, File* file) {
+    ELFImageCacheSection header;
+    if(storage_file_read(file, &header, sizeof(header)) != sizeof(header) ||
+       header.name_size == 0 || header.size == 0) {
+        return ELFLoadSectionResultError;
+    }
+
+    char* name = malloc(header.name_size);
+    bool name_read = storage_file_read(file, name, header.name_size) == header.name_size;
+    name[header.name_size - 1] = '\0';
+    ELFSection* section_p = name_read ? elf_file_get_or_put_section(elf, name) : NULL;
+    free(name);
+
+    if(!section_p || section_p->data) {
+        return ELFLoadSectionResultError;
+    }
+
+    section_p->sec_idx = header.sec_idx;
+
+    if(header.type == SHT_PREINIT_ARRAY) {
+        elf->preinit_array = section_p;
+    } else if(header.type == SHT_INIT_ARRAY) {
+        elf->init_array = section_p;
+    } else if(header.type == SHT_FINI_ARRAY) {
+        elf->fini_array = section_p;
+    }
+
+    ELFLoadSectionResult result =
+        elf_allocate_section_data(section_p, header.size, header.alignment, header.type);
+    if(result != ELFLoadSectionResultSuccess) {
+        return result;
+    }
+
+    if(header.type != SHT_NOBITS &&
+       storage_file_read(file, section_p->data, header.size) != header.size) {
+        return ELFLoadSectionResultError;
+    }
+
+    if(header.fixups_size) {
+        section_p->fast_rel = malloc(sizeof(ELFSection));
+        result = elf_allocate_section_data(
+            section_p->fast_rel, header.fixups_size, sizeof(uint32_t), SHT_PROGBITS);
+        if(result != ELFLoadSectionResultSuccess) {
+            return result;
+        }
+
+        if(storage_file_read(file, section_p->fast_rel->data, header.fixups_size) !=
+               header.fixups_size ||
+           *((uint8_t*)section_p->fast_rel->data) != FAST_RELOCATION_RESOLVED_VERSION) {
+            return ELFLoadSectionResultError;
+        }
+    }
+
+    return ELFLoadSectionResultSuccess;
+}
+
+/* Sections, debug link and relocations come from a single sequential read */
+static ELFLoadSectionResult elf_image_cache_load(ELFFile* elf) {
+    const char* path = furi_string_get_cstr(elf->image_cache_path);
+    File* file = storage_file_alloc(elf->storage);
+    ELFLoadSectionResult result = ELFLoadSectionResultError;
+    ELFImageCacheHeader header;
+
+    do {
+        if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING) ||
+           storage_file_read(file, &header, sizeof(header)) != sizeof(header)) {
+            break;
+        }
+
+        if(header.magic != IMAGE_CACHE_MAGIC || header.version != IMAGE_CACHE_VERSION ||
+           header.api_version_major != elf->api_interface->api_version_major ||
+           header.api_version_minor != elf->api_interface->api_version_minor ||
+           header.api_key != elf->image_cache_api_key || header.elf_crc != elf->image_crc ||
+           header.elf_size != storage_file_size(elf->fd) ||
+           header.elf_mtime != elf->image_mtime) {
+            FURI_LOG_D(TAG, "Image cache is outdated");
+            break;
+        }
+
+        if(header.debug_link_size) {
+            elf->debug_link_info.debug_link_size = header.debug_link_size;
+            elf->debug_link_info.debug_link = malloc(header.debug_link_size);
+            if(storage_file_read(file, elf->debug_link_info.debug_link, header.debug_link_size) !=
+               header.debug_link_size) {
+                break;
+            }
+        }
+
+        result = ELFLoadSectionResultSuccess;
+        for(uint32_t i = 0; i < header.sections_count; i++) {
+            result = elf_image_cache_load_section(elf, file);
+            if(result != ELFLoadSectionResultSuccess) break;
+        }
+    } while(false);
+
+    storage_file_free(file);
+
+    // Cache path belongs to this file, an outdated or broken cache is never going to match
+    if(result == ELFLoadSectionResultError && storage_common_exists(elf->storage, path)) {
+        storage_simply_remove(elf->storage, path);
+    }
+
+    return result;
+}
+
 static void elf_file_call_section_list(ELFSection* section, bool reverse_order) {
     if(section && section->size) {
         const uint32_t* start = section->data;
@@ -809,6 +1166,7 @@ static void elf_file_call_section_list(ELFSection* section, bool reverse_order)
 
 ELFFile* elf_file_alloc(Storage* storage, const ElfApiInterface* api_interface) {
     ELFFile* elf = malloc(sizeof(ELFFile));
+    elf->storage = storage;
     elf->fd = storage_file_alloc(storage);
     elf->api_interface = api_interface;
     ELFSectionDict_init(elf->sections);
@@ -824,24 +1182,9 @@ void elf_file_free(ELFFile* elf) {
         elf_file_call_section_list(elf->fini_array, true);
     }
 
-    // free sections data
-    {
-        ELFSectionDict_it_t it;
-        for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it);
-            ELFSectionDict_next(it)) {
-            const ELFSectionDict_itref_t* itref = ELFSectionDict_cref(it);
-            if(itref->value.data) {
-                aligned_free(itref->value.data);
-            }
-            if(itref->value.fast_rel) {
-                aligned_free(itref->value.fast_rel->data);
-                free(itref->value.fast_rel);
-            }
-            free((void*)itref->key);
-        }
-
-        ELFSectionDict_clear(elf->sections);
-    }
+    // free sections data and debug link
+    elf_file_release_sections(elf);
+    ELFSectionDict_clear(elf->sections);
 
     // free trampoline data
     {
@@ -855,8 +1198,8 @@ void elf_file_free(ELFFile* elf) {
         AddressCache_clear(elf->trampoline_cache);
     }
 
-    if(elf->debug_link_info.debug_link) {
-        free(elf->debug_link_info.debug_link);
+    if(elf->image_cache_path) {
+        furi_string_free(elf->image_cache_path);
     }
 
     elf_file_maybe_release_fd(elf);
@@ -879,10 +1222,65 @@ bool elf_file_open(ELFFile* elf, const char* path) {
     elf->sections_count = h.e_shnum;
     elf->section_table = h.e_shoff;
     elf->section_table_strings = sH.sh_offset;
+
+    // Served from the directory listing, unlike reading the whole file
+    FileInfo fileinfo;
+    elf->image_mtime =
+        storage_common_stat(elf->storage, path, &fileinfo) == FSE_OK ? fileinfo.mtime : 0;
     return true;
 }
 
+void elf_file_set_image_cache(ELFFile* elf, const char* path, uint32_t api_key) {
+    furi_check(elf->fd != NULL);
+    furi_check(path);
+
+    // Rebuilt file with the same layout is told apart by its modification time only
+    if(!elf->image_mtime) {
+        FURI_LOG_D(TAG, "No modification time, image cache disabled");
+        return;
+    }
+
+    // ELF header and section header table cover layout changes without reading the contents
+    Elf32_Ehdr h;
+    const size_t table_size = elf->sections_count * sizeof(Elf32_Shdr);
+    uint8_t* table = malloc(table_size);
+
+    if(storage_file_seek(elf->fd, 0, true) &&
+       storage_file_read(elf->fd, &h, sizeof(h)) == sizeof(h) &&
+       storage_file_seek(elf->fd, elf->section_table, true) &&
+       storage_file_read(elf->fd, table, table_size) == table_size) {
+        elf->image_crc = crc32_calc_buffer(0, &h, sizeof(h));
+        elf->image_crc = crc32_calc_buffer(elf->image_crc, table, table_size);
+        elf->image_cache_api_key = api_key;
+
+        if(elf->image_cache_path) {
+            furi_string_set(elf->image_cache_path, path);
+        } else {
+            elf->image_cache_path = furi_string_alloc_set(path);
+        }
+    }
+
+    free(table);
+}
+
 ElfLoadSectionTableResult elf_file_load_section_table(ELFFile* elf) {
+    if(elf->image_cache_path) {
+        ELFLoadSectionResult cache_result = elf_image_cache_load(elf);
+
+        if(cache_result == ELFLoadSectionResultSuccess) {
+            FURI_LOG_I(TAG, "Loaded from image cache");
+            elf->image_cache_loaded = true;
+            return ElfLoadSectionTableResultSuccess;
+        }
+
+        // Drop whatever was loaded and go the regular way
+        elf_file_release_sections(elf);
+
+        if(cache_result == ELFLoadSectionResultNoMemory) {
+            return ElfLoadSectionTableResultNoMemory;
+        }
+    }
+
     SectionType loaded_sections = 0;
     FuriString* name = furi_string_alloc();
     ElfLoadSectionTableResult result = ElfLoadSectionTableResultSuccess;
@@ -974,6 +1372,7 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
     furi_check(elf->fd != NULL);
     ELFFileLoadStatus status = ELFFileLoadStatusSuccess;
     ELFSectionDict_it_t it;
+    bool cacheable = elf->image_cache_path && !elf->image_cache_loaded;
 
     AddressCache_init(elf->relocation_cache);
 
@@ -984,6 +1383,25 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
             FURI_LOG_E(TAG, "Error relocating section '%s'", itref->key);
             status = ELFFileLoadStatusMissingImports;
         }
+
+        // Legacy relocations are applied completely, there is nothing to cache
+        if(itref->value.rel_count && !itref->value.fast_rel) {
+            cacheable = false;
+        }
+    }
+
+    if(status == ELFFileLoadStatusSuccess) {
+        if(cacheable) {
+            elf_image_cache_save(elf);
+        }
+
+        for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it);
+            ELFSectionDict_next(it)) {
+            ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
+            if(itref->value.fast_rel) {
+                elf_relocate_resolved(elf, &itref->value);
+            }
+        }
     }
 
     /* Fixing up entry point */
@@ -72,6 +72,18 @@ void elf_file_free(ELFFile* elf_file);
  */
 bool elf_file_open(ELFFile* elf_file, const char* path);
 
+/**
+ * @brief Enable relocated image cache for ELF file
+ * Must be called after elf_file_open and before elf_file_load_section_table.
+ * The cache is used when it matches the ELF file layout, size, modification time, API version
+ * and key, otherwise it is written after a successful elf_file_load_sections.
+ * Files without a modification time are never cached.
+ * @param elf_file 
+ * @param path cache file path
+ * @param api_key value that changes whenever the API interface resolves to other addresses
+ */
+void elf_file_set_image_cache(ELFFile* elf_file, const char* path, uint32_t api_key);
+
 /**
  * @brief Load ELF file section table (load stage #1)
  * @param elf_file 
@@ -18,6 +18,8 @@ typedef struct ELFSection ELFSection;
 struct ELFSection {
     void* data;
     Elf32_Word size;
+    Elf32_Word type;
+    Elf32_Word alignment;
 
     size_t rel_count;
     Elf32_Off rel_offset;
@@ -42,6 +44,7 @@ struct ELFFile {
     AddressCache_t relocation_cache;
     AddressCache_t trampoline_cache;
 
+    Storage* storage;
     File* fd;
     const ElfApiInterface* api_interface;
     ELFDebugLinkInfo debug_link_info;
@@ -51,6 +54,12 @@ struct ELFFile {
     ELFSection* fini_array;
 
     bool init_array_called;
+
+    FuriString* image_cache_path;
+    uint32_t image_cache_api_key;
+    uint32_t image_crc;
+    uint32_t image_mtime;
+    bool image_cache_loaded;
 };
 
 #ifdef __cplusplus
@@ -3,11 +3,15 @@
 #include <notification/notification_messages.h>
 #include "application_assets.h"
 #include <loader/firmware_api/firmware_api.h>
+#include <storage/storage.h>
+#include <toolbox/crc32_calc.h>
 
 #include <m-list.h>
 
 #define TAG "Fap"
 
+#define FLIPPER_APPLICATION_IMAGE_CACHE_PATH EXT_PATH(".apps_cache")
+
 struct FlipperApplication {
     ELFDebugInfo state;
     FlipperApplicationManifest manifest;
@@ -152,6 +156,20 @@ static bool flipper_application_process_assets_section(
     return flipper_application_assets_load(file, preload_context->path, offset, size);
 }
 
+// Only firmware API addresses are known to stay the same between loads
+static void flipper_application_set_image_cache(FlipperApplication* app, const char* path) {
+    if(elf_file_get_api_interface(app->elf) != firmware_api_interface) {
+        return;
+    }
+
+    FuriString* cache_path = furi_string_alloc_printf(
+        FLIPPER_APPLICATION_IMAGE_CACHE_PATH "/%08lX.img",
+        crc32_calc_buffer(0, path, strlen(path)));
+    elf_file_set_image_cache(
+        app->elf, furi_string_get_cstr(cache_path), firmware_api_get_table_crc());
+    furi_string_free(cache_path);
+}
+
 static FlipperApplicationPreloadStatus
     flipper_application_load(FlipperApplication* app, const char* path, bool load_full) {
     if(!elf_file_open(app->elf, path)) {
@@ -160,6 +178,8 @@ static FlipperApplicationPreloadStatus
 
     // if we are loading full file
     if(load_full) {
+        flipper_application_set_image_cache(app, path);
+
         // load section table
         ElfLoadSectionTableResult load_result = elf_file_load_section_table(app->elf);
         if(load_result == ElfLoadSectionTableResultError) {
@@ -2,21 +2,25 @@
 
 #include <furi.h>
 #include <m-list.h>
+#include <m-dict.h>
 #include <m-algo.h>
 
 LIST_DEF(ElfApiInterfaceList, const ElfApiInterface*, M_POD_OPLIST) // NOLINT
 #define M_OPL_ElfApiInterfaceList_t() LIST_OPLIST(ElfApiInterfaceList, M_POD_OPLIST)
 
+DICT_DEF2(ElfApiSymbolCache, uint32_t, M_DEFAULT_OPLIST, Elf32_Addr, M_DEFAULT_OPLIST) // NOLINT
+
 struct CompositeApiResolver {
     ElfApiInterface api_interface;
     ElfApiInterfaceList_t interfaces;
+    ElfApiSymbolCache_t cache; /**< Resolved symbols, misses are not cached */
+    FuriMutex* mutex;
 };
 
-static bool composite_api_resolver_callback(
-    const ElfApiInterface* interface,
+static bool composite_api_resolver_lookup(
+    CompositeApiResolver* resolver,
     uint32_t hash,
     Elf32_Addr* address) {
-    CompositeApiResolver* resolver = (CompositeApiResolver*)interface;
     for
         M_EACH(interface, resolver->interfaces, ElfApiInterfaceList_t) {
             if((*interface)->resolver_callback(*interface, hash, address)) {
@@ -26,6 +30,30 @@ static bool composite_api_resolver_callback(
     return false;
 }
 
+static bool composite_api_resolver_callback(
+    const ElfApiInterface* interface,
+    uint32_t hash,
+    Elf32_Addr* address) {
+    CompositeApiResolver* resolver = (CompositeApiResolver*)interface;
+    bool result = true;
+
+    // Plugins may be loaded from several threads through the same resolver
+    furi_check(furi_mutex_acquire(resolver->mutex, FuriWaitForever) == FuriStatusOk);
+
+    const Elf32_Addr* cached = ElfApiSymbolCache_get(resolver->cache, hash);
+    if(cached) {
+        *address = *cached;
+    } else if(composite_api_resolver_lookup(resolver, hash, address)) {
+        ElfApiSymbolCache_set_at(resolver->cache, hash, *address);
+    } else {
+        result = false;
+    }
+
+    furi_check(furi_mutex_release(resolver->mutex) == FuriStatusOk);
+
+    return result;
+}
+
 CompositeApiResolver* composite_api_resolver_alloc(void) {
     CompositeApiResolver* resolver = malloc(sizeof(CompositeApiResolver));
 
@@ -33,6 +61,8 @@ CompositeApiResolver* composite_api_resolver_alloc(void) {
     resolver->api_interface.api_version_minor = 0;
     resolver->api_interface.resolver_callback = &composite_api_resolver_callback;
     ElfApiInterfaceList_init(resolver->interfaces);
+    ElfApiSymbolCache_init(resolver->cache);
+    resolver->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
 
     return resolver;
 }
@@ -41,6 +71,8 @@ void composite_api_resolver_free(CompositeApiResolver* resolver) {
     furi_check(resolver);
 
     ElfApiInterfaceList_clear(resolver->interfaces);
+    ElfApiSymbolCache_clear(resolver->cache);
+    furi_mutex_free(resolver->mutex);
     free(resolver);
 }
 
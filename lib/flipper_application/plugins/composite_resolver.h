@@ -11,6 +11,8 @@ extern "C" {
  * Resolves API interface by calling all resolvers in order
  * Uses API version from first resolver
  * Note: when using hashtable resolvers, collisions between tables are not detected
+ * Resolved addresses are cached, so everything loaded through one resolver,
+ * like plugins of a PluginManager, looks each symbol up in the chain only once
  * Can be cast to ElfApiInterface*
  */
 typedef struct CompositeApiResolver CompositeApiResolver;
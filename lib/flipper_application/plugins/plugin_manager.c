@@ -14,6 +14,8 @@
 ARRAY_DEF(FlipperApplicationList, FlipperApplication*, M_PTR_OPLIST) // NOLINT
 #define M_OPL_FlipperApplicationList_t() ARRAY_OPLIST(FlipperApplicationList, M_PTR_OPLIST)
 
+ARRAY_DEF(PluginManagerPathList, FuriString*, FURI_STRING_OPLIST) // NOLINT
+
 struct PluginManager {
     const char* application_id;
     uint32_t api_version;
@@ -110,34 +112,40 @@ PluginManagerError plugin_manager_load_all(PluginManager* manager, const char* p
     File* directory = storage_file_alloc(manager->storage);
     char file_name_buffer[256];
     FuriString* file_name = furi_string_alloc();
-    do {
-        if(!storage_dir_open(directory, path)) {
-            FURI_LOG_E(TAG, "Failed to open directory %s", path);
-            break;
-        }
-        while(true) {
-            if(!storage_dir_read(directory, NULL, file_name_buffer, sizeof(file_name_buffer))) {
-                break;
-            }
+    PluginManagerPathList_t plugin_paths;
+    PluginManagerPathList_init(plugin_paths);
 
+    // Collect plugins in one directory pass, so that reading the directory and loading
+    // plugins do not seek back and forth on the card
+    if(storage_dir_open(directory, path)) {
+        while(storage_dir_read(directory, NULL, file_name_buffer, sizeof(file_name_buffer))) {
             furi_string_set(file_name, file_name_buffer);
             if(!furi_string_end_with_str(file_name, ".fal")) {
                 continue;
             }
 
             path_concat(path, file_name_buffer, file_name);
-            FURI_LOG_D(TAG, "Loading %s", furi_string_get_cstr(file_name));
-            PluginManagerError error =
-                plugin_manager_load_single(manager, furi_string_get_cstr(file_name));
-
-            if(error != PluginManagerErrorNone) {
-                FURI_LOG_E(TAG, "Failed to load %s", furi_string_get_cstr(file_name));
-                break;
-            }
+            PluginManagerPathList_push_back(plugin_paths, file_name);
         }
-    } while(false);
+    } else {
+        FURI_LOG_E(TAG, "Failed to open directory %s", path);
+    }
     storage_dir_close(directory);
     storage_file_free(directory);
+
+    for(size_t i = 0; i < PluginManagerPathList_size(plugin_paths); i++) {
+        const char* plugin_path =
+            furi_string_get_cstr(*PluginManagerPathList_get(plugin_paths, i));
+        FURI_LOG_D(TAG, "Loading %s", plugin_path);
+        PluginManagerError error = plugin_manager_load_single(manager, plugin_path);
+
+        if(error != PluginManagerErrorNone) {
+            FURI_LOG_E(TAG, "Failed to load %s", plugin_path);
+            break;
+        }
+    }
+
+    PluginManagerPathList_clear(plugin_paths);
     furi_string_free(file_name);
     return PluginManagerErrorNone;
 }
@@ -50,6 +50,17 @@ char* cs_read_file(const char* path, size_t* size) {
     return data;
 }
 
+int cs_write_file(const char* path, const char* data, size_t size) WEAK;
+int cs_write_file(const char* path, const char* data, size_t size) {
+    FILE* fp;
+    int ret = -1;
+    if((fp = fopen(path, "wb")) != NULL) {
+        if(fwrite(data, 1, size, fp) == size) ret = 0;
+        if(fclose(fp) != 0) ret = -1;
+    }
+    return ret;
+}
+
 char* cs_mmap_file(const char* path, size_t* size) WEAK;
 char* cs_mmap_file(const char* path, size_t* size) {
     char* r;
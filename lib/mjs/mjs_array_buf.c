@@ -30,6 +30,10 @@ int mjs_is_typed_array(mjs_val_t v) {
 }
 
 char* mjs_array_buf_get_ptr(struct mjs* mjs, mjs_val_t buf, size_t* bytelen) {
+    if(!mjs_is_array_buf(buf)) {
+        return NULL;
+    }
+
     struct mbuf* m = &mjs->array_buffers;
     size_t offset = buf & ~MJS_TAG_MASK;
     char* ptr = m->buf + offset;
@@ -46,6 +50,24 @@ char* mjs_array_buf_get_ptr(struct mjs* mjs, mjs_val_t buf, size_t* bytelen) {
     return NULL;
 }
 
+char* mjs_array_buf_pin(struct mjs* mjs, mjs_val_t buf, size_t* bytelen) {
+    if(mjs_is_data_view(buf)) {
+        buf = mjs_dataview_get_buf(mjs, buf);
+    }
+
+    char* ptr = mjs_array_buf_get_ptr(mjs, buf, bytelen);
+    if(ptr != NULL) {
+        mjs->array_buf_pins++;
+    }
+    return ptr;
+}
+
+void mjs_array_buf_unpin(struct mjs* mjs, mjs_val_t buf) {
+    (void)buf;
+    assert(mjs->array_buf_pins > 0);
+    mjs->array_buf_pins--;
+}
+
 static size_t mjs_dataview_get_element_len(mjs_dataview_type_t type) {
     size_t len = 1;
     switch(type) {
@@ -189,10 +211,17 @@ mjs_val_t mjs_dataview_get_len(struct mjs* mjs, mjs_val_t obj) {
 
 mjs_val_t mjs_mk_array_buf(struct mjs* mjs, char* data, size_t buf_len) {
     struct mbuf* m = &mjs->array_buffers;
+    size_t header_len = cs_varint_llen(buf_len);
+
+    if((m->len + header_len + buf_len) > m->size) {
+        if(mjs->array_buf_pins > 0) {
+            /* Growing would move the backing stores native code points to */
+            mjs_set_errorf(mjs, MJS_INTERNAL_ERROR, "ArrayBuffer storage is pinned");
+            return MJS_UNDEFINED;
+        }
 
-    if((m->len + buf_len) > m->size) {
         char* prev_buf = m->buf;
-        mbuf_resize(m, m->len + buf_len + MJS_ARRAY_BUF_RESERVE);
+        mbuf_resize(m, m->len + header_len + buf_len + MJS_ARRAY_BUF_RESERVE);
 
         if(data >= prev_buf && data < (prev_buf + m->len)) {
             data += m->buf - prev_buf;
@@ -202,7 +231,6 @@ mjs_val_t mjs_mk_array_buf(struct mjs* mjs, char* data, size_t buf_len) {
     size_t offset = m->len;
     char* prev_buf = m->buf;
 
-    size_t header_len = cs_varint_llen(buf_len);
     mbuf_insert(m, offset, NULL, header_len + buf_len);
     if(data >= prev_buf && data < (prev_buf + m->len)) {
         data += m->buf - prev_buf;
@@ -307,10 +335,13 @@ static mjs_val_t
 
     size_t element_len = mjs_dataview_get_element_len(type);
     mjs_val_t buf_obj = mjs_mk_array_buf(mjs, NULL, element_len * elements_nb);
+    if(!mjs_is_array_buf(buf_obj)) {
+        return MJS_UNDEFINED;
+    }
 
     if(mjs_is_array(arr)) {
         char* buf_ptr = mjs_array_buf_get_ptr(mjs, buf_obj, NULL);
-        for(uint8_t i = 0; i < elements_nb; i++) {
+        for(size_t i = 0; i < elements_nb; i++) {
             int64_t value = mjs_get_double(mjs, mjs_array_get(mjs, arr, i));
             set_value(buf_ptr, value, type);
             buf_ptr += element_len;
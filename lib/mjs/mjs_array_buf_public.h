@@ -32,6 +32,23 @@ char* mjs_array_buf_get_ptr(struct mjs* mjs, mjs_val_t buf, size_t* bytelen);
 
 mjs_val_t mjs_dataview_get_buf(struct mjs* mjs, mjs_val_t obj);
 
+/*
+ * Returns a pointer to the backing store of an ArrayBuffer or a typed array
+ * and pins it, so that native code can read into it or write from it
+ * directly. All backing stores stay in place until every pin is released
+ * with `mjs_array_buf_unpin()`; creating an ArrayBuffer that does not fit
+ * into the reserved space fails in the meantime.
+ *
+ * Returns NULL and takes no pin if `buf` is not an ArrayBuffer or a typed
+ * array.
+ */
+char* mjs_array_buf_pin(struct mjs* mjs, mjs_val_t buf, size_t* bytelen);
+
+/*
+ * Releases a pin taken with `mjs_array_buf_pin()`.
+ */
+void mjs_array_buf_unpin(struct mjs* mjs, mjs_val_t buf);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -98,6 +98,12 @@ MJS_PRIVATE int mjs_bcode_parts_cnt(struct mjs* mjs);
  */
 MJS_PRIVATE void mjs_bcode_commit(struct mjs* mjs);
 
+/*
+ * Adds a complete bcode unit, as generated by mjs_parse(), as a next bcode
+ * part; takes the ownership of malloc-ed `data`
+ */
+MJS_PRIVATE void mjs_bcode_commit_data(struct mjs* mjs, const char* data, size_t len);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -49,6 +49,9 @@ void mjs_destroy(struct mjs* mjs) {
         }
     }
 
+    /* Interned strings are foreign ones, free them before foreign_strings */
+    mjs_intern_free(mjs);
+
     mbuf_free(&mjs->bcode_gen);
     mbuf_free(&mjs->bcode_parts);
     mbuf_free(&mjs->stack);
@@ -113,6 +116,7 @@ struct mjs* mjs_create(void* context) {
         sizeof(struct mjs_ffi_sig),
         MJS_FUNC_FFI_ARENA_SIZE,
         MJS_FUNC_FFI_ARENA_INC_SIZE);
+    mjs->object_arena.destructor = mjs_object_destructor;
     mjs->ffi_sig_arena.destructor = mjs_ffi_sig_destructor;
 
     global_object = mjs_mk_object(mjs);
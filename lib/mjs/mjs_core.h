@@ -60,6 +60,16 @@ struct mjs_bcode_part {
     unsigned in_rom : 1;
 };
 
+/*
+ * Open-addressed set of interned strings: foreign string values pointing to
+ * NUL-terminated copies owned by the set. Empty slots are 0.
+ */
+struct mjs_intern_table {
+    mjs_val_t* slots;
+    size_t size; /* Number of slots, a power of two */
+    size_t count;
+};
+
 struct mjs {
     struct mbuf bcode_gen;
     struct mbuf bcode_parts;
@@ -73,7 +83,9 @@ struct mjs {
     struct mbuf foreign_strings; /* Sequence of (varint len, char *data) */
     struct mbuf owned_values;
     struct mbuf json_visited_stack;
-    struct mbuf array_buffers;
+    struct mbuf array_buffers; /* Sequence of (varint len, char data[]) */
+    size_t array_buf_pins; /* Native code holds pointers into array_buffers */
+    struct mjs_intern_table interned; /* Property name literals */
     struct mjs_vals vals;
     char* error_msg;
     char* stack_trace;
@@ -109,6 +121,12 @@ enum mjs_header_items {
     MJS_HDR_ITEMS_CNT
 };
 
+/*
+ * Version of the bcode format stored in .jsc files. Must be bumped on any
+ * change of the opcodes, their encoding or the bcode header.
+ */
+#define MJS_JSC_VERSION 1
+
 MJS_PRIVATE size_t mjs_get_func_addr(mjs_val_t v);
 
 MJS_PRIVATE int mjs_getretvalpos(struct mjs* mjs);
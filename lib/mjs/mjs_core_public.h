@@ -257,8 +257,8 @@ const char* mjs_get_stack_trace(struct mjs* mjs);
  * Sets whether *.jsc files are generated when *.js file is executed. By
  * default it's 0.
  *
- * If either `MJS_GENERATE_JSC` or `CS_MMAP` is off, then this function has no
- * effect.
+ * If either `MJS_GENERATE_JSC` or `CS_MMAP` is off, then .jsc files are only
+ * used as a bytecode cache when `MJS_CACHE_JSC` is on: see mjs_features.h.
  */
 void mjs_set_generate_jsc(struct mjs* mjs, int generate_jsc);
 
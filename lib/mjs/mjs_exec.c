@@ -784,7 +784,7 @@ MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
             break;
         case OP_PUSH_STR: {
             int llen, n = cs_varint_decode_unsafe(&code[i + 1], &llen);
-            mjs_push(mjs, mjs_mk_string(mjs, (char*)code + i + 1 + llen, n, 1));
+            mjs_push(mjs, mjs_mk_string_literal(mjs, (char*)code + i + 1 + llen, n));
             i += llen + n;
             break;
         }
@@ -1059,6 +1059,125 @@ clean:
     return mjs->error;
 }
 
+#if MJS_CACHE_JSC
+/* Appended to the bcode in .jsc files */
+struct mjs_jsc_trailer {
+    uint32_t source_hash;
+    uint32_t source_size;
+    uint32_t version;
+    uint32_t magic;
+};
+
+#define MJS_JSC_MAGIC 0x43534a4dU /* "MJSC" */
+
+/*
+ * Returns malloc-ed path of the .jsc counterpart of a .js file, or NULL if the
+ * file has another extension
+ */
+static char* mjs_jsc_path(const char* path) {
+    const char* jsext = ".js";
+    size_t path_len = strlen(path);
+    char* jsc_path;
+
+    if(path_len <= strlen(jsext) || strcmp(path + path_len - strlen(jsext), jsext) != 0) {
+        return NULL;
+    }
+
+    jsc_path = (char*)malloc(path_len + 2);
+    if(jsc_path != NULL) {
+        memcpy(jsc_path, path, path_len);
+        strcpy(jsc_path + path_len, "c");
+    }
+    return jsc_path;
+}
+
+/*
+ * Saves the last bcode part to the .jsc counterpart of `path`. The trailer is
+ * appended to the bcode buffer itself, so that the file is written at once:
+ * nothing refers to the buffer before the bcode is executed.
+ */
+static void mjs_jsc_save(struct mjs* mjs, const char* path, const char* src) {
+    struct mjs_bcode_part* bp = mjs_bcode_part_get(mjs, mjs_bcode_parts_cnt(mjs) - 1);
+    size_t src_size = strlen(src);
+    struct mjs_jsc_trailer trailer;
+    char* jsc_path;
+    char* data;
+
+    if(bp->in_rom || (jsc_path = mjs_jsc_path(path)) == NULL) return;
+
+    data = (char*)realloc((void*)bp->data.p, bp->data.len + sizeof(trailer));
+    if(data != NULL) {
+        bp->data.p = data;
+
+        trailer.source_hash = mjs_str_hash(src, src_size);
+        trailer.source_size = src_size;
+        trailer.version = MJS_JSC_VERSION;
+        trailer.magic = MJS_JSC_MAGIC;
+        memcpy(data + bp->data.len, &trailer, sizeof(trailer));
+
+        if(cs_write_file(jsc_path, data, bp->data.len + sizeof(trailer)) != 0) {
+            LOG(LL_WARN, ("Failed to write %s", jsc_path));
+        }
+    }
+
+    free(jsc_path);
+}
+
+/*
+ * Reads bcode from the .jsc counterpart of `path` if it was saved for the same
+ * source and bcode version, and adds it as a next bcode part. Returns 1 and
+ * the global offset of the part in `off` on success.
+ */
+static int mjs_jsc_load(
+    struct mjs* mjs,
+    const char* path,
+    const char* src,
+    size_t src_size,
+    size_t* off) {
+    const size_t path_off =
+        1 /* OP_BCODE_HEADER */ + sizeof(mjs_header_item_t) * MJS_HDR_ITEMS_CNT;
+    const size_t path_size = strlen(path) + 1 /* nul-term */;
+    struct mjs_jsc_trailer trailer;
+    mjs_header_item_t total_size;
+    char* jsc_path = mjs_jsc_path(path);
+    char* data = NULL;
+    size_t size = 0;
+    size_t len;
+    int valid = 0;
+
+    if(jsc_path != NULL) {
+        data = cs_read_file(jsc_path, &size);
+        free(jsc_path);
+    }
+    if(data == NULL) return 0;
+
+    if(size >= path_off + path_size + sizeof(trailer)) {
+        len = size - sizeof(trailer);
+        memcpy(&trailer, data + len, sizeof(trailer));
+        memcpy(
+            &total_size,
+            data + 1 + sizeof(mjs_header_item_t) * MJS_HDR_ITEM_TOTAL_SIZE,
+            sizeof(total_size));
+
+        /* Bcode embeds the file name for stack traces, so it has to match too */
+        valid = trailer.magic == MJS_JSC_MAGIC && trailer.version == MJS_JSC_VERSION &&
+                trailer.source_size == src_size &&
+                trailer.source_hash == mjs_str_hash(src, src_size) &&
+                (uint8_t)data[0] == OP_BCODE_HEADER && total_size + 1 == len &&
+                memcmp(data + path_off, path, path_size) == 0;
+    }
+
+    if(!valid) {
+        free(data);
+        return 0;
+    }
+
+    *off = mjs->bcode_len;
+    mjs_bcode_commit_data(mjs, data, len);
+    return 1;
+}
+#endif
+
 MJS_PRIVATE mjs_err_t mjs_exec_internal(
     struct mjs* mjs,
     const char* path,
@@ -1135,6 +1254,8 @@ MJS_PRIVATE mjs_err_t mjs_exec_internal(
                 }
             }
         }
+#elif MJS_CACHE_JSC
+        if(generate_jsc && path != NULL) mjs_jsc_save(mjs, path, src);
 #else
         (void)generate_jsc;
 #endif
@@ -1153,6 +1274,9 @@ mjs_err_t mjs_exec_file(struct mjs* mjs, const char* path, mjs_val_t* res) {
     mjs_err_t error = MJS_FILE_READ_ERROR;
     mjs_val_t r = MJS_UNDEFINED;
     size_t size;
+#if MJS_CACHE_JSC
+    size_t off;
+#endif
     char* source_code = cs_read_file(path, &size);
 
     if(source_code == NULL) {
@@ -1162,6 +1286,14 @@ mjs_err_t mjs_exec_file(struct mjs* mjs, const char* path, mjs_val_t* res) {
     }
 
     r = MJS_UNDEFINED;
+#if MJS_CACHE_JSC
+    if(mjs->generate_jsc && mjs_jsc_load(mjs, path, source_code, size, &off)) {
+        /* Bcode is up to date with the source, skip parsing */
+        free(source_code);
+        error = mjs_execute(mjs, off, &r);
+        goto clean;
+    }
+#endif
     error = mjs_exec_internal(mjs, path, source_code, -1, &r);
     free(source_code);
 
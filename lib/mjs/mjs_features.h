@@ -30,4 +30,21 @@
 #endif
 #endif
 
+/*
+ * MJS_CACHE_JSC: if enabled, and if .jsc generation is turned on with
+ * `mjs_set_generate_jsc()`, execution of a .js file saves its bcode to a .jsc
+ * file next to it, together with the source hash and the bcode version.
+ * Subsequent executions of the unchanged source read the .jsc file into RAM
+ * instead of parsing the source again.
+ *
+ * By default it's enabled when MJS_GENERATE_JSC is not
+ */
+#if !defined(MJS_CACHE_JSC)
+#if MJS_GENERATE_JSC
+#define MJS_CACHE_JSC 0
+#else
+#define MJS_CACHE_JSC 1
+#endif
+#endif
+
 #endif /* MJS_FEATURES_H_ */
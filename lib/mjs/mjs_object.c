@@ -38,6 +38,7 @@ mjs_val_t mjs_mk_object(struct mjs* mjs) {
     }
     (void)mjs;
     o->properties = NULL;
+    o->table = NULL;
     return mjs_object_to_value(o);
 }
 
@@ -50,32 +51,157 @@ int mjs_is_object_based(mjs_val_t v) {
            ((v & MJS_TAG_MASK) == MJS_TAG_ARRAY_BUF_VIEW);
 }
 
-MJS_PRIVATE struct mjs_property*
-    mjs_get_own_property(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len) {
+#ifndef MJS_PROPERTY_TABLE_MIN_PROPS
+#define MJS_PROPERTY_TABLE_MIN_PROPS 8
+#endif
+
+struct mjs_property_slot {
+    uint32_t hash; /* Hash of the property name */
+    struct mjs_property* prop; /* NULL for empty slots */
+};
+
+/* Open-addressed hash index of object properties */
+struct mjs_property_table {
+    size_t size; /* Number of slots, a power of two */
+    size_t count;
+    struct mjs_property_slot slots[];
+};
+
+static uint32_t mjs_property_hash(struct mjs* mjs, struct mjs_property* p) {
+    size_t n;
+    const char* s = mjs_get_string(mjs, &p->name, &n);
+    return mjs_str_hash(s, n);
+}
+
+static void
+    mjs_property_table_put(struct mjs_property_table* t, struct mjs_property* p, uint32_t hash) {
+    size_t i = hash & (t->size - 1);
+    while(t->slots[i].prop != NULL) {
+        i = (i + 1) & (t->size - 1);
+    }
+    t->slots[i].hash = hash;
+    t->slots[i].prop = p;
+    t->count++;
+}
+
+/*
+ * (Re)builds the hash index of object properties, or drops it if the object
+ * has too few properties
+ */
+static void mjs_property_table_build(struct mjs* mjs, struct mjs_object* o) {
+    size_t count = 0, size = MJS_PROPERTY_TABLE_MIN_PROPS * 2;
     struct mjs_property* p;
-    struct mjs_object* o;
 
-    if(!mjs_is_object_based(obj)) {
-        return NULL;
+    free(o->table);
+    o->table = NULL;
+
+    for(p = o->properties; p != NULL; p = p->next) {
+        count++;
+    }
+    if(count < MJS_PROPERTY_TABLE_MIN_PROPS) return;
+
+    /* Keep the load factor under 1/2 after rebuilding */
+    while(size < count * 2) {
+        size *= 2;
     }
 
-    o = get_object_struct(obj);
+    o->table = (struct mjs_property_table*)calloc(
+        1, sizeof(struct mjs_property_table) + size * sizeof(struct mjs_property_slot));
+    o->table->size = size;
+    for(p = o->properties; p != NULL; p = p->next) {
+        mjs_property_table_put(o->table, p, mjs_property_hash(mjs, p));
+    }
+}
 
-    if(len <= 5) {
-        mjs_val_t ss = mjs_mk_string(mjs, name, len, 1);
-        for(p = o->properties; p != NULL; p = p->next) {
-            if(p->name == ss) return p;
+/*
+ * Adds a property which was just linked to the object to its hash index
+ */
+static void
+    mjs_property_table_add(struct mjs* mjs, struct mjs_object* o, struct mjs_property* p) {
+    struct mjs_property_table* t = o->table;
+
+    if(t == NULL) {
+        /* Count up to the threshold only */
+        size_t count = 0;
+        struct mjs_property* q;
+        for(q = o->properties; q != NULL && count < MJS_PROPERTY_TABLE_MIN_PROPS; q = q->next) {
+            count++;
         }
+        if(count >= MJS_PROPERTY_TABLE_MIN_PROPS) {
+            mjs_property_table_build(mjs, o);
+        }
+    } else if((t->count + 1) * 4 > t->size * 3) {
+        mjs_property_table_build(mjs, o);
     } else {
+        mjs_property_table_put(t, p, mjs_property_hash(mjs, p));
+    }
+}
+
+MJS_PRIVATE void mjs_object_destructor(struct mjs* mjs, void* cell) {
+    struct mjs_object* o = (struct mjs_object*)cell;
+    (void)mjs;
+    free(o->table);
+}
+
+/*
+ * Finds an own property of an object by its name, given as `name`/`len` and,
+ * if known, as a string value `key`. Short strings are stored in the value
+ * itself, and an interned string always has the same value, so for these the
+ * names compare as values.
+ */
+static struct mjs_property* mjs_find_property(
+    struct mjs* mjs,
+    struct mjs_object* o,
+    mjs_val_t key,
+    const char* name,
+    size_t len) {
+    struct mjs_property_table* t = o->table;
+    struct mjs_property* p;
+    uint32_t hash;
+    size_t i;
+
+    if(len == (size_t)~0) {
+        len = strlen(name);
+    }
+
+    if(len <= 5) {
+        key = mjs_mk_string(mjs, name, len, 1);
+    }
+
+    if(t == NULL) {
         for(p = o->properties; p != NULL; p = p->next) {
-            if(mjs_strcmp(mjs, &p->name, name, len) == 0) return p;
+            if(p->name == key) return p;
+            if(len > 5 && mjs_strcmp(mjs, &p->name, name, len) == 0) return p;
+        }
+        return NULL;
+    }
+
+    hash = mjs_str_hash(name, len);
+    for(i = hash & (t->size - 1); (p = t->slots[i].prop) != NULL; i = (i + 1) & (t->size - 1)) {
+        if(t->slots[i].hash != hash) continue;
+        if(p->name == key) return p;
+        if(len > 5 && mjs_strcmp(mjs, &p->name, name, len) == 0) {
+            /* Switch to the interned name, so that next lookups compare values */
+            if((key & MJS_TAG_MASK) == MJS_TAG_STRING_F &&
+               mjs_intern_find(mjs, name, len, hash) == key) {
+                p->name = key;
+            }
+            return p;
         }
-        return p;
     }
 
     return NULL;
 }
 
+MJS_PRIVATE struct mjs_property*
+    mjs_get_own_property(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len) {
+    if(!mjs_is_object_based(obj)) {
+        return NULL;
+    }
+
+    return mjs_find_property(mjs, get_object_struct(obj), MJS_UNDEFINED, name, len);
+}
+
 MJS_PRIVATE struct mjs_property*
     mjs_get_own_property_v(struct mjs* mjs, mjs_val_t obj, mjs_val_t key) {
     size_t n;
@@ -83,8 +209,9 @@ MJS_PRIVATE struct mjs_property*
     int need_free = 0;
     struct mjs_property* p = NULL;
     mjs_err_t err = mjs_to_string(mjs, &key, &s, &n, &need_free);
-    if(err == MJS_OK) {
-        p = mjs_get_own_property(mjs, obj, s, n);
+    if(err == MJS_OK && mjs_is_object_based(obj)) {
+        p = mjs_find_property(
+            mjs, get_object_struct(obj), mjs_is_string(key) ? key : MJS_UNDEFINED, s, n);
     }
     if(need_free) free(s);
     return p;
@@ -178,7 +305,15 @@ MJS_PRIVATE mjs_err_t mjs_set_internal(
         name_v = MJS_UNDEFINED;
     }
 
-    p = mjs_get_own_property(mjs, obj, name, name_len);
+    if(!mjs_is_string(name_v)) {
+        name_v = MJS_UNDEFINED;
+    }
+
+    if(!mjs_is_object_based(obj)) {
+        p = NULL;
+    } else {
+        p = mjs_find_property(mjs, get_object_struct(obj), name_v, name, name_len);
+    }
 
     if(p == NULL) {
         struct mjs_object* o;
@@ -188,9 +323,15 @@ MJS_PRIVATE mjs_err_t mjs_set_internal(
 
         /*
      * name_v might be not a string here. In this case, we need to create a new
-     * `name_v`, which will be a string.
+     * `name_v`, which will be a string: the interned one if there is any.
      */
-        if(!mjs_is_string(name_v)) {
+        if(name_len == (size_t)~0) {
+            name_len = strlen(name);
+        }
+        if(name_v == MJS_UNDEFINED && name_len > 5) {
+            name_v = mjs_intern_find(mjs, name, name_len, mjs_str_hash(name, name_len));
+        }
+        if(name_v == MJS_UNDEFINED) {
             name_v = mjs_mk_string(mjs, name, name_len, 1);
         }
 
@@ -199,6 +340,7 @@ MJS_PRIVATE mjs_err_t mjs_set_internal(
         o = get_object_struct(obj);
         p->next = o->properties;
         o->properties = p;
+        mjs_property_table_add(mjs, o, p);
     }
 
     p->value = val;
@@ -237,6 +379,9 @@ int mjs_del(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len) {
             } else {
                 get_object_struct(obj)->properties = prop->next;
             }
+            if(get_object_struct(obj)->table != NULL) {
+                mjs_property_table_build(mjs, get_object_struct(obj));
+            }
             mjs_destroy_property(&prop);
             return 0;
         }
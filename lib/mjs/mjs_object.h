@@ -21,8 +21,15 @@ struct mjs_property {
     mjs_val_t value; /* Property value */
 };
 
+struct mjs_property_table;
+
 struct mjs_object {
     struct mjs_property* properties;
+    /*
+   * Hash index of `properties`, built once the object has enough of them.
+   * Must not be the first member: GC marks cells in their first word.
+   */
+    struct mjs_property_table* table;
 };
 
 MJS_PRIVATE struct mjs_object* get_object_struct(mjs_val_t v);
@@ -45,6 +52,11 @@ MJS_PRIVATE mjs_err_t mjs_set_internal(
     size_t name_len,
     mjs_val_t val);
 
+/*
+ * GC cell destructor of objects
+ */
+MJS_PRIVATE void mjs_object_destructor(struct mjs* mjs, void* cell);
+
 /*
  * Implementation of `Object.create(proto)`
  */
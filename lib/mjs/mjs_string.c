@@ -599,3 +599,115 @@ MJS_PRIVATE void embed_string(
         m->buf[offset + tot_len - 1] = '\0';
     }
 }
+
+#ifndef MJS_INTERN_MAX_LEN
+#define MJS_INTERN_MAX_LEN 32
+#endif
+
+#define MJS_INTERN_INITIAL_SIZE 32
+
+MJS_PRIVATE uint32_t mjs_str_hash(const char* s, size_t len) {
+    uint32_t hash = 2166136261U;
+    size_t i;
+    for(i = 0; i < len; i++) {
+        hash = (hash ^ (uint8_t)s[i]) * 16777619U;
+    }
+    return hash;
+}
+
+/*
+ * Only identifier-like literals are interned: they are what property names
+ * are made of, and they are never used as buffers. Shorter strings are
+ * already stored in mjs_val_t itself.
+ */
+static int mjs_intern_is_candidate(const char* p, size_t len) {
+    size_t i;
+    if(len <= 5 || len > MJS_INTERN_MAX_LEN) return 0;
+    for(i = 0; i < len; i++) {
+        if(!isalnum((unsigned char)p[i]) && p[i] != '_' && p[i] != '$') return 0;
+    }
+    return 1;
+}
+
+static mjs_val_t* mjs_intern_slot(
+    struct mjs* mjs,
+    struct mjs_intern_table* t,
+    const char* p,
+    size_t len,
+    uint32_t hash) {
+    size_t i = hash & (t->size - 1);
+    for(;; i = (i + 1) & (t->size - 1)) {
+        size_t n;
+        const char* s;
+        if(t->slots[i] == 0) return &t->slots[i];
+        s = mjs_get_string(mjs, &t->slots[i], &n);
+        if(n == len && memcmp(s, p, len) == 0) return &t->slots[i];
+    }
+}
+
+static void mjs_intern_grow(struct mjs* mjs) {
+    struct mjs_intern_table* t = &mjs->interned;
+    struct mjs_intern_table grown;
+    size_t i;
+
+    grown.size = t->size ? t->size * 2 : MJS_INTERN_INITIAL_SIZE;
+    grown.count = t->count;
+    grown.slots = (mjs_val_t*)calloc(grown.size, sizeof(mjs_val_t));
+
+    for(i = 0; i < t->size; i++) {
+        size_t n;
+        const char* s;
+        if(t->slots[i] == 0) continue;
+        s = mjs_get_string(mjs, &t->slots[i], &n);
+        *mjs_intern_slot(mjs, &grown, s, n, mjs_str_hash(s, n)) = t->slots[i];
+    }
+
+    free(t->slots);
+    *t = grown;
+}
+
+MJS_PRIVATE mjs_val_t
+    mjs_intern_find(struct mjs* mjs, const char* p, size_t len, uint32_t hash) {
+    mjs_val_t* slot;
+    if(mjs->interned.count == 0) return MJS_UNDEFINED;
+    slot = mjs_intern_slot(mjs, &mjs->interned, p, len, hash);
+    return *slot != 0 ? *slot : MJS_UNDEFINED;
+}
+
+MJS_PRIVATE mjs_val_t mjs_mk_string_literal(struct mjs* mjs, const char* p, size_t len) {
+    mjs_val_t* slot;
+    char* copy;
+
+    if(!mjs_intern_is_candidate(p, len)) {
+        return mjs_mk_string(mjs, p, len, 1);
+    }
+
+    /* Keep the load factor under 1/2 */
+    if((mjs->interned.count + 1) * 2 > mjs->interned.size) {
+        mjs_intern_grow(mjs);
+    }
+
+    slot = mjs_intern_slot(mjs, &mjs->interned, p, len, mjs_str_hash(p, len));
+    if(*slot == 0) {
+        copy = (char*)malloc(len + 1);
+        memcpy(copy, p, len);
+        copy[len] = '\0';
+        *slot = mjs_mk_string(mjs, copy, len, 0);
+        mjs->interned.count++;
+    }
+
+    return *slot;
+}
+
+MJS_PRIVATE void mjs_intern_free(struct mjs* mjs) {
+    struct mjs_intern_table* t = &mjs->interned;
+    size_t i;
+    for(i = 0; i < t->size; i++) {
+        if(t->slots[i] != 0) {
+            size_t n;
+            free((void*)mjs_get_string(mjs, &t->slots[i], &n));
+        }
+    }
+    free(t->slots);
+    memset(t, 0, sizeof(*t));
+}
@@ -33,6 +33,30 @@ MJS_PRIVATE void embed_string(
 
 MJS_PRIVATE void mjs_mkstr(struct mjs* mjs);
 
+/*
+ * FNV-1a hash of a string
+ */
+MJS_PRIVATE uint32_t mjs_str_hash(const char* s, size_t len);
+
+/*
+ * Makes a string value from a bcode string literal. Literals which look like
+ * property names are interned: the same literal always yields the same value,
+ * so that property names compare as values. Other literals are copied.
+ */
+MJS_PRIVATE mjs_val_t mjs_mk_string_literal(struct mjs* mjs, const char* p, size_t len);
+
+/*
+ * Returns the interned value of a string with the given hash, or
+ * MJS_UNDEFINED if the string is not interned
+ */
+MJS_PRIVATE mjs_val_t
+    mjs_intern_find(struct mjs* mjs, const char* p, size_t len, uint32_t hash);
+
+/*
+ * Frees interned strings
+ */
+MJS_PRIVATE void mjs_intern_free(struct mjs* mjs);
+
 MJS_PRIVATE void mjs_string_slice(struct mjs* mjs);
 MJS_PRIVATE void mjs_string_index_of(struct mjs* mjs);
 MJS_PRIVATE void mjs_string_char_code_at(struct mjs* mjs);
@@ -4,11 +4,16 @@
 
 #include <furi_hal_nfc.h>
 #include <furi/furi.h>
+#include <toolbox/profiler.h>
 
 #define TAG "Nfc"
 
 #define NFC_MAX_BUFFER_SIZE (256)
 
+PROFILER_ZONE(nfc_zone_listener_rx, "NfcListenerRx");
+PROFILER_ZONE(nfc_zone_listener_tx, "NfcListenerTx");
+PROFILER_ZONE(nfc_zone_poller_trx, "NfcPollerTrx");
+
 typedef enum {
     NfcStateIdle,
     NfcStateRunning,
@@ -138,6 +143,7 @@ static int32_t nfc_worker_listener(void* context) {
             instance->callback(nfc_event, instance->context);
         }
         if(event & FuriHalNfcEventRxEnd) {
+            PROFILER_TRACE_BEGIN(nfc_zone_listener_rx);
             furi_hal_nfc_timer_block_tx_start(instance->fdt_listen_fc);
 
             nfc_event.type = NfcEventTypeRxEnd;
@@ -145,6 +151,7 @@ static int32_t nfc_worker_listener(void* context) {
                 instance->rx_buffer, sizeof(instance->rx_buffer), &instance->rx_bits);
             bit_buffer_copy_bits(event_data.buffer, instance->rx_buffer, instance->rx_bits);
             command = instance->callback(nfc_event, instance->context);
+            PROFILER_TRACE_END(nfc_zone_listener_rx);
             if(command == NfcCommandStop) {
                 break;
             } else if(command == NfcCommandReset) {
@@ -341,11 +348,13 @@ NfcError nfc_listener_tx(Nfc* instance, const BitBuffer* tx_buffer) {
 
     NfcError ret = NfcErrorNone;
 
+    PROFILER_TRACE_BEGIN(nfc_zone_listener_tx);
     while(furi_hal_nfc_timer_block_tx_is_running()) {
     }
 
     FuriHalNfcError error =
         furi_hal_nfc_listener_tx(bit_buffer_get_data(tx_buffer), bit_buffer_get_size(tx_buffer));
+    PROFILER_TRACE_END(nfc_zone_listener_tx);
     if(error != FuriHalNfcErrorNone) {
         FURI_LOG_D(TAG, "Failed in listener TX");
         ret = nfc_process_hal_error(error);
@@ -358,6 +367,7 @@ static NfcError nfc_poller_trx_state_machine(Nfc* instance, uint32_t fwt_fc) {
     FuriHalNfcEvent event = 0;
     NfcError error = NfcErrorNone;
 
+    PROFILER_TRACE_BEGIN(nfc_zone_poller_trx);
     while(true) {
         event = furi_hal_nfc_poller_wait_event(FURI_HAL_NFC_EVENT_WAIT_FOREVER);
         if(event & FuriHalNfcEventTimerBlockTxExpired) {
@@ -400,6 +410,7 @@ static NfcError nfc_poller_trx_state_machine(Nfc* instance, uint32_t fwt_fc) {
             }
         }
     }
+    PROFILER_TRACE_END(nfc_zone_poller_trx);
 
     return error;
 }
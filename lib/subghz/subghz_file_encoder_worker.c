@@ -8,7 +8,8 @@
 
 #define TAG "SubGhzFileEncoderWorker"
 
-#define SUBGHZ_FILE_ENCODER_LOAD 512
+#define SUBGHZ_FILE_ENCODER_LOAD  512
+#define SUBGHZ_FILE_ENCODER_BATCH 64
 
 struct SubGhzFileEncoderWorker {
     FuriThread* thread;
@@ -38,11 +39,19 @@ void subghz_file_encoder_worker_callback_end(
     instance->context_end = context_end;
 }
 
+static void subghz_file_encoder_worker_add_level_durations(
+    SubGhzFileEncoderWorker* instance,
+    const int32_t* durations,
+    size_t count) {
+    const size_t size = sizeof(int32_t) * count;
+    size_t ret = furi_stream_buffer_send(instance->stream, durations, size, 100);
+    if(size != ret) FURI_LOG_E(TAG, "Invalid add duration in the stream");
+}
+
 void subghz_file_encoder_worker_add_level_duration(
     SubGhzFileEncoderWorker* instance,
     int32_t duration) {
-    size_t ret = furi_stream_buffer_send(instance->stream, &duration, sizeof(int32_t), 100);
-    if(sizeof(int32_t) != ret) FURI_LOG_E(TAG, "Invalid add duration in the stream");
+    subghz_file_encoder_worker_add_level_durations(instance, &duration, 1);
 }
 
 bool subghz_file_encoder_worker_data_parse(SubGhzFileEncoderWorker* instance, const char* strStart) {
@@ -56,13 +65,21 @@ bool subghz_file_encoder_worker_data_parse(SubGhzFileEncoderWorker* instance, co
         // Skip key
         str = strchr(str, ' ');
 
-        // Parse next element
-        int32_t duration;
-        while(strint_to_int32(str, &str, &duration, 10) == StrintParseNoError) {
-            subghz_file_encoder_worker_add_level_duration(instance, duration);
+        // Parse elements in batches, one stream buffer send per batch
+        int32_t durations[SUBGHZ_FILE_ENCODER_BATCH];
+        size_t count = 0;
+        while(strint_to_int32(str, &str, &durations[count], 10) == StrintParseNoError) {
+            if(++count == SUBGHZ_FILE_ENCODER_BATCH) {
+                subghz_file_encoder_worker_add_level_durations(instance, durations, count);
+                count = 0;
+            }
             if(*str == ',') str++; // could also be `\0`
         }
 
+        if(count) {
+            subghz_file_encoder_worker_add_level_durations(instance, durations, count);
+        }
+
         res = true;
     }
 
@@ -24,6 +24,8 @@ const CompressConfigHeatshrink compress_config_heatshrink_default = {
 /** Buffer size for input data */
 static bool compress_decode_internal(
     heatshrink_decoder* decoder,
+    uint8_t* work_buffer,
+    size_t work_buffer_size,
     const uint8_t* data_in,
     size_t data_in_size,
     uint8_t* data_out,
@@ -40,6 +42,7 @@ _Static_assert(sizeof(CompressHeader) == 4, "Incorrect CompressHeader size");
 
 struct CompressIcon {
     heatshrink_decoder* decoder;
+    uint8_t* work_buffer;
     uint8_t* buffer;
     size_t buffer_size;
 };
@@ -51,6 +54,7 @@ CompressIcon* compress_icon_alloc(size_t decode_buf_size) {
         COMPRESS_EXP_BUFF_SIZE_LOG,
         COMPRESS_LOOKAHEAD_BUFF_SIZE_LOG);
     heatshrink_decoder_reset(instance->decoder);
+    instance->work_buffer = malloc(COMPRESS_ICON_ENCODED_BUFF_SIZE * 2);
 
     instance->buffer_size = decode_buf_size + 4; /* To account for heatshrink's poller quirks */
     instance->buffer = malloc(instance->buffer_size);
@@ -61,6 +65,7 @@ CompressIcon* compress_icon_alloc(size_t decode_buf_size) {
 void compress_icon_free(CompressIcon* instance) {
     furi_check(instance);
     free(instance->buffer);
+    free(instance->work_buffer);
     heatshrink_decoder_free(instance->decoder);
     free(instance);
 }
@@ -76,6 +81,8 @@ void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint
         /* If decompression fails - check that decode_buf_size is large enough */
         furi_check(compress_decode_internal(
             instance->decoder,
+            instance->work_buffer,
+            COMPRESS_ICON_ENCODED_BUFF_SIZE,
             icon_data,
             /* Decoder will check/process headers again - need to pass them */
             sizeof(CompressHeader) + header->compressed_buff_size,
@@ -92,6 +99,7 @@ struct Compress {
     const void* config;
     heatshrink_encoder* encoder;
     heatshrink_decoder* decoder;
+    uint8_t* decode_buffer;
 };
 
 Compress* compress_alloc(CompressType type, const void* config) {
@@ -102,6 +110,7 @@ Compress* compress_alloc(CompressType type, const void* config) {
     compress->config = config;
     compress->encoder = NULL;
     compress->decoder = NULL;
+    compress->decode_buffer = NULL;
 
     return compress;
 }
@@ -114,6 +123,7 @@ void compress_free(Compress* compress) {
     }
     if(compress->decoder) {
         heatshrink_decoder_free(compress->decoder);
+        free(compress->decode_buffer);
     }
     free(compress);
 }
@@ -126,8 +136,7 @@ static bool compress_encode_internal(
     size_t data_out_size,
     size_t* data_res_size) {
     furi_check(encoder);
-    furi_check(data_in);
-    furi_check(data_in_size);
+    furi_check(data_in || !data_in_size);
 
     size_t sink_size = 0;
     size_t poll_size = 0;
@@ -221,8 +230,10 @@ static inline bool compress_decoder_poll(
     return true;
 }
 
+/* Work buffer holds compressed and decompressed chunks of work_buffer_size each */
 static bool compress_decode_stream_internal(
     heatshrink_decoder* decoder,
+    uint8_t* work_buffer,
     const size_t work_buffer_size,
     CompressIoCallback read_cb,
     void* read_context,
@@ -234,8 +245,8 @@ static bool compress_decode_stream_internal(
     size_t read_size = 0;
     size_t sink_size = 0;
 
-    uint8_t* compressed_chunk = malloc(work_buffer_size);
-    uint8_t* decompressed_chunk = malloc(work_buffer_size);
+    uint8_t* compressed_chunk = work_buffer;
+    uint8_t* decompressed_chunk = &work_buffer[work_buffer_size];
 
     /* Sink data to decoding buffer */
     do {
@@ -275,9 +286,6 @@ static bool compress_decode_stream_internal(
         }
     }
 
-    free(compressed_chunk);
-    free(decompressed_chunk);
-
     return !decode_failed;
 }
 
@@ -305,12 +313,15 @@ static int32_t memory_stream_io_callback(void* context, uint8_t* ptr, size_t siz
 
 static bool compress_decode_internal(
     heatshrink_decoder* decoder,
+    uint8_t* work_buffer,
+    size_t work_buffer_size,
     const uint8_t* data_in,
     size_t data_in_size,
     uint8_t* data_out,
     size_t data_out_size,
     size_t* data_res_size) {
     furi_check(decoder);
+    furi_check(work_buffer);
     furi_check(data_in);
     furi_check(data_out);
     furi_check(data_res_size);
@@ -318,7 +329,16 @@ static bool compress_decode_internal(
     bool result = false;
 
     CompressHeader* header = (CompressHeader*)data_in;
-    if(header->is_compressed) {
+    if(data_in_size == 0) {
+        /* Not even a header */
+        result = false;
+    } else if(
+        header->is_compressed &&
+        (data_in_size < sizeof(CompressHeader) ||
+         header->compressed_buff_size > data_in_size - sizeof(CompressHeader))) {
+        /* Truncated compressed data */
+        result = false;
+    } else if(header->is_compressed) {
         MemoryStreamState compressed_context = {
             .data_ptr = (uint8_t*)&data_in[sizeof(CompressHeader)],
             .data_size = header->compressed_buff_size,
@@ -332,7 +352,8 @@ static bool compress_decode_internal(
         heatshrink_decoder_reset(decoder);
         if((result = compress_decode_stream_internal(
                 decoder,
-                COMPRESS_ICON_ENCODED_BUFF_SIZE,
+                work_buffer,
+                work_buffer_size,
                 memory_stream_io_callback,
                 &compressed_context,
                 memory_stream_io_callback,
@@ -340,7 +361,7 @@ static bool compress_decode_internal(
             *data_res_size = data_out_size - decompressed_context.data_size;
         }
     } else if(data_out_size >= data_in_size - 1) {
-        memcpy(data_out, &data_in[1], data_in_size);
+        memcpy(data_out, &data_in[1], data_in_size - 1);
         *data_res_size = data_in_size - 1;
         result = true;
     } else {
@@ -366,6 +387,16 @@ bool compress_encode(
         compress->encoder, data_in, data_in_size, data_out, data_out_size, data_res_size);
 }
 
+/* Decoder and its work buffers are kept for the lifetime of the instance */
+static void compress_decoder_prepare(Compress* compress) {
+    if(!compress->decoder) {
+        CompressConfigHeatshrink* hs_config = (CompressConfigHeatshrink*)compress->config;
+        compress->decoder = heatshrink_decoder_alloc(
+            hs_config->input_buffer_sz, hs_config->window_sz2, hs_config->lookahead_sz2);
+        compress->decode_buffer = malloc(hs_config->input_buffer_sz * 2);
+    }
+}
+
 bool compress_decode(
     Compress* compress,
     uint8_t* data_in,
@@ -373,13 +404,17 @@ bool compress_decode(
     uint8_t* data_out,
     size_t data_out_size,
     size_t* data_res_size) {
-    if(!compress->decoder) {
-        CompressConfigHeatshrink* hs_config = (CompressConfigHeatshrink*)compress->config;
-        compress->decoder = heatshrink_decoder_alloc(
-            hs_config->input_buffer_sz, hs_config->window_sz2, hs_config->lookahead_sz2);
-    }
+    CompressConfigHeatshrink* hs_config = (CompressConfigHeatshrink*)compress->config;
+    compress_decoder_prepare(compress);
     return compress_decode_internal(
-        compress->decoder, data_in, data_in_size, data_out, data_out_size, data_res_size);
+        compress->decoder,
+        compress->decode_buffer,
+        hs_config->input_buffer_sz,
+        data_in,
+        data_in_size,
+        data_out,
+        data_out_size,
+        data_res_size);
 }
 
 bool compress_decode_streamed(
@@ -389,14 +424,12 @@ bool compress_decode_streamed(
     CompressIoCallback write_cb,
     void* write_context) {
     CompressConfigHeatshrink* hs_config = (CompressConfigHeatshrink*)compress->config;
-    if(!compress->decoder) {
-        compress->decoder = heatshrink_decoder_alloc(
-            hs_config->input_buffer_sz, hs_config->window_sz2, hs_config->lookahead_sz2);
-    }
+    compress_decoder_prepare(compress);
 
     heatshrink_decoder_reset(compress->decoder);
     return compress_decode_stream_internal(
         compress->decoder,
+        compress->decode_buffer,
         hs_config->input_buffer_sz,
         read_cb,
         read_context,
@@ -89,7 +89,8 @@ void compress_free(Compress* compress);
  * @param      data_res_size  pointer to result output data size
  *
  * @note       Prepends compressed stream with a header. If data is not compressible,
- *             it will be stored as is after the header.
+ *             it will be stored as is after the header. Empty input is encoded as a
+ *             bare one byte header.
  * @return     true on success
  */
 bool compress_encode(
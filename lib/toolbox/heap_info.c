@@ -0,0 +1,90 @@
+#include "heap_info.h"
+
+#include <furi.h>
+
+static void heap_info_histogram_out(
+    PropertyValueContext* ctx,
+    const char* type,
+    const size_t histogram[MEMMGR_HEAP_HISTOGRAM_SIZE]) {
+    FuriString* value = furi_string_alloc();
+    for(size_t i = 0; i < MEMMGR_HEAP_HISTOGRAM_SIZE; i++) {
+        furi_string_cat_printf(value, i ? ",%zu" : "%zu", histogram[i]);
+    }
+    property_value_out(ctx, NULL, 3, "layout", type, "histogram", furi_string_get_cstr(value));
+    furi_string_free(value);
+}
+
+void heap_info_get(PropertyValueCallback out, char sep, void* context) {
+    FuriString* key = furi_string_alloc();
+    FuriString* value = furi_string_alloc();
+
+    PropertyValueContext property_context = {
+        .key = key, .value = value, .out = out, .sep = sep, .last = false, .context = context};
+
+    property_value_out(&property_context, NULL, 2, "format", "major", "1");
+    property_value_out(&property_context, NULL, 2, "format", "minor", "0");
+
+    property_value_out(&property_context, "%zu", 2, "heap", "total", memmgr_get_total_heap());
+    property_value_out(&property_context, "%zu", 2, "heap", "free", memmgr_get_free_heap());
+    property_value_out(
+        &property_context, "%zu", 2, "heap", "minimum", memmgr_get_minimum_free_heap());
+
+    MemmgrHeapLayout* layout = malloc(sizeof(MemmgrHeapLayout));
+    memmgr_heap_get_layout(layout);
+
+    property_value_out(
+        &property_context, "%zu", 3, "layout", "free", "blocks", layout->free_blocks);
+    property_value_out(
+        &property_context, "%zu", 3, "layout", "free", "bytes", layout->free_bytes);
+    property_value_out(
+        &property_context, "%zu", 3, "layout", "free", "max", layout->max_free_block);
+    heap_info_histogram_out(&property_context, "free", layout->free_histogram);
+    property_value_out(
+        &property_context, "%zu", 3, "layout", "used", "blocks", layout->used_blocks);
+    property_value_out(
+        &property_context, "%zu", 3, "layout", "used", "bytes", layout->used_bytes);
+    heap_info_histogram_out(&property_context, "used", layout->used_histogram);
+
+    furi_string_reset(value);
+    for(size_t i = 0; i < MEMMGR_HEAP_MAP_SIZE; i++) {
+        furi_string_push_back(value, "0123456789ABCDEF"[layout->map[i] * 15 / 100]);
+    }
+    property_value_out(&property_context, NULL, 2, "layout", "map", furi_string_get_cstr(value));
+    free(layout);
+
+    MemmgrHeapProfileInfo info = {0};
+    MemmgrHeapProfileSite* sites =
+        malloc(sizeof(MemmgrHeapProfileSite) * MEMMGR_HEAP_PROFILE_SITES);
+    size_t site_count = 0;
+    if(memmgr_heap_profile_get_info(&info)) {
+        site_count = memmgr_heap_profile_get_sites(sites, MEMMGR_HEAP_PROFILE_SITES);
+    }
+
+    property_value_out(&property_context, "%lu", 2, "profile", "interval", info.interval);
+    property_value_out(&property_context, "%lu", 2, "profile", "samples", info.samples);
+    property_value_out(&property_context, "%lu", 2, "profile", "untracked", info.untracked);
+
+    for(size_t i = 0; i < site_count; i++) {
+        char index[8];
+        snprintf(index, sizeof(index), "%zu", i);
+        property_value_out(
+            &property_context,
+            "0x%08lX %zu %zu %zu %zu",
+            3,
+            "profile",
+            "site",
+            index,
+            (uint32_t)sites[i].caller,
+            sites[i].allocations,
+            sites[i].bytes,
+            sites[i].live_count,
+            sites[i].live_bytes);
+    }
+
+    property_context.last = true;
+    property_value_out(&property_context, "%zu", 2, "profile", "sites", site_count);
+
+    free(sites);
+    furi_string_free(key);
+    furi_string_free(value);
+}
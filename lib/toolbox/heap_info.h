@@ -0,0 +1,24 @@
+#pragma once
+
+#include "property.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Get heap layout and allocation profiler statistics as key-value pairs
+ *
+ * Histograms are comma separated counts of blocks per size bucket, the map is a
+ * string of hex digits, one per heap segment, 0 for a full segment and F for a
+ * free one. Each profiled call site is reported as "caller allocations bytes
+ * live_count live_bytes", caller is a hex return address to be symbolized.
+ *
+ * @param      out      output callback
+ * @param      sep      key parts separator
+ * @param      context  context to pass to the callback
+ */
+void heap_info_get(PropertyValueCallback out, char sep, void* context);
+
+#ifdef __cplusplus
+}
+#endif
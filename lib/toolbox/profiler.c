@@ -85,3 +85,191 @@ void profiler_dump(Profiler* profiler) {
         }
     }
 }
+
+#define PROFILER_TRACE_RINGS     8 /**< Interrupts and the first 7 threads to record an event */
+#define PROFILER_TRACE_NAME_SIZE 16
+#define PROFILER_TRACE_ZONES_MAX 64
+
+typedef struct {
+    uint32_t cycles;
+    uint32_t zone; /**< Zone descriptor address, event type in bit 0 */
+} ProfilerTraceEvent;
+
+typedef struct {
+    FuriThreadId thread; /**< NULL for the interrupt ring */
+    char name[PROFILER_TRACE_NAME_SIZE];
+    uint32_t head;
+    ProfilerTraceEvent* events;
+} ProfilerTraceRing;
+
+typedef struct {
+    volatile bool running;
+    size_t capacity;
+    uint32_t dropped;
+    ProfilerTraceEvent* storage;
+    ProfilerTraceRing rings[PROFILER_TRACE_RINGS];
+} ProfilerTrace;
+
+static ProfilerTrace profiler_trace = {0};
+
+bool profiler_trace_start(size_t events) {
+    furi_check(events && !(events & (events - 1)));
+
+    profiler_trace_stop();
+
+    if(profiler_trace.capacity != events) {
+        free(profiler_trace.storage);
+        profiler_trace.storage = NULL;
+        profiler_trace.capacity = 0;
+
+        const size_t size = sizeof(ProfilerTraceEvent) * events * PROFILER_TRACE_RINGS;
+        if(memmgr_heap_get_max_free_block() < size) return false;
+        profiler_trace.storage = malloc(size);
+        profiler_trace.capacity = events;
+    }
+
+    profiler_trace.dropped = 0;
+    memset(profiler_trace.rings, 0, sizeof(profiler_trace.rings));
+    for(size_t i = 0; i < PROFILER_TRACE_RINGS; i++) {
+        profiler_trace.rings[i].events = &profiler_trace.storage[i * events];
+    }
+    strlcpy(profiler_trace.rings[0].name, "Interrupts", PROFILER_TRACE_NAME_SIZE);
+
+    profiler_trace.running = true;
+
+    return true;
+}
+
+void profiler_trace_stop(void) {
+    // Writers run with interrupts disabled, none is in progress once this is seen
+    profiler_trace.running = false;
+}
+
+static ProfilerTraceRing* profiler_trace_get_ring(FuriThreadId thread) {
+    for(size_t i = 0; i < PROFILER_TRACE_RINGS; i++) {
+        ProfilerTraceRing* ring = &profiler_trace.rings[i];
+        if(ring->thread == thread) {
+            return ring;
+        } else if(ring->thread == NULL && i > 0) {
+            ring->thread = thread;
+            const char* name = furi_thread_get_name(thread);
+            strlcpy(ring->name, name ? name : "?", PROFILER_TRACE_NAME_SIZE);
+            return ring;
+        }
+    }
+
+    return NULL;
+}
+
+void profiler_trace_event(const ProfilerZone* zone, ProfilerTraceEventType type) {
+    if(!profiler_trace.running) return;
+
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    const uint32_t cycles = DWT->CYCCNT;
+    // Tracing may have been stopped before interrupts were disabled
+    if(profiler_trace.running) {
+        ProfilerTraceRing* ring =
+            profiler_trace_get_ring(FURI_IS_IRQ_MODE() ? NULL : furi_thread_get_current_id());
+        if(ring) {
+            ProfilerTraceEvent* event =
+                &ring->events[ring->head++ & (profiler_trace.capacity - 1)];
+            event->cycles = cycles;
+            event->zone = (uint32_t)zone | type;
+        } else {
+            profiler_trace.dropped++;
+        }
+    }
+
+    __set_PRIMASK(primask);
+}
+
+void profiler_trace_get(PropertyValueCallback out, char sep, void* context) {
+    const bool running = profiler_trace.running;
+    profiler_trace_stop();
+
+    FuriString* key = furi_string_alloc();
+    FuriString* value = furi_string_alloc();
+
+    PropertyValueContext property_context = {
+        .key = key, .value = value, .out = out, .sep = sep, .last = false, .context = context};
+
+    property_value_out(&property_context, NULL, 2, "format", "major", "1");
+    property_value_out(&property_context, NULL, 2, "format", "minor", "0");
+
+    property_value_out(&property_context, "%u", 2, "trace", "running", running);
+    property_value_out(&property_context, "%lu", 2, "trace", "frequency", SystemCoreClock);
+    // Reference point to extend 32-bit timestamps of events
+    property_value_out(&property_context, "%lu", 2, "trace", "cycles", DWT->CYCCNT);
+    property_value_out(&property_context, "%lu", 2, "trace", "dropped", profiler_trace.dropped);
+
+    const ProfilerZone** zones = malloc(sizeof(ProfilerZone*) * PROFILER_TRACE_ZONES_MAX);
+    size_t zone_count = 0;
+    size_t thread_count = 0;
+
+    for(size_t i = 0; profiler_trace.capacity && i < PROFILER_TRACE_RINGS; i++) {
+        const ProfilerTraceRing* ring = &profiler_trace.rings[i];
+        const uint32_t count = MIN(ring->head, profiler_trace.capacity);
+        if(!count) continue;
+
+        char thread_index[8];
+        snprintf(thread_index, sizeof(thread_index), "%zu", thread_count++);
+        property_value_out(&property_context, NULL, 3, "thread", thread_index, "name", ring->name);
+        property_value_out(&property_context, "%lu", 3, "thread", thread_index, "events", count);
+
+        for(uint32_t j = 0; j < count; j++) {
+            const ProfilerTraceEvent* event =
+                &ring->events[(ring->head - count + j) & (profiler_trace.capacity - 1)];
+            const ProfilerZone* zone = (const ProfilerZone*)(event->zone & ~1UL);
+
+            size_t k = 0;
+            while(k < zone_count && zones[k] != zone) {
+                k++;
+            }
+            if(k == zone_count && zone_count < PROFILER_TRACE_ZONES_MAX) {
+                zones[zone_count++] = zone;
+            }
+
+            char event_index[8];
+            snprintf(event_index, sizeof(event_index), "%lu", j);
+            property_value_out(
+                &property_context,
+                "%lu %c 0x%08lX",
+                4,
+                "thread",
+                thread_index,
+                "event",
+                event_index,
+                event->cycles,
+                (event->zone & ProfilerTraceEventEnd) ? 'E' : 'B',
+                (uint32_t)zone);
+        }
+    }
+
+    for(size_t i = 0; i < zone_count; i++) {
+        char zone_index[8];
+        snprintf(zone_index, sizeof(zone_index), "%zu", i);
+        property_value_out(
+            &property_context,
+            "0x%08lX %s %s:%lu",
+            2,
+            "zone",
+            zone_index,
+            (uint32_t)zones[i],
+            zones[i]->name,
+            zones[i]->file,
+            zones[i]->line);
+    }
+
+    free(zones);
+
+    property_value_out(&property_context, "%zu", 2, "trace", "threads", thread_count);
+    property_context.last = true;
+    property_value_out(&property_context, "%zu", 2, "trace", "zones", zone_count);
+
+    furi_string_free(key);
+    furi_string_free(value);
+
+    profiler_trace.running = running;
+}
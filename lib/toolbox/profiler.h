@@ -1,5 +1,11 @@
 #pragma once
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "property.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -18,6 +24,71 @@ void profiler_stop(Profiler* profiler, const char* key);
 
 void profiler_dump(Profiler* profiler);
 
+/** Trace zone descriptor
+ *
+ * Zones are identified by the address of their descriptor, so recording an
+ * event costs no lookup. Define them with PROFILER_ZONE.
+ */
+typedef struct {
+    const char* name;
+    const char* file;
+    uint32_t line;
+} ProfilerZone;
+
+typedef enum {
+    ProfilerTraceEventBegin = 0,
+    ProfilerTraceEventEnd = 1,
+} ProfilerTraceEventType;
+
+#define PROFILER_TRACE_EVENTS_DEFAULT 256
+
+/** Define a trace zone
+ *
+ * @param      var        descriptor variable name
+ * @param      zone_name  zone name shown in the trace
+ */
+#define PROFILER_ZONE(var, zone_name) \
+    static const ProfilerZone var = {.name = zone_name, .file = __FILE__, .line = __LINE__}
+
+/** Mark beginning and end of a zone, zones may nest but must not overlap */
+#define PROFILER_TRACE_BEGIN(zone) profiler_trace_event(&(zone), ProfilerTraceEventBegin)
+#define PROFILER_TRACE_END(zone)   profiler_trace_event(&(zone), ProfilerTraceEventEnd)
+
+/** Start tracing, dropping previously collected events
+ *
+ * Each thread gets its own ring of the most recent events, all interrupts
+ * share one more.
+ *
+ * @param      events  ring capacity per thread, power of 2
+ *
+ * @return     true on success, false if out of memory
+ */
+bool profiler_trace_start(size_t events);
+
+/** Stop tracing, collected events are kept until the next start */
+void profiler_trace_stop(void);
+
+/** Record zone event with a DWT cycle counter timestamp
+ *
+ * Safe to call from interrupts, does nothing if tracing is not running.
+ *
+ * @param      zone  zone descriptor
+ * @param      type  event type
+ */
+void profiler_trace_event(const ProfilerZone* zone, ProfilerTraceEventType type);
+
+/** Get collected trace as key-value pairs
+ *
+ * Tracing is paused while the events are exported. Zones are reported as
+ * "id name file:line", events as "cycles B|E zone_id", oldest first.
+ * Use scripts/trace_export.py to convert them to a Chrome trace.
+ *
+ * @param      out      output callback
+ * @param      sep      key parts separator
+ * @param      context  context to pass to the callback
+ */
+void profiler_trace_get(PropertyValueCallback out, char sep, void* context);
+
 #ifdef __cplusplus
 }
 #endif
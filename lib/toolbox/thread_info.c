@@ -0,0 +1,65 @@
+#include "thread_info.h"
+
+#include <furi.h>
+
+void thread_info_get(PropertyValueCallback out, char sep, void* context) {
+    FuriString* key = furi_string_alloc();
+    FuriString* value = furi_string_alloc();
+
+    PropertyValueContext property_context = {
+        .key = key, .value = value, .out = out, .sep = sep, .last = false, .context = context};
+
+    property_value_out(&property_context, NULL, 2, "format", "major", "1");
+    property_value_out(&property_context, NULL, 2, "format", "minor", "0");
+
+    FuriThreadTelemetryInfo info = {0};
+    const bool running = furi_thread_telemetry_get_info(&info);
+
+    property_value_out(&property_context, "%u", 2, "telemetry", "running", running);
+    property_value_out(&property_context, "%lu", 2, "telemetry", "period", info.period);
+    property_value_out(&property_context, "%lu", 2, "telemetry", "samples", info.samples);
+    property_value_out(&property_context, "%lu", 2, "telemetry", "untracked", info.untracked);
+
+    FuriThreadTelemetryThread* thread = malloc(sizeof(FuriThreadTelemetryThread));
+    size_t thread_count = 0;
+
+    for(size_t i = 0; running && i < FURI_THREAD_TELEMETRY_THREADS; i++) {
+        if(!furi_thread_telemetry_get_thread(i, thread)) continue;
+
+        char thread_index[8];
+        snprintf(thread_index, sizeof(thread_index), "%zu", thread_count++);
+        property_value_out(
+            &property_context, NULL, 3, "thread", thread_index, "name", thread->name);
+        property_value_out(
+            &property_context, "%lu", 3, "thread", thread_index, "first", thread->first);
+        property_value_out(
+            &property_context, "%zu", 3, "thread", thread_index, "samples", thread->count);
+
+        for(size_t j = 0; j < thread->count; j++) {
+            const FuriThreadTelemetrySample* sample = &thread->history[j];
+
+            char sample_index[12];
+            snprintf(sample_index, sizeof(sample_index), "%lu", thread->first + j);
+            property_value_out(
+                &property_context,
+                "%u %u %u %u",
+                4,
+                "thread",
+                thread_index,
+                "sample",
+                sample_index,
+                sample->cpu,
+                sample->switches,
+                sample->latency_max,
+                sample->stack_min_free);
+        }
+    }
+
+    free(thread);
+
+    property_context.last = true;
+    property_value_out(&property_context, "%zu", 2, "telemetry", "threads", thread_count);
+
+    furi_string_free(key);
+    furi_string_free(value);
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "property.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Get per-thread telemetry history as key-value pairs
+ *
+ * Each sample is reported as "cpu switches latency stack" under its number:
+ * CPU time in hundredths of percent, context switches, longest ready to
+ * running delay in microseconds and minimum free stack in bytes. Sample
+ * numbers are shared by all threads, clients polling the history faster than
+ * it wraps pick up the numbers they haven't seen yet.
+ *
+ * @param      out      output callback
+ * @param      sep      key parts separator
+ * @param      context  context to pass to the callback
+ */
+void thread_info_get(PropertyValueCallback out, char sep, void* context);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+
+import subprocess
+
+from flipper.app import App
+from flipper.storage import FlipperStorage
+from flipper.utils.cdc import resolve_port
+
+
+class Main(App):
+    HISTOGRAM_LABELS = ["<32"] + [f"<{32 << i}" for i in range(1, 11)] + [">=32K"]
+
+    def init(self):
+        self.parser.add_argument("-p", "--port", help="CDC Port", default="auto")
+
+        self.subparsers = self.parser.add_subparsers(help="sub-command help")
+
+        self.parser_start = self.subparsers.add_parser(
+            "start", help="Start allocation profiler"
+        )
+        self.parser_start.add_argument(
+            "-i",
+            "--interval",
+            type=int,
+            default=8,
+            help="Sample every interval-th allocation",
+        )
+        self.parser_start.set_defaults(func=self.start)
+
+        self.parser_stop = self.subparsers.add_parser(
+            "stop", help="Stop allocation profiler"
+        )
+        self.parser_stop.set_defaults(func=self.stop)
+
+        self.parser_dump = self.subparsers.add_parser(
+            "dump", help="Dump heap layout and symbolized allocation sites"
+        )
+        self.parser_dump.add_argument(
+            "-e",
+            "--elf",
+            help="Firmware ELF to symbolize call sites against",
+            default="build/latest/firmware.elf",
+        )
+        self.parser_dump.add_argument(
+            "-f",
+            "--file",
+            help="Read saved `heap profile` CLI output instead of a device",
+            default=None,
+        )
+        self.parser_dump.add_argument(
+            "-n", "--top", type=int, default=20, help="Number of sites to show"
+        )
+        self.parser_dump.set_defaults(func=self.dump)
+
+    def _get_flipper(self):
+        if not (port := resolve_port(self.logger, self.args.port)):
+            self.logger.error("Failed to find flipper")
+            return None
+
+        flipper = FlipperStorage(port)
+        flipper.start()
+        return flipper
+
+    def _command(self, command: str):
+        if not (flipper := self._get_flipper()):
+            return None
+
+        flipper.send_and_wait_eol(command + "\r")
+        output = flipper.read.until(flipper.CLI_PROMPT).decode("ascii")
+        flipper.stop()
+        return output
+
+    def start(self):
+        if (output := self._command(f"heap profile start {self.args.interval}")) is None:
+            return 1
+        self.logger.info(output.strip())
+        return 0
+
+    def stop(self):
+        if self._command("heap profile stop") is None:
+            return 1
+        return 0
+
+    @staticmethod
+    def _parse(output: str):
+        properties = {}
+        for line in output.splitlines():
+            key, sep, value = line.partition(":")
+            if sep:
+                properties[key.strip()] = value.strip()
+        return properties
+
+    def _symbolize(self, addresses):
+        # Return addresses point past the call, with the Thumb bit set
+        call_addresses = [f"0x{(address & ~1) - 1:08X}" for address in addresses]
+        try:
+            output = subprocess.check_output(
+                ["arm-none-eabi-addr2line", "-e", self.args.elf, "-f", "-C", "-p"]
+                + call_addresses,
+                shell=False,
+            )
+        except (OSError, subprocess.CalledProcessError) as e:
+            self.logger.warning(f"Failed to symbolize call sites: {e}")
+            return ["??"] * len(addresses)
+
+        return output.decode("utf-8").splitlines()
+
+    def dump(self):
+        if self.args.file:
+            with open(self.args.file, "r") as f:
+                output = f.read()
+        elif (output := self._command("heap profile")) is None:
+            return 1
+
+        properties = self._parse(output)
+        if properties.get("format.major") != "1":
+            self.logger.error("Unsupported heap profile format")
+            return 1
+
+        print(
+            f"Heap: total {properties['heap.total']}, free {properties['heap.free']}, "
+            f"minimum {properties['heap.minimum']}"
+        )
+        print(
+            f"Free: {properties['layout.free.blocks']} blocks, "
+            f"{properties['layout.free.bytes']} bytes, "
+            f"largest {properties['layout.free.max']}"
+        )
+        print(
+            f"Used: {properties['layout.used.blocks']} blocks, "
+            f"{properties['layout.used.bytes']} bytes"
+        )
+
+        free_histogram = properties["layout.free.histogram"].split(",")
+        used_histogram = properties["layout.used.histogram"].split(",")
+        print(f"\n{'Size':>8} {'Free':>8} {'Used':>8}")
+        for label, free, used in zip(
+            self.HISTOGRAM_LABELS, free_histogram, used_histogram
+        ):
+            print(f"{label:>8} {free:>8} {used:>8}")
+
+        print(f"\nFree space map, 0 - full, F - free:\n{properties['layout.map']}")
+
+        interval = int(properties["profile.interval"])
+        if not interval:
+            print("\nAllocation profiler is not running")
+            return 0
+
+        print(
+            f"\nSampled {properties['profile.samples']} allocations, 1 of {interval}, "
+            f"{properties['profile.untracked']} untracked"
+        )
+
+        sites = []
+        for i in range(int(properties["profile.sites"])):
+            caller, allocations, size, live_count, live_bytes = properties[
+                f"profile.site.{i}"
+            ].split()
+            sites.append(
+                (
+                    int(caller, 16),
+                    int(allocations) * interval,
+                    int(size) * interval,
+                    int(live_count) * interval,
+                    int(live_bytes) * interval,
+                )
+            )
+
+        sites.sort(key=lambda site: site[4], reverse=True)
+        sites = sites[: self.args.top]
+        symbols = self._symbolize([site[0] for site in sites if site[0]])
+        symbols.reverse()
+
+        print(f"\n{'Live bytes':>10} {'Live':>6} {'Bytes':>10} {'Allocs':>8}  Site")
+        for caller, allocations, size, live_count, live_bytes in sites:
+            symbol = symbols.pop() if caller else "(other sites)"
+            print(
+                f"{live_bytes:>10} {live_count:>6} {size:>10} {allocations:>8}  "
+                f"0x{caller:08X} {symbol}"
+            )
+
+        return 0
+
+
+if __name__ == "__main__":
+    Main()()
@@ -0,0 +1,247 @@
+#!/usr/bin/env python3
+
+import re
+import struct
+import sys
+
+from elftools.elf.constants import SH_FLAGS
+from elftools.elf.elffile import ELFFile
+from flipper.app import App
+from flipper.storage import FlipperStorage
+from flipper.utils.cdc import resolve_port
+
+
+class LogRecordDecoder:
+    FRAME_MAGIC = b"\xfb\x01"
+    RECORD_HEADER = struct.Struct("<HBBL")
+    RECORD_SIZE_MAX = 128
+    STRING_POINTER = 0xFFFF
+    FLAG_RAW = 1 << 2
+
+    LEVELS = {2: "E", 3: "W", 4: "I", 5: "D", 6: "T"}
+
+    # Same conversions the firmware encodes, see furi_log_spec_parse in furi/core/log.c
+    SPEC_RE = re.compile(
+        r"%(?P<flags>[-+ #0']*)(?P<width>\*|\d+)?(?:\.(?P<precision>\*|\d*))?"
+        r"(?P<length>hh|h|ll|l|q|j|z|t|L)?(?P<conversion>[diouxXcfFeEgGaAsp%])"
+    )
+
+    def __init__(self, elf_file):
+        self.sections = []
+        self.strings = {}
+        elf = ELFFile(elf_file)
+        for section in elf.iter_sections():
+            if (
+                section["sh_flags"] & SH_FLAGS.SHF_ALLOC
+                and section["sh_type"] != "SHT_NOBITS"
+            ):
+                self.sections.append((section["sh_addr"], section.data()))
+
+    def _elf_string(self, address):
+        if (string := self.strings.get(address)) is not None:
+            return string
+
+        string = f"<0x{address:08X}>"
+        for start, data in self.sections:
+            if start <= address < start + len(data):
+                offset = address - start
+                string = data[offset : data.index(b"\0", offset)].decode(
+                    "utf-8", errors="replace"
+                )
+                break
+
+        self.strings[address] = string
+        return string
+
+    def _read_string(self, payload, offset):
+        (length,) = struct.unpack_from("<H", payload, offset)
+        offset += 2
+        if length == self.STRING_POINTER:
+            (address,) = struct.unpack_from("<L", payload, offset)
+            return self._elf_string(address), offset + 4
+
+        if offset + length > len(payload):
+            raise struct.error("String is out of record bounds")
+        return payload[offset : offset + length].decode("utf-8", errors="replace"), (
+            offset + length
+        )
+
+    def _format(self, format_string, payload, offset):
+        output = []
+        cursor = 0
+        for spec in self.SPEC_RE.finditer(format_string):
+            output.append(format_string[cursor : spec.start()])
+            cursor = spec.start()
+            conversion = spec["conversion"]
+            if conversion == "%":
+                output.append("%")
+                cursor = spec.end()
+                continue
+
+            try:
+                width, precision = spec["width"], spec["precision"]
+                if width == "*":
+                    (width,) = struct.unpack_from("<l", payload, offset)
+                    offset += 4
+                if precision == "*":
+                    (precision,) = struct.unpack_from("<l", payload, offset)
+                    offset += 4
+
+                if conversion == "s":
+                    value, offset = self._read_string(payload, offset)
+                elif conversion in "fFeEgGaA":
+                    (value,) = struct.unpack_from("<d", payload, offset)
+                    offset += 8
+                    if conversion in "aA":
+                        value, conversion = value.hex(), "s"
+                else:
+                    # Arguments narrower than 64 bits are stored as 32 bits
+                    wide = spec["length"] in ("ll", "q", "j")
+                    size = 8 if wide else 4
+                    signed = conversion in "di"
+                    value_format = "<q" if wide else "<l"
+                    if not signed:
+                        value_format = value_format.upper()
+                    (value,) = struct.unpack_from(value_format, payload, offset)
+                    offset += size
+                    if conversion == "p":
+                        value, conversion = f"0x{value:x}", "s"
+                    elif conversion == "u":
+                        conversion = "d"
+            except struct.error:
+                # Arguments were truncated on the device
+                break
+
+            python_spec = "%" + spec["flags"].replace("'", "")
+            if width is not None:
+                python_spec += str(width)
+            if precision is not None:
+                python_spec += "." + str(precision)
+            output.append((python_spec + conversion) % value)
+            cursor = spec.end()
+
+        output.append(format_string[cursor:])
+        return "".join(output)
+
+    def decode(self, record):
+        size, level, flags, tick = self.RECORD_HEADER.unpack_from(record)
+        payload = record[self.RECORD_HEADER.size : size]
+        tag, offset = self._read_string(payload, 0)
+        format_string, offset = self._read_string(payload, offset)
+        message = self._format(format_string, payload, offset)
+        if flags & self.FLAG_RAW:
+            return message
+        return f"{tick} [{self.LEVELS.get(level, ' ')}][{tag}] {message}\n"
+
+    def feed(self, buffer: bytearray):
+        """Decode complete frames from buffer, pass other bytes through as text"""
+        output = []
+        while True:
+            start = buffer.find(self.FRAME_MAGIC)
+            if start < 0:
+                # Keep a possible magic prefix for the next chunk
+                keep = 1 if buffer.endswith(self.FRAME_MAGIC[:1]) else 0
+                output.append(
+                    buffer[: len(buffer) - keep].decode("utf-8", errors="replace")
+                )
+                del buffer[: len(buffer) - keep]
+                break
+
+            output.append(buffer[:start].decode("utf-8", errors="replace"))
+            del buffer[:start]
+            if len(buffer) < len(self.FRAME_MAGIC) + self.RECORD_HEADER.size:
+                break
+
+            (size,) = struct.unpack_from("<H", buffer, len(self.FRAME_MAGIC))
+            if size < self.RECORD_HEADER.size or size > self.RECORD_SIZE_MAX:
+                output.append(buffer[:1].decode("utf-8", errors="replace"))
+                del buffer[:1]
+                continue
+            if len(buffer) < len(self.FRAME_MAGIC) + size:
+                break
+
+            end = len(self.FRAME_MAGIC) + size
+            record = bytes(buffer[len(self.FRAME_MAGIC) : end])
+            del buffer[:end]
+            try:
+                output.append(self.decode(record))
+            except (struct.error, TypeError, ValueError) as e:
+                output.append(f"<undecodable record: {e}>\n")
+
+        return "".join(output)
+
+
+class Main(App):
+    def init(self):
+        self.parser.add_argument("-p", "--port", help="CDC Port", default="auto")
+        self.parser.add_argument(
+            "-e",
+            "--elf",
+            help="Firmware ELF to resolve tags and formats against",
+            default="build/latest/firmware.elf",
+        )
+        self.parser.add_argument(
+            "-f",
+            "--file",
+            help="Decode a saved binary log stream instead of a device",
+            default=None,
+        )
+        self.parser.add_argument(
+            "-s",
+            "--save",
+            help="Save the raw binary log stream to a file",
+            default=None,
+        )
+        self.parser.add_argument(
+            "-l", "--level", help="Log level to request from the device", default=None
+        )
+        self.parser.set_defaults(func=self.decode)
+
+    def _decode_file(self, decoder):
+        with open(self.args.file, "rb") as f:
+            buffer = bytearray(f.read())
+        sys.stdout.write(decoder.feed(buffer))
+        return 0
+
+    def _decode_device(self, decoder, save):
+        if not (port := resolve_port(self.logger, self.args.port)):
+            self.logger.error("Failed to find flipper")
+            return 1
+
+        flipper = FlipperStorage(port)
+        flipper.start()
+        flipper.send_and_wait_eol(f"log {self.args.level or ''} binary\r")
+
+        buffer = bytearray()
+        try:
+            while True:
+                data = flipper.port.read(max(1, flipper.port.in_waiting))
+                if save:
+                    save.write(data)
+                buffer.extend(data)
+                sys.stdout.write(decoder.feed(buffer))
+                sys.stdout.flush()
+        except KeyboardInterrupt:
+            pass
+        finally:
+            flipper.send("\x03")
+            flipper.stop()
+
+        return 0
+
+    def decode(self):
+        with open(self.args.elf, "rb") as elf_file:
+            decoder = LogRecordDecoder(elf_file)
+
+            if self.args.file:
+                return self._decode_file(decoder)
+
+            if not self.args.save:
+                return self._decode_device(decoder, None)
+
+            with open(self.args.save, "wb") as save:
+                return self._decode_device(decoder, save)
+
+
+if __name__ == "__main__":
+    Main()()
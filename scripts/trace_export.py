@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+
+import json
+
+from flipper.app import App
+from flipper.storage import FlipperStorage
+from flipper.utils.cdc import resolve_port
+
+
+class Main(App):
+    def init(self):
+        self.parser.add_argument("-p", "--port", help="CDC Port", default="auto")
+
+        self.subparsers = self.parser.add_subparsers(help="sub-command help")
+
+        self.parser_start = self.subparsers.add_parser("start", help="Start tracing")
+        self.parser_start.add_argument(
+            "-n",
+            "--events",
+            type=int,
+            default=256,
+            help="Events to keep per thread, power of 2",
+        )
+        self.parser_start.set_defaults(func=self.start)
+
+        self.parser_stop = self.subparsers.add_parser("stop", help="Stop tracing")
+        self.parser_stop.set_defaults(func=self.stop)
+
+        self.parser_export = self.subparsers.add_parser(
+            "export", help="Export collected events as Chrome trace JSON"
+        )
+        self.parser_export.add_argument(
+            "-f",
+            "--file",
+            help="Read saved `trace` CLI output instead of a device",
+            default=None,
+        )
+        self.parser_export.add_argument(
+            "-o", "--output", help="Chrome trace file", default="trace.json"
+        )
+        self.parser_export.set_defaults(func=self.export)
+
+    def _get_flipper(self):
+        if not (port := resolve_port(self.logger, self.args.port)):
+            self.logger.error("Failed to find flipper")
+            return None
+
+        flipper = FlipperStorage(port)
+        flipper.start()
+        return flipper
+
+    def _command(self, command: str):
+        if not (flipper := self._get_flipper()):
+            return None
+
+        flipper.send_and_wait_eol(command + "\r")
+        output = flipper.read.until(flipper.CLI_PROMPT).decode("ascii")
+        flipper.stop()
+        return output
+
+    def start(self):
+        if (output := self._command(f"trace start {self.args.events}")) is None:
+            return 1
+        self.logger.info(output.strip())
+        return 0
+
+    def stop(self):
+        if self._command("trace stop") is None:
+            return 1
+        return 0
+
+    @staticmethod
+    def _parse(output: str):
+        properties = {}
+        for line in output.splitlines():
+            key, sep, value = line.partition(":")
+            if sep:
+                properties[key.strip()] = value.strip()
+        return properties
+
+    def export(self):
+        if self.args.file:
+            with open(self.args.file, "r") as f:
+                output = f.read()
+        elif (output := self._command("trace")) is None:
+            return 1
+
+        properties = self._parse(output)
+        if properties.get("format.major") != "1":
+            self.logger.error("Unsupported trace format")
+            return 1
+
+        frequency = int(properties["trace.frequency"])
+        reference = int(properties["trace.cycles"])
+
+        zones = {}
+        for i in range(int(properties["trace.zones"])):
+            zone_id, name_location = properties[f"zone.{i}"].split(" ", 1)
+            name, _, location = name_location.rpartition(" ")
+            zones[int(zone_id, 16)] = (name, location)
+
+        trace_events = []
+        for tid in range(int(properties["trace.threads"])):
+            thread_name = properties[f"thread.{tid}.name"]
+            trace_events.append(
+                {
+                    "name": "thread_name",
+                    "ph": "M",
+                    "pid": 0,
+                    "tid": tid,
+                    "args": {"name": thread_name},
+                }
+            )
+
+            # Skip ends of zones whose begin was overwritten, close unfinished ones
+            stack = []
+            timestamp = 0
+            for i in range(int(properties[f"thread.{tid}.events"])):
+                cycles, event_type, zone_id = properties[
+                    f"thread.{tid}.event.{i}"
+                ].split()
+                # Extend the 32-bit counter assuming events are less than a wrap old
+                cycles = reference - ((reference - int(cycles)) & 0xFFFFFFFF)
+                timestamp = cycles * 1e6 / frequency
+                zone_id = int(zone_id, 16)
+
+                if event_type == "B":
+                    stack.append(zone_id)
+                elif zone_id in stack:
+                    while (top := stack.pop()) != zone_id:
+                        trace_events.append(
+                            self._event(zones, top, "E", tid, timestamp)
+                        )
+                else:
+                    continue
+
+                trace_events.append(
+                    self._event(zones, zone_id, event_type, tid, timestamp)
+                )
+
+            while stack:
+                trace_events.append(
+                    self._event(zones, stack.pop(), "E", tid, timestamp)
+                )
+
+        # Start the trace at zero
+        if timestamps := [event["ts"] for event in trace_events if "ts" in event]:
+            start = min(timestamps)
+            for event in trace_events:
+                if "ts" in event:
+                    event["ts"] -= start
+
+        with open(self.args.output, "w") as f:
+            json.dump({"traceEvents": trace_events, "displayTimeUnit": "ns"}, f)
+
+        self.logger.info(
+            f"Exported {len(trace_events)} events "
+            f"from {properties['trace.threads']} threads to {self.args.output}"
+        )
+        if dropped := int(properties["trace.dropped"]):
+            self.logger.warning(
+                f"{dropped} events from threads without a ring were dropped"
+            )
+
+        return 0
+
+    @staticmethod
+    def _event(zones, zone_id, event_type, tid, timestamp):
+        name, location = zones.get(zone_id, (f"0x{zone_id:08X}", ""))
+        return {
+            "name": name,
+            "cat": "zone",
+            "ph": event_type,
+            "pid": 0,
+            "tid": tid,
+            "ts": timestamp,
+            "args": {"location": location},
+        }
+
+
+if __name__ == "__main__":
+    Main()()
@@ -14,9 +14,12 @@
 #include <furi.h>
 #include <cc1101.h>
 #include <stdio.h>
+#include <toolbox/profiler.h>
 
 #define TAG "FuriHalSubGhz"
 
+PROFILER_ZONE(furi_hal_subghz_zone_tx_refill, "SubGhzTxRefill");
+
 static uint32_t furi_hal_subghz_debug_gpio_buff[2] = {0};
 
 /* DMA Channels definition */
@@ -626,6 +629,7 @@ static inline uint32_t furi_hal_subghz_async_tx_middleware_get_duration(
 
 static void furi_hal_subghz_async_tx_refill(uint32_t* buffer, size_t samples) {
     furi_check(furi_hal_subghz.state == SubGhzStateAsyncTx);
+    PROFILER_TRACE_BEGIN(furi_hal_subghz_zone_tx_refill);
 
     while(samples > 0) {
         volatile uint32_t duration = furi_hal_subghz_async_tx_middleware_get_duration(
@@ -661,6 +665,8 @@ static void furi_hal_subghz_async_tx_refill(uint32_t* buffer, size_t samples) {
             furi_hal_subghz_async_tx.duty_low += duration;
         }
     }
+
+    PROFILER_TRACE_END(furi_hal_subghz_zone_tx_refill);
 }
 
 static void furi_hal_subghz_async_tx_dma_isr(void* context) {
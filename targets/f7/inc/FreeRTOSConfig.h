@@ -148,15 +148,25 @@ standard names. */
 #define configOVERRIDE_DEFAULT_TICK_CONFIGURATION \
     1 /* required only for Keil but does not hurt otherwise */
 
-#define traceTASK_SWITCHED_IN()                                          \
-    extern void furi_hal_mpu_set_stack_protection(uint32_t* stack);      \
-    furi_hal_mpu_set_stack_protection((uint32_t*)pxCurrentTCB->pxStack); \
+#define traceTASK_SWITCHED_IN()                                            \
+    extern void furi_hal_mpu_set_stack_protection(uint32_t* stack);        \
+    furi_hal_mpu_set_stack_protection((uint32_t*)pxCurrentTCB->pxStack);   \
+    extern void furi_thread_telemetry_task_switched_in(TaskHandle_t task); \
+    furi_thread_telemetry_task_switched_in(pxCurrentTCB);                  \
     errno = pxCurrentTCB->iTaskErrno
 //  ^^^^^   acquire errno directly from TCB because FreeRTOS assigns its `FreeRTOS_errno' _after_ our hook is called
 
 // referencing `FreeRTOS_errno' here   vvvvv    because FreeRTOS calls our hook _before_ copying the value into the TCB, hence a manual write to the TCB would get overwritten
 #define traceTASK_SWITCHED_OUT() FreeRTOS_errno = errno
 
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB)                        \
+    extern void furi_thread_telemetry_task_ready(TaskHandle_t task); \
+    furi_thread_telemetry_task_ready(pxTCB)
+
+#define traceTASK_DELETE(pxTCB)                                       \
+    extern void furi_thread_telemetry_task_delete(TaskHandle_t task); \
+    furi_thread_telemetry_task_delete(pxTCB)
+
 #define portCLEAN_UP_TCB(pxTCB)                                   \
     extern void furi_thread_cleanup_tcb_event(TaskHandle_t task); \
     furi_thread_cleanup_tcb_event(pxTCB)